@@ -0,0 +1,99 @@
+#include <EntityManagement/Components.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    constexpr size_t DEFAULT_TRANSFORM_COUNT = 200000;
+    constexpr int    PASSES                  = 10;
+
+    // Integrates every transform a few sub-steps, bouncing off a 800x600
+    // box, so each index costs enough for threads to matter.
+    void moveTransforms(std::vector<Components::CTransform> &transforms,
+                        JobSystem                           &jobs) {
+        constexpr int   SUB_STEPS = 16;
+        constexpr float STEP      = 1.0f / 60.0f / SUB_STEPS;
+
+        jobs.parallelFor(transforms.size(), [&](size_t const index) {
+            Components::CTransform &transform = transforms[index];
+            transform.storePreviousPosition();
+            for (int step = 0; step < SUB_STEPS; ++step) {
+                Vec2 position = transform.topLeftCornerPos +
+                                transform.velocity * STEP;
+                Vec2 velocity = transform.velocity;
+                if (position.x() < 0 || position.x() > 800) {
+                    velocity = Vec2{-velocity.x(), velocity.y()};
+                }
+                if (position.y() < 0 || position.y() > 600) {
+                    velocity = Vec2{velocity.x(), -velocity.y()};
+                }
+                transform.topLeftCornerPos = position;
+                transform.velocity         = velocity;
+            }
+        });
+    }
+
+    std::vector<Components::CTransform> makeTransforms(size_t const count) {
+        std::vector<Components::CTransform> transforms;
+        transforms.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            transforms.emplace_back(
+                Vec2{static_cast<float>(i % 800), static_cast<float>(i % 600)},
+                Vec2{static_cast<float>(i % 13) * 40 - 240,
+                     static_cast<float>(i % 7) * 60 - 180});
+        }
+        return transforms;
+    }
+} // namespace
+
+// Times the same movement pass at each thread count and prints the speedup
+// over one thread. Usage: yerb_engine_bench_movement [transform count]
+int main(int argc, char **argv) {
+    size_t const transformCount =
+        argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                 : DEFAULT_TRANSFORM_COUNT;
+
+    std::cout << std::format("Movement pass: {} transforms x {} passes\n",
+                             transformCount, PASSES);
+    std::cout << std::format("{:>8}{:>14}{:>10}\n", "threads", "ms", "speedup");
+
+    std::vector<Components::CTransform> reference;
+    double                              baselineMs = 0.0;
+    for (size_t const threads : {1, 2, 4, 8, 16}) {
+        auto      transforms = makeTransforms(transformCount);
+        JobSystem jobs(threads);
+
+        auto const start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < PASSES; ++pass) {
+            moveTransforms(transforms, jobs);
+        }
+        std::chrono::duration<double, std::milli> const elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        if (reference.empty()) {
+            reference  = std::move(transforms);
+            baselineMs = elapsed.count();
+        } else {
+            for (size_t i = 0; i < transformCount; ++i) {
+                if (!(transforms[i].topLeftCornerPos ==
+                      reference[i].topLeftCornerPos)) {
+                    std::cerr << std::format(
+                        "Transform {} differs at {} threads\n", i, threads);
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+
+        std::cout << std::format("{:>8}{:>14.3f}{:>9.2f}x\n", threads,
+                                 elapsed.count(),
+                                 baselineMs / elapsed.count());
+    }
+    return EXIT_SUCCESS;
+}
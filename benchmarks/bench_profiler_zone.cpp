@@ -0,0 +1,73 @@
+#include <Profiling/Profiler.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+
+using namespace YerbEngine;
+
+namespace {
+    constexpr int    ROUNDS          = 32;
+    constexpr double TARGET_NS       = 20.0;
+    constexpr size_t ZONES_PER_ROUND = Profiler::EVENTS_PER_THREAD;
+
+    // Nanoseconds per empty zone, over rounds that each fit in the
+    // thread's buffer so no zone takes the cheaper dropped path.
+    double nanosecondsPerZone(bool const capturing) {
+        std::chrono::steady_clock::duration total{};
+        for (int round = 0; round < ROUNDS; ++round) {
+            if (capturing) {
+                Profiler::startCapture();
+            }
+            auto const start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < ZONES_PER_ROUND; ++i) {
+                YERB_ZONE("bench");
+            }
+            total += std::chrono::steady_clock::now() - start;
+            Profiler::stopCapture();
+        }
+        return std::chrono::duration<double, std::nano>(total).count() /
+               static_cast<double>(ROUNDS * ZONES_PER_ROUND);
+    }
+
+    // A zone reads the clock twice; on some virtual machines that alone
+    // costs more than the rest of the zone.
+    double nanosecondsPerClockRead() {
+        auto const start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ROUNDS * ZONES_PER_ROUND; ++i) {
+            static_cast<void>(Profiler::now());
+        }
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() /
+               static_cast<double>(ROUNDS * ZONES_PER_ROUND);
+    }
+} // namespace
+
+// Prints the cost of one zone with no capture running and while
+// capturing. Zones compiled out with YERB_PROFILING=0 cost nothing.
+int main() {
+    // The first zone takes the thread's buffer; keep that out of the timing.
+    Profiler::startCapture();
+    {
+        YERB_ZONE("warm-up");
+    }
+    Profiler::stopCapture();
+
+    double const idle      = nanosecondsPerZone(false);
+    double const capturing = nanosecondsPerZone(true);
+    double const clockRead = nanosecondsPerClockRead();
+    if (Profiler::getDroppedCount() != 0) {
+        std::cerr << "Zones were dropped; the timing is not representative\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::format("Profiler zone, {} zones per mode\n",
+                             ROUNDS * ZONES_PER_ROUND);
+    std::cout << std::format("{:<12}{:>10.2f} ns\n", "idle", idle);
+    std::cout << std::format("{:<12}{:>10.2f} ns (target < {:.0f} ns: {})\n",
+                             "capturing", capturing, TARGET_NS,
+                             capturing < TARGET_NS ? "met" : "missed");
+    std::cout << std::format("{:<12}{:>10.2f} ns\n", "clock read", clockRead);
+    return EXIT_SUCCESS;
+}
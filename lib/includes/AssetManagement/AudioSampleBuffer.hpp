@@ -1,5 +1,6 @@
 #pragma once
 
+#include <GameEngine/SimClock.hpp>
 #include <SystemManagement/AudioManager.hpp>
 #include <array>
 #include <unordered_map>
@@ -36,6 +37,7 @@ namespace YerbEngine {
         size_t                                           m_size = 0;
         std::unordered_map<AudioSampleId, Uint64>         m_lastPlayTimes;
         AudioManager                                    &m_audioManager;
+        SimClock const                                  &m_clock;
 
         static constexpr Uint64                  MIN_REPLAY_INTERVAL = 50;
         std::unordered_map<AudioSampleId, Uint64> m_cooldowns;
@@ -48,7 +50,11 @@ namespace YerbEngine {
         void               trimLowPrioritySamples();
 
       public:
-        explicit AudioSampleBuffer(AudioManager &audioManager);
+        /**
+         * Cooldowns and staleness are measured on `clock`, so they follow
+         * the simulation when it is slowed down, paused or fast-forwarded.
+         */
+        AudioSampleBuffer(AudioManager &audioManager, SimClock const &clock);
         void queueSample(std::string_view sample,
                          PriorityLevel    priority);
         void setCooldown(std::string_view sample,
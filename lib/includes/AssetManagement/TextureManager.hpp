@@ -4,11 +4,16 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace YerbEngine {
+    class JobSystem;
+
     class TextureManager {
         SDL_Renderer                                  *m_renderer;
         std::unordered_map<std::string, SDL_Texture *> m_textures{};
+        JobSystem                                     *m_jobSystem = nullptr;
 
       public:
         explicit TextureManager(SDL_Renderer *renderer);
@@ -18,5 +23,17 @@ namespace YerbEngine {
                                      std::filesystem::path const &path);
         bool         hasTexture(std::string_view name) const;
         SDL_Texture *getTexture(std::string_view name) const;
+
+        /**
+         * Registers several textures at once. Image files are decoded in
+         * parallel on the job system, if one is set; textures are then
+         * created on the calling thread, since the renderer is not thread
+         * safe. Names that are empty or already registered are skipped.
+         */
+        void registerTextures(
+            std::vector<std::pair<std::string, std::filesystem::path>> const
+                &textures);
+
+        void setJobSystem(JobSystem *jobSystem) { m_jobSystem = jobSystem; }
     };
 } // namespace YerbEngine
@@ -60,6 +60,15 @@ namespace YerbEngine {
             return def;
         }
 
+        static inline bool boolOr(bool               def,
+                                  ConfigStore       &store,
+                                  std::string const &key) {
+            auto v = store.get(key);
+            if (std::holds_alternative<bool>(v))
+                return std::get<bool>(v);
+            return def;
+        }
+
         static inline std::string strOr(std::string        def,
                                         ConfigStore       &store,
                                         std::string const &key) {
@@ -92,6 +101,66 @@ namespace YerbEngine {
             cfg.fontSizeMd = intOr(48, m_store, "engine.fonts.sizes.md");
             cfg.fontSizeLg = intOr(68, m_store, "engine.fonts.sizes.lg");
 
+            cfg.headless  = boolOr(false, m_store, "engine.headless");
+            cfg.vsync     = boolOr(true, m_store, "engine.display.vsync");
+            cfg.targetFps = intOr(0, m_store, "engine.display.targetFps");
+
+            cfg.workerThreads = intOr(0, m_store, "engine.threads.workers");
+
+            cfg.simulationTickRate =
+                intOr(60, m_store, "engine.simulation.tickRate");
+            cfg.maxSimulationSteps =
+                intOr(5, m_store, "engine.simulation.maxStepsPerFrame");
+            cfg.simulationTimeScale =
+                floatOr(1.0f, m_store, "engine.simulation.timeScale");
+            cfg.unthrottled =
+                boolOr(false, m_store, "engine.simulation.unthrottled");
+            cfg.unthrottledTicksPerFrame = intOr(
+                600, m_store, "engine.simulation.unthrottledTicksPerFrame");
+
+            cfg.replayRecordPath = strOr("", m_store, "engine.replay.record");
+            cfg.replayPlayPath   = strOr("", m_store, "engine.replay.play");
+
+            cfg.lateInputLatch =
+                boolOr(false, m_store, "engine.input.lateLatch");
+
+            cfg.governorEnabled =
+                boolOr(false, m_store, "engine.governor.enabled");
+            cfg.governorBudgetMs =
+                floatOr(0.0f, m_store, "engine.governor.budgetMs");
+            cfg.governorWindowFrames =
+                intOr(60, m_store, "engine.governor.windowFrames");
+            cfg.governorDegradeAbove =
+                floatOr(1.05f, m_store, "engine.governor.degradeAbove");
+            cfg.governorRecoverBelow =
+                floatOr(0.7f, m_store, "engine.governor.recoverBelow");
+            cfg.governorHoldFrames =
+                intOr(120, m_store, "engine.governor.holdFrames");
+            cfg.governorLevels = intOr(0, m_store, "engine.governor.levels");
+
+            cfg.backgroundUnfocused =
+                strOr("run", m_store, "engine.background.unfocused");
+            cfg.backgroundHidden =
+                strOr("pause", m_store, "engine.background.hidden");
+            cfg.backgroundFrameRate =
+                intOr(10, m_store, "engine.background.simulateFrameRate");
+            cfg.backgroundAudio =
+                strOr("duck", m_store, "engine.background.audio");
+            cfg.backgroundDuckVolume =
+                floatOr(0.25f, m_store, "engine.background.duckVolume");
+
+            cfg.profilerCapture =
+                boolOr(false, m_store, "engine.profiler.capture");
+            cfg.profilerOutput =
+                strOr("trace.json", m_store, "engine.profiler.output");
+            cfg.profilerHotkey = strOr("F9", m_store, "engine.profiler.hotkey");
+
+            cfg.metricsOutput = strOr("", m_store, "engine.metrics.output");
+            cfg.metricsIntervalMs =
+                intOr(0, m_store, "engine.metrics.intervalMs");
+            cfg.allocationSites =
+                boolOr(false, m_store, "engine.allocations.trackSites");
+
             // Gameplay-driven, stays under demo config
             cfg.spawnInterval = u64Or(500, m_store, "gameConfig.spawnInterval");
 
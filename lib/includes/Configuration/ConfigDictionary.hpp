@@ -1,5 +1,6 @@
 #pragma once
 #include <SDL.h>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -47,5 +48,12 @@ namespace YerbEngine {
         }
 
         void clear() { m_configuration.clear(); }
+
+        /**
+         * FNV-1a hash of every key, value and value type, independent of
+         * insertion order and stable across runs and platforms, so two
+         * dictionaries hash equal exactly when they hold the same settings.
+         */
+        uint64_t hash() const;
     };
 } // namespace YerbEngine
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace YerbEngine {
 
         ConfigValue get(std::string const &path) const;
         bool        has(std::string const &path) const;
+        uint64_t    hash() const { return m_provider->hash(); }
         void        reload();
     };
 } // namespace YerbEngine
\ No newline at end of file
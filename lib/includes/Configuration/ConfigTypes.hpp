@@ -15,6 +15,36 @@ namespace YerbEngine {
         int                   fontSizeSm{38};
         int                   fontSizeMd{48};
         int                   fontSizeLg{68};
+        bool                  headless{false}; // no window or audio device
+        bool                  vsync{true};
+        int                   targetFps{0};     // 0 = no software limit
+        int                   workerThreads{0}; // 0 = hardware concurrency
+        int                   simulationTickRate{60}; // ticks per second
+        int                   maxSimulationSteps{5};  // per rendered frame
+        float                 simulationTimeScale{1.0f};
+        bool                  unthrottled{false}; // ticks back to back
+        int                   unthrottledTicksPerFrame{600};
+        std::string           replayRecordPath; // empty = not recording
+        std::string           replayPlayPath;   // empty = live input
+        bool                  lateInputLatch{false}; // re-poll before sim/render
+        bool                  governorEnabled{false};
+        float                 governorBudgetMs{0.0f}; // 0 = frame period
+        int                   governorWindowFrames{60};
+        float                 governorDegradeAbove{1.05f}; // x budget
+        float                 governorRecoverBelow{0.7f};  // x budget
+        int                   governorHoldFrames{120};
+        int                   governorLevels{0}; // degraded levels
+        std::string           backgroundUnfocused{"run"}; // run/simulate/pause
+        std::string           backgroundHidden{"pause"};
+        int                   backgroundFrameRate{10}; // when simulating
+        std::string           backgroundAudio{"duck"}; // keep/duck/pause
+        float                 backgroundDuckVolume{0.25f};
+        bool                  profilerCapture{false}; // capture from startup
+        std::string           profilerOutput{"trace.json"};
+        std::string           profilerHotkey{"F9"}; // SDL key name; "" = none
+        std::string           metricsOutput;        // .csv/.json; "" = none
+        int                   metricsIntervalMs{0}; // 0 = one window at quit
+        bool                  allocationSites{false}; // record call sites
     };
 
     // Engine-wide UI/runtime config (kept for clarity)
@@ -13,6 +13,12 @@ namespace YerbEngine {
 
         virtual ConfigValue getKey(std::string const &name) const = 0;
         virtual bool        hasKey(std::string const &name) const = 0;
+
+        /**
+         * Hash of every setting the provider holds; see
+         * ConfigDictionary::hash.
+         */
+        virtual uint64_t hash() const = 0;
     };
 
     class JsonConfigProvider : public IConfigProvider {
@@ -25,5 +31,6 @@ namespace YerbEngine {
         explicit JsonConfigProvider(std::filesystem::path configPath);
         ConfigValue getKey(std::string const &name) const override;
         bool        hasKey(std::string const &name) const override;
+        uint64_t    hash() const override { return m_configDict.hash(); }
     };
 } // namespace YerbEngine
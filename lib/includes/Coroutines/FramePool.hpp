@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace YerbEngine {
+
+    struct FramePoolStats {
+        size_t chunks      = 0; // chunks taken from the heap so far
+        size_t liveFrames  = 0; // pooled blocks currently handed out
+        size_t largeFrames = 0; // frames too big to pool, ever allocated
+    };
+
+    /**
+     * Allocator for coroutine frames.
+     *
+     * Frames are rounded up to a size class and served from per-class free
+     * lists, which are refilled a chunk at a time. Freed blocks go back on
+     * their list and are never returned to the heap, so a steady number of
+     * live tasks stops allocating once the pool has warmed up. Frames over
+     * MAX_POOLED_SIZE fall back to the global operator new.
+     */
+    class FramePool {
+        static constexpr size_t CLASS_SIZE  = 64;
+        static constexpr size_t CLASS_COUNT = 16;
+        static constexpr size_t CHUNK_SIZE  = 64 * 1024;
+
+        struct FreeBlock {
+            FreeBlock *next;
+        };
+
+        std::mutex                                m_mutex;
+        std::array<FreeBlock *, CLASS_COUNT>      m_freeLists{};
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        FramePoolStats                            m_stats;
+
+        void refill(size_t sizeClass);
+
+      public:
+        static constexpr size_t MAX_POOLED_SIZE = CLASS_SIZE * CLASS_COUNT;
+
+        FramePool() = default;
+
+        FramePool(FramePool const &)            = delete;
+        FramePool &operator=(FramePool const &) = delete;
+
+        /**
+         * The pool used by Task frames.
+         */
+        static FramePool &instance();
+
+        void *allocate(size_t size);
+        void  deallocate(void *block, size_t size);
+
+        FramePoolStats getStats();
+    };
+
+} // namespace YerbEngine
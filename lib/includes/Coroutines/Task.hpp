@@ -0,0 +1,213 @@
+#pragma once
+
+#include <Coroutines/FramePool.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+namespace YerbEngine {
+
+    class TaskScheduler;
+
+    /**
+     * A gameplay coroutine. Write timed behaviour as straight-line code and
+     * suspend with the scheduler's awaitables:
+     *
+     *     Task MainScene::spawnLoop() {
+     *         while (true) {
+     *             co_await m_tasks.waitFor(interval);
+     *             spawnSomething();
+     *         }
+     *     }
+     *
+     *     m_tasks.spawn(spawnLoop());
+     *
+     * A Task does nothing until it is handed to TaskScheduler::spawn, which
+     * runs it up to its first suspension and then owns it. Frames come from
+     * FramePool rather than the heap.
+     */
+    class Task {
+      public:
+        struct promise_type {
+            TaskScheduler *scheduler = nullptr;
+            promise_type  *previous  = nullptr; // scheduler's live list
+            promise_type  *next      = nullptr;
+
+            Task get_return_object() {
+                return Task{std::coroutine_handle<promise_type>::from_promise(
+                    *this)};
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_never  final_suspend() noexcept { return {}; }
+            void                return_void() {}
+            void                unhandled_exception();
+
+            ~promise_type();
+
+            static void *operator new(size_t const size) {
+                return FramePool::instance().allocate(size);
+            }
+            static void operator delete(void *const frame, size_t const size) {
+                FramePool::instance().deallocate(frame, size);
+            }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task(Task &&other) noexcept : m_handle(other.m_handle) {
+            other.m_handle = nullptr;
+        }
+        Task &operator=(Task &&)      = delete;
+        Task(Task const &)            = delete;
+        Task &operator=(Task const &) = delete;
+
+        // Only a task that was never spawned still owns its frame.
+        ~Task() {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+      private:
+        friend class TaskScheduler;
+        explicit Task(Handle const handle) : m_handle(handle) {}
+
+        Handle m_handle;
+    };
+
+    /**
+     * Wakes every task waiting on it. Waiters resume on the scheduler's next
+     * update, not inside signal(), so signalling from a system never runs
+     * gameplay code in the middle of it. A task that awaits after the
+     * signal waits for the next one.
+     */
+    class TaskEvent {
+        TaskScheduler                        &m_scheduler;
+        std::vector<std::coroutine_handle<>> m_waiters;
+
+        friend class TaskScheduler;
+
+      public:
+        explicit TaskEvent(TaskScheduler &scheduler);
+        ~TaskEvent();
+
+        TaskEvent(TaskEvent const &)            = delete;
+        TaskEvent &operator=(TaskEvent const &) = delete;
+
+        void signal();
+
+        size_t getWaiterCount() const { return m_waiters.size(); }
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> const handle) {
+            m_waiters.push_back(handle);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * Runs Tasks against a clock it is told about.
+     *
+     * Time only moves in update(), so tasks follow whatever drives it: the
+     * Scene advances its scheduler once per fixed tick, which stops task
+     * time while the scene is paused. Sleeping tasks sit in a min-heap
+     * keyed by wake time and cost nothing until they are due; waking is
+     * ordered by wake time, then by when the wait began.
+     *
+     * Not thread safe: spawn, update and the awaitables belong to the
+     * thread that owns the scene.
+     */
+    class TaskScheduler {
+        struct Timer {
+            double                  wakeTime;
+            uint64_t                sequence;
+            std::coroutine_handle<> handle;
+
+            bool operator>(Timer const &other) const {
+                return wakeTime != other.wakeTime
+                           ? wakeTime > other.wakeTime
+                           : sequence > other.sequence;
+            }
+        };
+
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<>>
+                                             m_timers;
+        std::vector<std::coroutine_handle<>> m_ready;
+        std::vector<std::coroutine_handle<>> m_resuming; // scratch
+        std::vector<TaskEvent *>             m_events;
+        Task::promise_type                  *m_live      = nullptr;
+        size_t                               m_taskCount = 0;
+        uint64_t                             m_sequence  = 0;
+        double                               m_now       = 0;
+
+        friend struct Task::promise_type;
+        friend class TaskEvent;
+
+        void unlink(Task::promise_type &promise);
+
+      public:
+        struct WaitFor {
+            TaskScheduler &scheduler;
+            double         milliseconds;
+
+            bool await_ready() const noexcept { return milliseconds <= 0; }
+            void await_suspend(std::coroutine_handle<> handle) const;
+            void await_resume() const noexcept {}
+        };
+
+        struct NextFrame {
+            TaskScheduler &scheduler;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> const handle) const {
+                scheduler.m_ready.push_back(handle);
+            }
+            void await_resume() const noexcept {}
+        };
+
+        TaskScheduler() = default;
+        ~TaskScheduler();
+
+        TaskScheduler(TaskScheduler const &)            = delete;
+        TaskScheduler &operator=(TaskScheduler const &) = delete;
+
+        /**
+         * Takes ownership of task and runs it until it first suspends.
+         */
+        void spawn(Task task);
+
+        /**
+         * Advances the clock by `elapsedMs`, resumes every task whose timer
+         * came due (reading now() as its wake time, so repeated waits do not
+         * drift), then every task waiting on nextFrame() or a signalled
+         * event.
+         */
+        void update(double elapsedMs);
+
+        /**
+         * Destroys every live task, wherever it is suspended.
+         */
+        void cancelAll();
+
+        /**
+         * Suspends the awaiting task for `milliseconds` of scheduler time.
+         * Zero or less does not suspend.
+         */
+        WaitFor waitFor(double const milliseconds) {
+            return WaitFor{*this, milliseconds};
+        }
+
+        /**
+         * Suspends the awaiting task until the next update.
+         */
+        NextFrame nextFrame() { return NextFrame{*this}; }
+
+        double now() const { return m_now; }
+        size_t getTaskCount() const { return m_taskCount; }
+        size_t getSleepingCount() const { return m_timers.size(); }
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+// Undeclared-access checks are compiled into debug builds, or into any
+// build that defines YERB_CHECK_SYSTEM_ACCESS=1.
+#if !defined(YERB_CHECK_SYSTEM_ACCESS)
+#if defined(NDEBUG)
+#define YERB_CHECK_SYSTEM_ACCESS 0
+#else
+#define YERB_CHECK_SYSTEM_ACCESS 1
+#endif
+#endif
+
+namespace YerbEngine {
+
+    /**
+     * The component types (and shared resources) a system reads and
+     * writes. Types are compared by identity, so resources that are not
+     * components, such as the audio queue or the entity list, are declared
+     * the same way, e.g. writes<AudioSampleBuffer>().
+     *
+     * A default-constructed access is undeclared: the system may touch
+     * anything and conflicts with every other system. Writing a type
+     * implies reading it.
+     */
+    class SystemAccess {
+        std::vector<std::type_index> m_reads;
+        std::vector<std::type_index> m_writes;
+        bool                         m_declared   = false;
+        bool                         m_mainThread = false;
+
+        static bool containsType(std::vector<std::type_index> const &types,
+                                 std::type_index const               type) {
+            return std::ranges::find(types, type) != types.end();
+        }
+
+      public:
+        template <typename... Types>
+        SystemAccess &reads() {
+            (m_reads.emplace_back(typeid(Types)), ...);
+            m_declared = true;
+            return *this;
+        }
+
+        template <typename... Types>
+        SystemAccess &writes() {
+            (m_writes.emplace_back(typeid(Types)), ...);
+            m_declared = true;
+            return *this;
+        }
+
+        /**
+         * Marks a system that must run on the thread driving the pipeline,
+         * e.g. because it calls into the SDL renderer. Two main-thread
+         * systems never run at the same time.
+         */
+        SystemAccess &onMainThread() {
+            m_mainThread = true;
+            return *this;
+        }
+
+        bool isDeclared() const { return m_declared; }
+        bool needsMainThread() const { return m_mainThread; }
+
+        bool canRead(std::type_index const type) const {
+            return !m_declared || containsType(m_reads, type) ||
+                   containsType(m_writes, type);
+        }
+
+        bool canWrite(std::type_index const type) const {
+            return !m_declared || containsType(m_writes, type);
+        }
+
+        /**
+         * True if the two systems may not run at the same time: either is
+         * undeclared, both need the main thread, or one writes a type the
+         * other reads or writes.
+         */
+        bool conflictsWith(SystemAccess const &other) const {
+            if (!m_declared || !other.m_declared) {
+                return true;
+            }
+            if (m_mainThread && other.m_mainThread) {
+                return true;
+            }
+            auto const writesAny = [](SystemAccess const &writer,
+                                      SystemAccess const &reader) {
+                return std::ranges::any_of(
+                    writer.m_writes, [&](std::type_index const type) {
+                        return containsType(reader.m_reads, type) ||
+                               containsType(reader.m_writes, type);
+                    });
+            };
+            return writesAny(*this, other) || writesAny(other, *this);
+        }
+    };
+
+    /**
+     * Access declared by the system currently running on this thread.
+     * Installed by SystemPipeline for the duration of each system run when
+     * access checks are enabled.
+     */
+    struct SystemAccessScope {
+        char const                   *systemName;
+        SystemAccess const           *access;
+        std::vector<std::type_index> *reported; // types already logged
+        size_t                        violations = 0;
+    };
+
+    namespace ComponentAccess {
+        SystemAccessScope *&currentScope();
+
+        /**
+         * Logs an access the running system did not declare, once per
+         * system and type, and counts it on the scope.
+         */
+        void reportUndeclared(std::type_index type,
+                              bool            write);
+
+        /**
+         * Counts a component lookup on the global "components.lookups"
+         * metric.
+         */
+        void countLookup();
+
+        template <typename T>
+        void checkRead() {
+#if YERB_CHECK_SYSTEM_ACCESS
+            SystemAccessScope const *scope = currentScope();
+            if (scope != nullptr && !scope->access->canRead(typeid(T))) {
+                reportUndeclared(typeid(T), false);
+            }
+#endif
+        }
+
+        template <typename T>
+        void checkWrite() {
+#if YERB_CHECK_SYSTEM_ACCESS
+            SystemAccessScope const *scope = currentScope();
+            if (scope != nullptr && !scope->access->canWrite(typeid(T))) {
+                reportUndeclared(typeid(T), true);
+            }
+#endif
+        }
+    } // namespace ComponentAccess
+
+} // namespace YerbEngine
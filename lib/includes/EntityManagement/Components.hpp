@@ -12,13 +12,26 @@ namespace YerbEngine {
           public:
             Vec2 topLeftCornerPos{0, 0};
             Vec2 velocity{0, 0};
+            // Position at the start of the current fixed tick, used to
+            // interpolate rendering between ticks.
+            Vec2 previousTopLeftCornerPos{0, 0};
 
             CTransform(Vec2 const &position,
                        Vec2 const &velocity)
                 : topLeftCornerPos(position),
-                  velocity(velocity) {}
+                  velocity(velocity),
+                  previousTopLeftCornerPos(position) {}
 
             CTransform() = default;
+
+            void storePreviousPosition() {
+                previousTopLeftCornerPos = topLeftCornerPos;
+            }
+
+            Vec2 interpolatedPosition(float const alpha) const {
+                return previousTopLeftCornerPos +
+                       (topLeftCornerPos - previousTopLeftCornerPos) * alpha;
+            }
         };
 
         class CShape {
@@ -41,14 +54,18 @@ namespace YerbEngine {
 
         class CLifespan {
           public:
-            Uint64 birthTime;
-            Uint64 lifespan = 0;
-
-            CLifespan() : birthTime(SDL_GetTicks64()) {}
-
-            explicit CLifespan(Uint64 const lifespan)
-                : birthTime(SDL_GetTicks64()),
-                  lifespan(lifespan) {}
+            // Scene time the lifespan started at, set when
+            // LifespanTracker::track starts it.
+            Uint64 birthTime = 0;
+            Uint64 lifespan  = 0;
+            // Whether the entity fades out over its final window, and the
+            // LifespanTracker timer waiting on its next deadline.
+            bool   fades = true;
+            Uint64 timer = 0;
+
+            CLifespan() = default;
+
+            explicit CLifespan(Uint64 const lifespan) : lifespan(lifespan) {}
         };
 
         enum EffectTypes { Speed, Slowness };
@@ -65,14 +82,20 @@ namespace YerbEngine {
           public:
             CEffects() = default;
 
-            void addEffect(Effect const &effect) {
+            /**
+             * Adds `effect` unless one of the same type is already active.
+             *
+             * @returns true if the effect was added.
+             */
+            bool addEffect(Effect const &effect) {
                 for (auto const &[startTime, duration, type] : effects) {
                     if (type == effect.type) {
-                        return;
+                        return false;
                     }
                 }
 
                 effects.push_back(effect);
+                return true;
             }
 
             std::vector<Effect> const &getEffects() const { return effects; }
@@ -104,6 +127,44 @@ namespace YerbEngine {
             int getBounces() const { return m_bounces; }
         };
 
+        enum class BodyType { Dynamic, Static };
+
+        /**
+         * Opts an entity into collision world classification.
+         *
+         * Static bodies never move and are kept in a prebuilt broadphase that
+         * is only rebuilt when static bodies are added or destroyed. Dynamic
+         * bodies with allowSleep set are put to sleep after staying idle for
+         * a number of ticks and are skipped until something wakes them.
+         * Entities without a collider are treated as dynamic and never sleep.
+         *
+         * Fast movers are swept from their previous position each update so
+         * they cannot tunnel through thin bodies between ticks. `layers` is
+         * the bitmask matched by spatial query filters.
+         */
+        class CCollider {
+          public:
+            static constexpr Uint32 DEFAULT_LAYER = 1;
+
+            BodyType bodyType   = BodyType::Dynamic;
+            bool     allowSleep = false;
+            bool     fastMover  = false;
+            Uint32   layers     = DEFAULT_LAYER;
+            // Bodies a fast mover stops at: one bit per EntityTags value,
+            // and a mask matched against the other body's `layers`.
+            Uint32 sweepTags   = ~0u;
+            Uint32 sweepLayers = ~0u;
+
+            CCollider() = default;
+
+            explicit CCollider(BodyType const bodyType,
+                               bool const     allowSleep = false,
+                               bool const     fastMover  = false)
+                : bodyType(bodyType),
+                  allowSleep(allowSleep),
+                  fastMover(fastMover) {}
+        };
+
         class CSprite {
           public:
             explicit CSprite(std::string_view textureId)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "./ComponentAccess.hpp"
 #include "./ComponentRegistry.hpp"
 #include "./Components.hpp"
 #include <memory>
@@ -78,7 +79,10 @@ namespace YerbEngine {
 
     template <typename ComponentType>
     std::shared_ptr<ComponentType> Entity::getComponent() const {
-        auto registry = m_registry.lock();
+        ComponentAccess::checkRead<ComponentType>();
+        ComponentAccess::countLookup();
+        // Const lookup never creates a pool, so concurrent reads are safe.
+        std::shared_ptr<ComponentRegistry const> registry = m_registry.lock();
         if (!registry) {
             return nullptr;
         }
@@ -87,6 +91,7 @@ namespace YerbEngine {
 
     template <typename ComponentType>
     void Entity::setComponent(std::shared_ptr<ComponentType> component) {
+        ComponentAccess::checkWrite<ComponentType>();
         auto registry = m_registry.lock();
         if (!registry) {
             return;
@@ -96,6 +101,7 @@ namespace YerbEngine {
 
     template <typename ComponentType>
     void Entity::removeComponent() {
+        ComponentAccess::checkWrite<ComponentType>();
         auto registry = m_registry.lock();
         if (!registry) {
             return;
@@ -105,6 +111,8 @@ namespace YerbEngine {
 
     template <typename ComponentType>
     bool Entity::hasComponent() const {
+        ComponentAccess::checkRead<ComponentType>();
+        ComponentAccess::countLookup();
         auto registry = m_registry.lock();
         if (!registry) {
             return false;
@@ -9,6 +9,9 @@
 
 namespace YerbEngine {
 
+    class Gauge;
+    class MetricsRegistry;
+
     using EntityList = std::vector<std::shared_ptr<Entity>>;
     using EntityMap  = std::unordered_map<EntityTags, EntityList>;
 
@@ -19,6 +22,8 @@ namespace YerbEngine {
         size_t                             m_totalEntities = 0;
         std::shared_ptr<ComponentRegistry> m_components =
             std::make_shared<ComponentRegistry>();
+        std::vector<Gauge *>               m_tagGauges; // by EntityTags
+        Gauge                             *m_totalGauge = nullptr;
 
       public:
         EntityManager()  = default;
@@ -33,10 +38,21 @@ namespace YerbEngine {
         std::shared_ptr<Entity> addEntity(EntityTags tag);
         EntityList             &getEntities();
         EntityList             &getEntities(EntityTags tag);
+        EntityList const       &getEntities() const;
+        EntityList const       &getEntities(EntityTags tag) const;
 
         ComponentRegistry       &components();
         ComponentRegistry const &components() const;
         void                     update();
+
+        /**
+         * Publishes live entity counts to `metrics` on each update(), as
+         * the "entities.<Tag>" and "entities.total" gauges, or nowhere if
+         * it is null, the default. Only the active scene's manager should
+         * publish, as every manager would write the same gauges. The
+         * registry must outlive the manager.
+         */
+        void setMetrics(MetricsRegistry *metrics);
     };
 
 } // namespace YerbEngine
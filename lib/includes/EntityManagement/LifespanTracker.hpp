@@ -0,0 +1,67 @@
+#pragma once
+
+#include <EntityManagement/Components.hpp>
+#include <EntityManagement/EntityManager.hpp>
+#include <GameEngine/TimerWheel.hpp>
+
+#include <memory>
+
+namespace YerbEngine {
+
+    /**
+     * Ends CLifespan entities from a timer wheel instead of checking every
+     * entity every frame.
+     *
+     * Each tracked entity has one pending timer: first for the start of its
+     * final `fadeWindow`, then for its expiry. Entities between the two are
+     * listed by getFading(), so fade progress is only computed for them;
+     * a long-lived entity costs nothing until its final window begins.
+     *
+     * Times are milliseconds on whatever clock the owner passes to
+     * advance(), normally scene time.
+     */
+    class LifespanTracker {
+        TimerWheel<std::weak_ptr<Entity>> m_timers;
+        EntityList                        m_fading;
+        Uint64                            m_fadeWindow;
+
+        void schedule(std::shared_ptr<Entity> const &entity,
+                      Components::CLifespan         &lifespan);
+
+      public:
+        explicit LifespanTracker(Uint64 fadeWindow);
+
+        /**
+         * Starts the entity's lifespan at now(), overwriting the CLifespan
+         * birth time. Entities without a CLifespan are ignored.
+         */
+        void track(std::shared_ptr<Entity> const &entity);
+
+        /**
+         * Reschedules the entity after its lifespan was changed.
+         */
+        void retime(std::shared_ptr<Entity> const &entity);
+
+        /**
+         * Moves the clock to `now`, lists entities that entered their final
+         * window, and appends those whose lifespan has ended to `expired`.
+         * Destroyed entities are dropped without being reported.
+         */
+        void advance(Uint64 now, EntityList &expired);
+
+        /**
+         * Entities inside their final window, not yet expired.
+         */
+        EntityList const &getFading() const { return m_fading; }
+
+        /**
+         * How far through its final window the lifespan is, from 0 when the
+         * window opens to 1 at expiry.
+         */
+        float getFadeProgress(Components::CLifespan const &lifespan) const;
+
+        Uint64 now() const { return m_timers.now(); }
+        size_t getPendingCount() const { return m_timers.size(); }
+    };
+
+} // namespace YerbEngine
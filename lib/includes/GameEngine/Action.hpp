@@ -1,25 +1,71 @@
 #pragma once
 #include <Helpers/Vec2.hpp>
+#include <cstdint>
 #include <optional>
-#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace YerbEngine {
 
-    enum class ActionState { START, END };
+    /**
+     * An action name interned to a small integer. Scenes compare ids, not
+     * names, so dispatching an action never touches a string.
+     */
+    using ActionId = uint16_t;
+
+    inline constexpr ActionId NO_ACTION = UINT16_MAX;
+
+    /**
+     * Process-wide table of action names. Interning the same name always
+     * gives the same id within a run; ids are not stable across runs, so
+     * anything saved (replays) stores names.
+     *
+     * Safe to call from any thread, so scenes built in the background can
+     * register their actions.
+     */
+    class ActionNames {
+      public:
+        /**
+         * The id for `name`, assigning the next free one on first use.
+         *
+         * @throws std::runtime_error if every id is taken.
+         */
+        static ActionId intern(std::string_view name);
+
+        /**
+         * The name `id` was interned from, or an empty view for an unknown
+         * id. The view stays valid for the rest of the run.
+         */
+        static std::string_view name(ActionId id);
+    };
+
+    enum class ActionState : uint8_t { START, END };
+
     class Action {
-        std::string m_name;  // Action name, e.g., "SHOOT", "JUMP"
-        ActionState m_state; // State of the action
-        std::optional<Vec2>
-            m_pos; // The position associated with the action, if any
+        ActionId            m_id    = NO_ACTION;
+        ActionState         m_state = ActionState::START;
+        std::optional<Vec2> m_pos; // The position associated with the action
 
       public:
-        Action(std::string                name,
-               ActionState const         &state,
-               std::optional<Vec2> const &pos);
+        Action() = default;
+        Action(ActionId const            id,
+               ActionState const         state,
+               std::optional<Vec2> const pos)
+            : m_id(id),
+              m_state(state),
+              m_pos(pos) {}
 
-        std::string const         &getName() const;
-        ActionState const         &getState() const;
-        std::optional<Vec2> const &getPos() const;
+        ActionId                   getId() const { return m_id; }
+        ActionState                getState() const { return m_state; }
+        std::optional<Vec2> const &getPos() const { return m_pos; }
+
+        /**
+         * The interned name, for logging and recording.
+         */
+        std::string_view getName() const { return ActionNames::name(m_id); }
     };
 
+    // Actions are copied into queues and recordings by the frame.
+    static_assert(std::is_trivially_copyable_v<Action>);
+
 } // namespace YerbEngine
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <GameEngine/Action.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * Maps input codes (SDL keycodes, mouse buttons, SDL_MOUSEMOTION) to
+     * action ids.
+     *
+     * An open-addressing table with linear probing, kept at most half
+     * full, so a lookup is a hash and a probe or two through one flat
+     * array. Bindings are only added, at scene setup, so lookups made per
+     * input event never allocate.
+     */
+    class ActionMap {
+        struct Slot {
+            int32_t  input  = 0;
+            ActionId action = NO_ACTION; // NO_ACTION marks an empty slot
+        };
+
+        std::vector<Slot> m_slots;
+        size_t            m_size = 0;
+
+        size_t indexOf(int32_t input) const;
+        void   grow();
+
+      public:
+        /**
+         * Binds `input` to `action`, replacing any earlier binding.
+         */
+        void bind(int32_t input, ActionId action);
+
+        /**
+         * The action bound to `input`, or NO_ACTION.
+         */
+        ActionId find(int32_t input) const;
+
+        bool contains(int32_t const input) const {
+            return find(input) != NO_ACTION;
+        }
+
+        size_t size() const { return m_size; }
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace YerbEngine {
+
+    /**
+     * What the engine does while its window is in the background.
+     */
+    enum class BackgroundPolicy : uint8_t {
+        Run,      // as in the foreground
+        Simulate, // keep ticking at a low frame rate, render nothing
+        Pause,    // no ticks, no rendering; wait for window events
+    };
+
+    /**
+     * What happens to audio while the window is in the background.
+     */
+    enum class BackgroundAudio : uint8_t { Keep, Duck, Pause };
+
+    struct BackgroundSettings {
+        BackgroundPolicy unfocused         = BackgroundPolicy::Run;
+        BackgroundPolicy hidden            = BackgroundPolicy::Pause;
+        int              simulateFrameRate = 10; // frames per second
+        BackgroundAudio  audio             = BackgroundAudio::Duck;
+        float            duckVolume        = 0.25f; // fraction of full
+
+        /**
+         * The policy for a window that is `hidden` (minimized or hidden)
+         * and/or not `focused`. Hidden takes precedence.
+         */
+        BackgroundPolicy select(bool hidden,
+                                bool focused) const;
+    };
+
+    /**
+     * Parses "run", "simulate" or "pause".
+     */
+    std::optional<BackgroundPolicy>
+    parseBackgroundPolicy(std::string_view name);
+
+    /**
+     * Parses "keep", "duck" or "pause".
+     */
+    std::optional<BackgroundAudio>
+    parseBackgroundAudio(std::string_view name);
+
+    char const *toString(BackgroundPolicy policy);
+
+} // namespace YerbEngine
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+
+namespace YerbEngine {
+
+    /**
+     * Accumulator that turns variable frame times into a whole number of
+     * fixed simulation ticks.
+     *
+     * Each frame, advance() adds the elapsed real time and returns how many
+     * ticks to simulate. The time left over is exposed as alpha(), the
+     * fraction of a tick that rendering should interpolate past the previous
+     * tick. If a frame would need more than `maxStepsPerFrame` ticks (a
+     * stall, a breakpoint, a dragged window), the excess is dropped so a
+     * slow frame cannot snowball into ever slower frames. The limit assumes
+     * about one frame per tick; setFrameRate() adjusts it for a loop that
+     * deliberately runs slower.
+     */
+    class FixedTimestep {
+        double m_tickSeconds;
+        size_t m_maxStepsPerFrame;
+        size_t m_stepsPerFrame = 1; // expected ticks per frame
+        double m_accumulator   = 0.0;
+        size_t m_droppedTicks  = 0;
+
+      public:
+        static constexpr int    DEFAULT_TICK_RATE = 60;
+        static constexpr size_t DEFAULT_MAX_STEPS = 5;
+
+        explicit FixedTimestep(int    tickRate         = DEFAULT_TICK_RATE,
+                               size_t maxStepsPerFrame = DEFAULT_MAX_STEPS);
+
+        /**
+         * Adds `frameSeconds` of real time and returns the number of ticks
+         * to run this frame, at most getStepLimit().
+         */
+        size_t advance(double frameSeconds);
+
+        /**
+         * Expects `framesPerSecond` frames a second, e.g. a throttled
+         * background loop. A frame may then run its share of ticks,
+         * ceil(tickRate / framesPerSecond), on top of the usual
+         * `maxStepsPerFrame - 1` of catch-up, so a low frame rate does not
+         * slow the simulation down. 0, or a rate at or above the tick
+         * rate, goes back to one frame per tick.
+         */
+        void setFrameRate(int framesPerSecond);
+
+        /**
+         * Most ticks a single frame runs before the rest are dropped.
+         */
+        size_t getStepLimit() const {
+            return m_maxStepsPerFrame + m_stepsPerFrame - 1;
+        }
+
+        /**
+         * Discards accumulated time, e.g. after a scene change or a long
+         * pause, so the next frame does not try to catch up.
+         */
+        void reset() { m_accumulator = 0.0; }
+
+        double getTickSeconds() const { return m_tickSeconds; }
+
+        /**
+         * Fraction in [0, 1) of a tick accumulated since the last tick.
+         */
+        float alpha() const {
+            return static_cast<float>(m_accumulator / m_tickSeconds);
+        }
+
+        /**
+         * Ticks skipped by the spiral-of-death clamp since construction.
+         */
+        size_t getDroppedTicks() const { return m_droppedTicks; }
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace YerbEngine {
+
+    struct FramePacingStats {
+        size_t frames          = 0;
+        size_t missedDeadlines = 0;   // frames more than half a period late
+        double lastFrameMs     = 0.0; // time between the last two frames
+        double lastErrorMs     = 0.0; // how late the last frame ended
+        double meanErrorMs     = 0.0; // mean absolute error
+        double maxErrorMs      = 0.0;
+    };
+
+    /**
+     * Paces the native main loop to a target frame rate.
+     *
+     * endFrame() is called once per frame after presenting. When limiting,
+     * it blocks until the next deadline: it sleeps until shortly before the
+     * deadline, then spins for the rest, since sleeps routinely overshoot
+     * by a millisecond or more. The spin window follows the oversleep
+     * actually observed on this machine, so the CPU only spins as long as
+     * it has to.
+     *
+     * Deadlines advance by exactly one period so rounding does not drift
+     * the frame rate. A frame that runs more than a period late starts a
+     * new schedule instead of rushing to catch up.
+     *
+     * When vsync already paces presentation, the pacer runs in measure-only
+     * mode: it never waits but still records how far each frame strays from
+     * the expected period.
+     */
+    class FramePacer {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+      private:
+        Clock::duration   m_period{0};
+        bool              m_limit = false;
+        Clock::time_point m_deadline;
+        Clock::time_point m_lastFrameEnd;
+        bool              m_hasLastFrame = false;
+        double            m_errorSumMs   = 0.0;
+        FramePacingStats  m_stats;
+
+        // Smoothed oversleep estimate, in the clock's ticks.
+        Clock::duration m_spinWindow;
+
+        void waitUntil(Clock::time_point deadline);
+        void record(Clock::time_point frameEnd,
+                    Clock::time_point deadline);
+
+      public:
+        static constexpr std::chrono::microseconds MIN_SPIN_WINDOW{200};
+        static constexpr std::chrono::microseconds MAX_SPIN_WINDOW{4000};
+
+        FramePacer();
+
+        /**
+         * @param framesPerSecond Target rate; 0 or less disables pacing and
+         * measurement.
+         * @param limit true to wait for each deadline, false to only measure
+         * (e.g. when vsync blocks in present).
+         */
+        void setTargetFrameRate(double framesPerSecond,
+                                bool   limit);
+
+        bool   isLimiting() const { return m_limit; }
+        double getTargetFrameRate() const;
+
+        /**
+         * Marks the end of a frame, waiting for its deadline when limiting.
+         */
+        void endFrame();
+
+        FramePacingStats const &getStats() const { return m_stats; }
+        void                    resetStats();
+    };
+
+} // namespace YerbEngine
@@ -6,12 +6,26 @@
 #include <AssetManagement/AudioSampleBuffer.hpp>
 #include <AssetManagement/FontManager.hpp>
 #include <AssetManagement/TextureManager.hpp>
+#include <GameEngine/BackgroundPolicy.hpp>
+#include <GameEngine/FixedTimestep.hpp>
+#include <GameEngine/FramePacer.hpp>
+#include <GameEngine/InputLatency.hpp>
+#include <GameEngine/InputReplay.hpp>
+#include <GameEngine/PerformanceGovernor.hpp>
+#include <GameEngine/SimClock.hpp>
+#include <Profiling/Metrics.hpp>
 #include <SystemManagement/AudioManager.hpp>
 #include <SystemManagement/VideoManager.hpp>
+#include <Threading/JobSystem.hpp>
 
+#include <chrono>
 #include <filesystem>
+#include <functional>
+#include <future>
 #include <map>
+#include <random>
 #include <string>
+#include <vector>
 
 namespace YerbEngine {
 
@@ -20,23 +34,102 @@ namespace YerbEngine {
 
     class GameEngine {
       protected:
-        std::map<std::string, std::shared_ptr<Scene>> m_scenes;
-        std::string                                   m_currentSceneName;
-        bool                                          m_isRunning = false;
+        struct StackedScene {
+            std::string            name;
+            std::shared_ptr<Scene> scene;
+        };
+
+        // Bottom to top; only the top scene runs.
+        std::vector<StackedScene> m_sceneStack;
+        bool                      m_isRunning = false;
+        bool                      m_headless  = false;
 
         std::unique_ptr<FontManager>       m_fontManager;
         std::unique_ptr<AudioManager>      m_audioManager;
         std::unique_ptr<TextureManager>    m_textureManager;
         std::unique_ptr<AudioSampleBuffer> m_audioSampleBuffer;
         std::unique_ptr<VideoManager>      m_videoManager;
+        std::unique_ptr<JobSystem>         m_jobSystem;
         std::unique_ptr<ConfigStore> m_configStore; // default engine config
         std::unique_ptr<ConfigAdapter>
             m_configAdapter; // default engine adapter
         std::map<std::string, std::unique_ptr<ConfigStore>>   m_namedStores;
         std::map<std::string, std::unique_ptr<ConfigAdapter>> m_namedAdapters;
 
+        SimClock                              m_simClock;
+        FixedTimestep                         m_fixedTimestep;
+        FramePacer                            m_framePacer;
+        std::chrono::steady_clock::time_point m_lastFrameTime;
+        bool                                  m_hasLastFrameTime = false;
+
+        uint64_t                       m_seed = 0;
+        std::mt19937_64                m_seedSequence;
+        std::unique_ptr<InputRecorder> m_recorder;
+        Path                           m_recordPath;
+        std::unique_ptr<InputReplay>   m_replay;
+        std::vector<Action>            m_replayActions; // reused per frame
+        bool                           m_replayChecked = false;
+
+        InputLatencyTracker m_inputLatency;
+        uint64_t            m_presentsSeen = 0;
+        bool                m_lateLatch    = false;
+
+        PerformanceGovernor m_governor;
+
+        BackgroundSettings m_backgroundSettings;
+        BackgroundPolicy   m_background    = BackgroundPolicy::Run;
+        bool               m_windowHidden  = false;
+        bool               m_windowFocused = true;
+        bool               m_inBackground  = false; // hidden or unfocused
+
+        std::chrono::steady_clock::time_point m_nextBackgroundFrame;
+
+        Path        m_profilerOutput;
+        SDL_Keycode m_profilerHotkey = SDLK_UNKNOWN;
+
+        Histogram                            *m_frameTimeUs      = nullptr;
+        Histogram                            *m_frameWorkUs      = nullptr;
+        Histogram                            *m_frameAllocations = nullptr;
+        // Whole-run copies of the above for the exit report, as closing a
+        // metrics window clears the registry's.
+        Histogram                             m_runFrameTimeUs{"us"};
+        Histogram                             m_runFrameAllocations{"allocs"};
+        std::unique_ptr<MetricsFile>          m_metricsFile;
+        std::chrono::milliseconds             m_metricsInterval{0};
+        std::chrono::steady_clock::time_point m_nextMetricsWindow;
+
+        // Declared last so pending preparations finish before anything they
+        // may use is destroyed.
+        std::map<std::string, std::future<std::shared_ptr<Scene>>> m_preparing;
+        std::map<std::string, std::shared_ptr<Scene>>               m_prepared;
+
+        /**
+         * The top of the scene stack, or null when the stack is empty.
+         */
+        std::shared_ptr<Scene> getActiveScene() const;
+
+        /**
+         * Makes `scene` the one that runs from the next frame: finishes its
+         * preparation if needed and restarts the fixed timestep so it does
+         * not catch up on time spent elsewhere.
+         */
+        void activateScene(Scene &scene);
+
+        /**
+         * Moves preparations that have finished into m_prepared, running
+         * their onPrepared() on this (the main) thread. Called every pass of
+         * the main loop, whether or not a frame is due.
+         */
+        void pollPreparedScenes();
+
         /**
-         * Calls the active scene's update method.
+         * Runs one frame of the active scene: its Input systems, a fixed tick
+         * for each whole tick of simulated time elapsed since the last frame
+         * (or the SimClock's batch when unthrottled), its Render systems
+         * unless headless, then its update method. With late latching on,
+         * input is drained again before the ticks and before rendering.
+         * While simulating in the background, only the ticks run, followed
+         * by the scene's onEnd() if its end was triggered.
          *
          * This is used in the main loop to update on each frame.
          */
@@ -72,11 +165,139 @@ namespace YerbEngine {
          */
         void S_UserInput();
 
+        /**
+         * With late latching on, drains input again just before simulating
+         * and just before rendering, so the newest aim and movement state
+         * reach the frame instead of the state seen at the top of the loop.
+         */
+        void latchInput();
+
+        /**
+         * Records an input-to-present sample if the frame presented.
+         */
+        void notePresent();
+
+        /**
+         * Time since `frameStart`, less any time blocked in present if the
+         * frame presented: the frame's own work, without vsync waits.
+         */
+        std::chrono::steady_clock::duration
+        frameWorkTime(std::chrono::steady_clock::time_point frameStart,
+                      uint64_t presentsBefore) const;
+
+        /**
+         * Feeds the frame's work time to the performance governor and hands
+         * a new quality level to the active scene.
+         */
+        void governFrame(std::chrono::steady_clock::duration work);
+
+        /**
+         * Sets up the performance governor from engine.governor. Its budget
+         * defaults to the frame pacer's period, so this runs after
+         * configureFramePacing.
+         */
+        void configureGovernor(GameConfig const &gameConfig);
+
+        /**
+         * Reads engine.background: what to do while the window is
+         * unfocused or hidden, and what happens to audio meanwhile.
+         */
+        void configureBackground(GameConfig const &gameConfig);
+
+        /**
+         * Applies the background policy and audio policy for the current
+         * window state, after a window event changed it.
+         */
+        void updateBackground();
+
+        /**
+         * Whether this frame should tick: always in the foreground, never
+         * when paused, and at the background frame rate when simulating.
+         */
+        bool isFrameDue();
+
+        /**
+         * Blocks until a window event arrives or the next background frame
+         * is due, so a game in the background costs next to no CPU.
+         */
+        void waitInBackground();
+
+        /**
+         * Reads engine.profiler: where traces go, the key that toggles a
+         * capture, and whether to capture from startup.
+         */
+        void configureProfiler(GameConfig const &gameConfig);
+
+        /**
+         * Starts a profiler capture, or stops the running one and writes it
+         * as a Chrome trace.
+         */
+        void toggleProfiler();
+
+        /**
+         * Reads engine.metrics: the file metrics windows are written to and
+         * how often a window closes. Without an interval, one window covers
+         * the whole run and is written at quit. Also reads
+         * engine.allocations.trackSites.
+         */
+        void configureMetrics(GameConfig const &gameConfig);
+
+        /**
+         * Closes the metrics window and writes it out, if there is a file.
+         */
+        void writeMetricsWindow();
+
+        /**
+         * Reports allocations per frame and, when asked for, the call sites
+         * that allocated most, logged at quit.
+         */
+        void reportAllocations() const;
+
+        /**
+         * Picks the frame pacing mode from engine.display: a software limit
+         * at targetFps if set, otherwise vsync, falling back to a software
+         * limit at the display's refresh rate when vsync was requested but
+         * the driver did not grant it.
+         */
+        void configureFramePacing(GameConfig const &gameConfig);
+
+        /**
+         * Opens the replay to play back from engine.replay.play, if set, and
+         * takes the engine seed from it; otherwise picks a fresh seed. Starts
+         * recording if engine.replay.record is set.
+         */
+        void configureReplay(GameConfig const &gameConfig);
+
+        /**
+         * Hands `action` to `scene`, recording it first when recording.
+         */
+        void dispatchAction(Scene &scene, Action &action);
+
+        /**
+         * Hash of the engine config and of every named config set.
+         */
+        std::vector<std::pair<std::string, uint64_t>> getConfigHashes() const;
+
+        /**
+         * Warns once about config sets that differ from the recording's.
+         */
+        void checkReplayConfig();
+
+        /**
+         * Writes the recording, if any, to engine.replay.record.
+         */
+        void saveRecording();
+
       public:
         /**
          * Constructs the GameEngine object and initializes all necessary
          * managers and resources.
          *
+         * With engine.headless set, no window is opened and no audio device
+         * is used: the VideoManager renders offscreen, the AudioManager is a
+         * null device, and the engine skips Render systems and frame pacing
+         * so scenes tick as fast as they can.
+         *
          * @throws std::runtime_error if the assets directory is not found.
          */
         explicit GameEngine(Path             assetsDir = Path{"assets"},
@@ -98,7 +319,13 @@ namespace YerbEngine {
         bool IsRunning() const;
 
         /**
-         * Loads a scene into the game engine.
+         * Whether the engine runs without a window or audio device.
+         */
+        bool isHeadless() const { return m_headless; }
+
+        /**
+         * Replaces the whole scene stack with `scene`, dropping every scene
+         * it held.
          *
          * @param sceneName The name of the scene to load
          * @param scene A shared pointer to the scene object to load
@@ -106,6 +333,63 @@ namespace YerbEngine {
         void LoadScene(std::string const            &sceneName,
                        std::shared_ptr<Scene> const &scene);
 
+        /**
+         * Suspends the active scene, keeping it in memory, and runs `scene`
+         * on top of it until it is popped.
+         */
+        void PushScene(std::string const            &sceneName,
+                       std::shared_ptr<Scene> const &scene);
+
+        /**
+         * Swaps the active scene for `scene`, leaving the scenes below it
+         * suspended.
+         */
+        void ReplaceScene(std::string const            &sceneName,
+                          std::shared_ptr<Scene> const &scene);
+
+        /**
+         * Drops the active scene and resumes the one below it.
+         *
+         * @throws std::runtime_error if there is no scene below it.
+         */
+        void PopScene();
+
+        size_t getSceneCount() const { return m_sceneStack.size(); }
+
+        /**
+         * The topmost scene on the stack named `sceneName`, or null.
+         */
+        std::shared_ptr<Scene> getScene(std::string const &sceneName) const;
+
+        /**
+         * Starts building a scene with `factory` on a background thread
+         * while the active scene keeps running, replacing any earlier
+         * preparation under the same name. Once it is built, its
+         * onPrepared() runs on the main thread at the start of a frame, so
+         * TakePreparedScene can hand it over without a hitch.
+         *
+         * A dedicated thread is used rather than the JobSystem: a thread
+         * waiting on the job system may pick up queued jobs, and picking up
+         * a whole scene construction would stall its frame. The web build
+         * has no threads, so there the scene is built before this returns.
+         */
+        void PrepareScene(std::string const                      &sceneName,
+                          std::function<std::shared_ptr<Scene>()> factory);
+
+        /**
+         * Whether a scene is being prepared, or is ready, under `sceneName`.
+         */
+        bool hasPreparedScene(std::string const &sceneName) const;
+
+        /**
+         * Hands over the scene prepared under `sceneName`, waiting for it
+         * if it is still being built.
+         *
+         * @returns the scene, or null if none was prepared under that name.
+         * @throws whatever the factory threw.
+         */
+        std::shared_ptr<Scene> TakePreparedScene(std::string const &sceneName);
+
         // Configuration accessors (preferred):
         ConfigStore   &GetConfigStore() const { return *m_configStore; }
         ConfigAdapter &GetConfig() const { return *m_configAdapter; }
@@ -158,6 +442,65 @@ namespace YerbEngine {
          */
         TextureManager &getTextureManager() const;
 
+        /**
+         * Retrieves the JobSystem shared by the engine's parallel systems.
+         * Its size comes from engine.threads.workers (0 = one thread per
+         * core).
+         *
+         * @throws std::runtime_error if JobSystem is not initialized.
+         * @returns A reference to the initialized JobSystem object.
+         */
+        JobSystem &getJobSystem() const;
+
+        /**
+         * Fixed simulation tick driving Scene::fixedUpdate, configured by
+         * engine.simulation.tickRate and engine.simulation.maxStepsPerFrame.
+         */
+        FixedTimestep const &getFixedTimestep() const {
+            return m_fixedTimestep;
+        }
+
+        /**
+         * Simulation time shared by every scene and system, with time
+         * scaling, pause and unthrottled modes. Initial settings come from
+         * engine.simulation.timeScale, engine.simulation.unthrottled and
+         * engine.simulation.unthrottledTicksPerFrame.
+         */
+        SimClock       &getSimClock() { return m_simClock; }
+        SimClock const &getSimClock() const { return m_simClock; }
+
+        /**
+         * Seed for a scene's random generator. Successive calls follow a
+         * sequence derived from the engine seed, which a replay restores, so
+         * scenes created in the same order draw the same numbers.
+         */
+        uint64_t nextRandomSeed() { return m_seedSequence(); }
+
+        /**
+         * Whether scene input comes from a replay instead of SDL events.
+         */
+        bool isReplaying() const { return m_replay != nullptr; }
+
+        /**
+         * Frame pacing for the native main loop, with pacing error stats.
+         * Skipped while the SimClock is unthrottled.
+         */
+        FramePacer &getFramePacer() { return m_framePacer; }
+
+        /**
+         * Time from SDL input events to the present that first shows them,
+         * per frame. Logged with percentiles on quit.
+         */
+        InputLatencyTracker const &getInputLatency() const {
+            return m_inputLatency;
+        }
+
+        /**
+         * Current quality level chosen by the performance governor; 0 is
+         * full quality.
+         */
+        PerformanceGovernor const &getGovernor() const { return m_governor; }
+
         /**
          * Called by the entry point to your application.
          */
@@ -165,7 +508,7 @@ namespace YerbEngine {
 
         /**
          * Quits the game engine by either stopping the main loop or canceling
-         * the emscripten main loop.
+         * the emscripten main loop. A recording in progress is saved first.
          */
         void quit();
     };
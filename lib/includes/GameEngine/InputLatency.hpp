@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace YerbEngine {
+
+    struct InputLatencyStats {
+        size_t frames = 0;   // presented frames that reflected new input
+        double lastMs = 0.0; // latency of the most recent such frame
+        double p50Ms  = 0.0; // percentiles over the last WINDOW frames
+        double p95Ms  = 0.0;
+        double p99Ms  = 0.0;
+        double maxMs  = 0.0; // since the last reset
+    };
+
+    /**
+     * Measures input-to-present latency: for each presented frame that
+     * reflects new input, the time from the oldest such input event to the
+     * present. Taking the oldest input gives the worst case a player felt
+     * in that frame.
+     *
+     * Samples go into a fixed ring of the last WINDOW frames, so recording
+     * never allocates; percentiles are computed over it on request.
+     */
+    class InputLatencyTracker {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr size_t WINDOW = 1024;
+
+      private:
+        std::array<float, WINDOW>        m_samplesMs{};
+        size_t                           m_next   = 0;
+        size_t                           m_frames = 0;
+        double                           m_lastMs = 0.0;
+        double                           m_maxMs  = 0.0;
+        std::optional<Clock::time_point> m_oldestPending;
+
+      public:
+        /**
+         * Notes an input event that happened at `eventTime` and has been
+         * handed to the scene.
+         */
+        void noteInput(Clock::time_point eventTime);
+
+        /**
+         * Notes a present at `presentTime`, recording one sample if any
+         * input was noted since the last present.
+         */
+        void notePresent(Clock::time_point presentTime);
+
+        bool hasPendingInput() const { return m_oldestPending.has_value(); }
+
+        InputLatencyStats getStats() const;
+        void              resetStats();
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <GameEngine/Action.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * What a replay needs to reproduce its recording: the seed scenes drew
+     * their random generators from, and a hash of each config set the
+     * recording ran with.
+     */
+    struct ReplayHeader {
+        uint64_t                                      seed = 0;
+        std::vector<std::pair<std::string, uint64_t>> configHashes;
+    };
+
+    /**
+     * Records, per rendered frame, the actions dispatched to the active scene
+     * and how many fixed ticks ran after them.
+     *
+     * Replaying frame by frame rather than tick by tick keeps everything that
+     * happens once per frame (scene changes, Render systems) lined up with
+     * the ticks around it, so with the same seed and config a replay steps
+     * the simulation exactly as the recording did.
+     *
+     * Frames are encoded into memory as they end and written out by save(),
+     * so recording does no file I/O mid-run. A frame without actions takes
+     * one byte; action names are written once and then referred to by
+     * index.
+     */
+    class InputRecorder {
+        std::vector<uint8_t> m_frames;
+        std::vector<uint8_t> m_pendingActions;
+        size_t               m_pendingCount = 0;
+        size_t               m_frameCount   = 0;
+        // File name index per ActionId, or SIZE_MAX if not written yet.
+        std::vector<size_t> m_nameIndices;
+        size_t              m_nameCount = 0;
+
+      public:
+        /**
+         * Adds `action` to the current frame.
+         */
+        void recordAction(Action const &action);
+
+        /**
+         * Closes the current frame, which ran `ticks` fixed ticks.
+         */
+        void endFrame(size_t ticks);
+
+        /**
+         * Writes `header` and every finished frame to `path`.
+         *
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void save(std::filesystem::path const &path,
+                  ReplayHeader const          &header) const;
+
+        size_t getFrameCount() const { return m_frameCount; }
+    };
+
+    /**
+     * Reads back a file written by InputRecorder, one frame at a time.
+     */
+    class InputReplay {
+        ReplayHeader             m_header;
+        std::vector<uint8_t>  m_data;
+        size_t                m_cursor = 0;
+        std::vector<ActionId> m_actionIds; // interned from the name table
+
+      public:
+        /**
+         * Loads the whole replay into memory.
+         *
+         * @throws std::runtime_error if the file is missing, is not a replay
+         * or was written by an incompatible version.
+         */
+        explicit InputReplay(std::filesystem::path const &path);
+
+        ReplayHeader const &getHeader() const { return m_header; }
+
+        /**
+         * Reads the next frame, replacing the contents of `actions` with its
+         * actions in the order they were recorded.
+         *
+         * @returns false once every frame has been read.
+         * @throws std::runtime_error if the frame data is truncated or
+         * corrupt.
+         */
+        bool nextFrame(size_t &ticks, std::vector<Action> &actions);
+
+        bool isFinished() const { return m_cursor >= m_data.size(); }
+    };
+
+} // namespace YerbEngine
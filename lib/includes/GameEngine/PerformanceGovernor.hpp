@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace YerbEngine {
+
+    struct GovernorSettings {
+        double budgetMs     = 0.0;  // frame work budget; 0 disables
+        size_t windowFrames = 60;   // frames averaged per decision
+        double degradeAbove = 1.05; // x budget: step down in quality
+        double recoverBelow = 0.7;  // x budget: step back up
+        size_t holdFrames   = 120;  // frames to wait after a transition
+        size_t maxLevel     = 0;    // deepest degradation level
+    };
+
+    struct GovernorTransition {
+        size_t from     = 0;
+        size_t to       = 0;
+        double meanMs   = 0.0; // over the window that triggered it
+        double maxMs    = 0.0;
+        double budgetMs = 0.0;
+        size_t frames   = 0; // frames recorded when it happened
+    };
+
+    /**
+     * Picks a quality level from recent frame times so a machine that
+     * cannot hold the frame budget degrades gracefully instead of slowing
+     * down.
+     *
+     * Level 0 is full quality; each level up is one step of degradation,
+     * whose meaning is left to the scenes. Frame times go into a ring of
+     * `windowFrames`. Once it is full and `holdFrames` have passed since
+     * the last transition, a mean above `degradeAbove` x budget moves one
+     * level down in quality and a mean below `recoverBelow` x budget moves
+     * one level back up. The gap between the two thresholds and the hold
+     * keep the level from flapping. The window restarts on every
+     * transition so the new level is judged on its own frames.
+     *
+     * Frame times should be work time, without waits for vsync or the
+     * frame limiter, or a paced frame would always look exactly on budget.
+     */
+    class PerformanceGovernor {
+        GovernorSettings    m_settings;
+        std::vector<double> m_frameMs; // ring of the last windowFrames
+        size_t              m_next        = 0;
+        size_t              m_filled      = 0;
+        double              m_sumMs       = 0.0;
+        size_t              m_level       = 0;
+        size_t              m_frames      = 0;
+        size_t              m_sinceChange = 0;
+        size_t              m_transitions = 0;
+
+        void clearWindow();
+
+      public:
+        PerformanceGovernor() = default;
+        explicit PerformanceGovernor(GovernorSettings const &settings);
+
+        /**
+         * Whether there is a budget and a level to step down to.
+         */
+        bool isEnabled() const {
+            return m_settings.budgetMs > 0.0 && m_settings.maxLevel > 0 &&
+                   !m_frameMs.empty();
+        }
+
+        /**
+         * Records one frame's work time, returning the transition it caused,
+         * if any.
+         */
+        std::optional<GovernorTransition> recordFrame(double frameMs);
+
+        size_t getLevel() const { return m_level; }
+        size_t getTransitionCount() const { return m_transitions; }
+
+        GovernorSettings const &getSettings() const { return m_settings; }
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <SDL.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace YerbEngine {
+
+    /**
+     * Simulation time, kept apart from wall-clock time.
+     *
+     * Each frame GameEngine passes the real frame duration through scale()
+     * before handing it to the fixed timestep, so a time scale of 0.5 runs
+     * half as many ticks per second and a paused clock runs none. The tick
+     * length itself never changes, so a slowed or sped-up run steps the
+     * simulation exactly as a normal one would.
+     *
+     * In unthrottled mode real time is ignored altogether: every frame runs
+     * a fixed batch of ticks back to back and frame pacing is skipped. This
+     * is how a long soak test or a simulation benchmark runs faster than
+     * real time.
+     *
+     * now() only moves when a tick runs. Gameplay code reads it, or scene
+     * time derived from it, instead of SDL_GetTicks64.
+     */
+    class SimClock {
+      public:
+        static constexpr size_t DEFAULT_UNTHROTTLED_TICKS = 600;
+
+      private:
+        double   m_timeScale        = 1.0;
+        bool     m_paused           = false;
+        bool     m_unthrottled      = false;
+        size_t   m_unthrottledTicks = DEFAULT_UNTHROTTLED_TICKS;
+        double   m_nowMs            = 0.0;
+        uint64_t m_ticks            = 0;
+
+      public:
+        /**
+         * Simulated seconds that `realSeconds` of wall-clock time stands
+         * for: 0 while paused or unthrottled, otherwise the real time times
+         * the time scale.
+         */
+        double scale(double realSeconds) const;
+
+        /**
+         * Ticks to run this frame in unthrottled mode, 0 otherwise or while
+         * paused.
+         */
+        size_t getUnthrottledTicks() const;
+
+        /**
+         * Records one simulation tick of `tickSeconds`.
+         */
+        void tick(double tickSeconds);
+
+        /**
+         * Sets how fast simulated time passes relative to real time.
+         * Negative or non-finite scales are rejected with a warning.
+         *
+         * Frames still run at most engine.simulation.maxStepsPerFrame
+         * ticks, so a scale that needs more ticks per frame than that is
+         * capped; unthrottled mode has no such cap.
+         */
+        void   setTimeScale(double timeScale);
+        double getTimeScale() const { return m_timeScale; }
+
+        void setPaused(bool const paused) { m_paused = paused; }
+        bool isPaused() const { return m_paused; }
+
+        /**
+         * Switches unthrottled mode, running `ticksPerFrame` ticks each
+         * frame while it is on.
+         */
+        void setUnthrottled(bool   unthrottled,
+                            size_t ticksPerFrame = DEFAULT_UNTHROTTLED_TICKS);
+        bool isUnthrottled() const { return m_unthrottled; }
+
+        /**
+         * Simulated milliseconds since the engine started, rounded so that
+         * ticks of a fractional length do not drift below whole values.
+         */
+        Uint64 now() const {
+            return static_cast<Uint64>(std::llround(m_nowMs));
+        }
+        double nowMs() const { return m_nowMs; }
+
+        /**
+         * Simulation ticks run since the engine started.
+         */
+        uint64_t getTickCount() const { return m_ticks; }
+    };
+
+} // namespace YerbEngine
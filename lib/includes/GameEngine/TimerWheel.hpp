@@ -0,0 +1,244 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * Hierarchical timing wheel with millisecond ticks.
+     *
+     * Four levels of 64 slots cover about 4.6 hours ahead of now(); later
+     * deadlines wait in an overflow list. A timer sits in the slot of the
+     * lowest level whose span still contains its deadline, and drops a
+     * level each time the level above wraps, so scheduling and cancelling
+     * are O(1). Advancing visits one slot per elapsed tick while the lowest
+     * level holds timers and skips ahead to the next wrap while it is
+     * empty, plus the timers that actually fire. Timers far in the future
+     * are not touched until they get close.
+     *
+     * Nodes live in one vector and are recycled, so a steady number of
+     * timers stops allocating. Not thread safe.
+     */
+    template <typename Payload> class TimerWheel {
+      public:
+        using TimerId = uint64_t;
+
+        static constexpr TimerId INVALID_TIMER = 0;
+
+      private:
+        static constexpr size_t   SLOT_BITS = 6;
+        static constexpr size_t   SLOTS     = size_t{1} << SLOT_BITS;
+        static constexpr size_t   LEVELS    = 4;
+        static constexpr size_t   DUE       = LEVELS * SLOTS;
+        static constexpr size_t   OVERFLOW  = DUE + 1;
+        static constexpr size_t   LISTS     = OVERFLOW + 1;
+        static constexpr uint32_t NIL       = UINT32_MAX;
+        static constexpr uint32_t UNLINKED  = UINT32_MAX;
+
+        struct Node {
+            uint64_t deadline   = 0;
+            Payload  payload    = {};
+            uint32_t previous   = NIL;
+            uint32_t next       = NIL;
+            uint32_t generation = 1;
+            uint32_t list       = UNLINKED;
+        };
+
+        std::vector<Node>           m_nodes;
+        std::vector<uint32_t>       m_freeNodes;
+        std::array<uint32_t, LISTS> m_heads;
+        // Timers per level, with the overflow list counted as level LEVELS.
+        std::array<size_t, LEVELS + 1> m_levelSizes{};
+        uint64_t                    m_now  = 0;
+        size_t                      m_size = 0;
+
+        size_t listFor(uint64_t const deadline) const {
+            if (deadline <= m_now) {
+                return DUE;
+            }
+            for (size_t level = 0; level < LEVELS; ++level) {
+                size_t const shift = SLOT_BITS * (level + 1);
+                if ((deadline >> shift) == (m_now >> shift)) {
+                    size_t const slot =
+                        (deadline >> (SLOT_BITS * level)) & (SLOTS - 1);
+                    return level * SLOTS + slot;
+                }
+            }
+            return OVERFLOW;
+        }
+
+        static size_t levelOf(size_t const list) {
+            return list == OVERFLOW ? LEVELS : list / SLOTS;
+        }
+
+        void link(uint32_t const index) {
+            Node        &node = m_nodes[index];
+            size_t const list = listFor(node.deadline);
+            node.list         = static_cast<uint32_t>(list);
+            if (list != DUE) {
+                m_levelSizes[levelOf(list)] += 1;
+            }
+            node.previous     = NIL;
+            node.next         = m_heads[list];
+            if (node.next != NIL) {
+                m_nodes[node.next].previous = index;
+            }
+            m_heads[list] = index;
+        }
+
+        void unlink(uint32_t const index) {
+            Node &node = m_nodes[index];
+            if (node.previous != NIL) {
+                m_nodes[node.previous].next = node.next;
+            } else {
+                m_heads[node.list] = node.next;
+            }
+            if (node.next != NIL) {
+                m_nodes[node.next].previous = node.previous;
+            }
+            if (node.list != DUE) {
+                m_levelSizes[levelOf(node.list)] -= 1;
+            }
+            node.list = UNLINKED;
+        }
+
+        void release(uint32_t const index) {
+            Node &node = m_nodes[index];
+
+            node.payload = Payload{};
+            node.generation += 1;
+            if (node.generation == 0) {
+                node.generation = 1; // 0 would make INVALID_TIMER valid
+            }
+            m_freeNodes.push_back(index);
+            m_size -= 1;
+        }
+
+        // Moves every timer in `list` to where its deadline now belongs.
+        void cascade(size_t const list) {
+            uint32_t index = std::exchange(m_heads[list], NIL);
+            while (index != NIL) {
+                uint32_t const next = m_nodes[index].next;
+                m_levelSizes[levelOf(list)] -= 1;
+                link(index);
+                index = next;
+            }
+        }
+
+        template <typename Callback>
+        void fire(size_t const list, Callback &onExpired) {
+            // Pop one at a time so callbacks may schedule or cancel freely.
+            while (m_heads[list] != NIL) {
+                uint32_t const index = m_heads[list];
+                unlink(index);
+                Payload payload = std::move(m_nodes[index].payload);
+                release(index);
+                onExpired(std::move(payload));
+            }
+        }
+
+      public:
+        explicit TimerWheel(uint64_t const now = 0) : m_now(now) {
+            m_heads.fill(NIL);
+        }
+
+        /**
+         * Schedules `payload` to be handed back by advance() once now()
+         * reaches `deadline`. A deadline at or before now() fires on the
+         * next advance, even if the clock does not move.
+         */
+        TimerId schedule(uint64_t const deadline, Payload payload) {
+            uint32_t index;
+            if (!m_freeNodes.empty()) {
+                index = m_freeNodes.back();
+                m_freeNodes.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.emplace_back();
+            }
+
+            Node &node    = m_nodes[index];
+            node.deadline = deadline;
+            node.payload  = std::move(payload);
+            link(index);
+            m_size += 1;
+
+            return (static_cast<uint64_t>(node.generation) << 32) | index;
+        }
+
+        /**
+         * @returns false if the timer already fired or was cancelled.
+         */
+        bool cancel(TimerId const id) {
+            auto const index = static_cast<uint32_t>(id & UINT32_MAX);
+            if (id == INVALID_TIMER || index >= m_nodes.size()) {
+                return false;
+            }
+            Node &node = m_nodes[index];
+            if (node.generation != (id >> 32) || node.list == UNLINKED) {
+                return false;
+            }
+            unlink(index);
+            release(index);
+            return true;
+        }
+
+        /**
+         * Moves the clock to `now` and calls onExpired(payload) for every
+         * timer that came due, in deadline order. Timers sharing a deadline
+         * fire in no particular order.
+         */
+        template <typename Callback>
+        void advance(uint64_t const now, Callback &&onExpired) {
+            fire(DUE, onExpired);
+
+            while (m_now < now) {
+                if (m_size == 0) {
+                    m_now = now;
+                    break;
+                }
+
+                // With the lower levels empty nothing can fire before the
+                // lowest occupied level wraps, so jump to just before it.
+                size_t occupied = 0;
+                while (m_levelSizes[occupied] == 0) {
+                    occupied += 1;
+                }
+                if (occupied > 0) {
+                    uint64_t const span = uint64_t{1} << (SLOT_BITS * occupied);
+                    uint64_t const wrap = (m_now | (span - 1)) + 1;
+                    if (wrap > now) {
+                        m_now = now;
+                        break;
+                    }
+                    m_now = wrap - 1;
+                }
+
+                m_now += 1;
+                if ((m_now & ((uint64_t{1} << (SLOT_BITS * LEVELS)) - 1)) ==
+                    0) {
+                    cascade(OVERFLOW);
+                }
+                for (size_t level = LEVELS - 1; level > 0; --level) {
+                    size_t const shift = SLOT_BITS * level;
+                    if ((m_now & ((uint64_t{1} << shift) - 1)) == 0) {
+                        cascade(level * SLOTS +
+                                ((m_now >> shift) & (SLOTS - 1)));
+                    }
+                }
+
+                fire(m_now & (SLOTS - 1), onExpired);
+                fire(DUE, onExpired);
+            }
+        }
+
+        uint64_t now() const { return m_now; }
+        size_t   size() const { return m_size; }
+        bool     empty() const { return m_size == 0; }
+    };
+
+} // namespace YerbEngine
@@ -1,26 +1,39 @@
 #pragma once
+#include <Coroutines/Task.hpp>
 #include <GameEngine/Action.hpp>
+#include <GameEngine/ActionMap.hpp>
 #include <GameEngine/GameEngine.hpp>
-#include <map>
-#include <string>
+#include <GameScenes/SystemPipeline.hpp>
+#include <cstddef>
+#include <span>
+#include <string_view>
 
 namespace YerbEngine {
 
-    typedef std::map<int, std::string> ActionMap;
-
     class Scene {
       protected:
-        GameEngine *m_gameEngine;
-        Uint64      m_lastFrameTime  = 0;
-        float       m_deltaTime      = 0;
-        bool        m_endTriggered   = false;
-        bool        m_hasEnded       = false;
-        bool        m_paused         = false;
-        Uint64      m_SceneStartTime = 0;
-        ActionMap   m_actionMap;
+        GameEngine    *m_gameEngine;
+        Uint64         m_lastFrameTime  = 0;
+        float          m_deltaTime      = 0;
+        bool           m_endTriggered   = false;
+        bool           m_hasEnded       = false;
+        bool           m_paused         = false;
+        bool           m_prepared       = false;
+        size_t         m_qualityLevel   = 0;
+        Uint64         m_SceneStartTime = 0;
+        ActionMap      m_actionMap;
+        SystemPipeline m_systems;
+        TaskScheduler  m_tasks;
+
+        // Fraction of a tick between the last two fixed ticks to render at.
+        float m_interpolationAlpha = 0;
 
       public:
-        explicit Scene(GameEngine *gameEngine) : m_gameEngine(gameEngine) {}
+        explicit Scene(GameEngine *gameEngine) : m_gameEngine(gameEngine) {
+            if (m_gameEngine != nullptr) {
+                m_systems.setJobSystem(&m_gameEngine->getJobSystem());
+            }
+        }
 
         virtual ~Scene()                       = default;
         virtual void update()                  = 0;
@@ -31,9 +44,130 @@ namespace YerbEngine {
 
         virtual void onSceneWindowResize() = 0;
 
-        void registerAction(int const          inputKey,
-                            std::string const &actionName) {
-            m_actionMap[inputKey] = actionName;
+        /**
+         * Runs once on the main thread, after the constructor and before the
+         * scene is first shown. A scene handed to GameEngine::PrepareScene
+         * is constructed on a background thread, so anything that needs the
+         * renderer or other main-thread state, such as registering textures,
+         * belongs here instead.
+         */
+        virtual void onPrepared() {}
+
+        /**
+         * Called when another scene is pushed on top of this one. The scene
+         * stays in memory but stops ticking, rendering and receiving input.
+         */
+        virtual void onSuspend() {}
+
+        /**
+         * Called when the scene on top of this one is popped and this one is
+         * active again.
+         */
+        virtual void onResume() {}
+
+        /**
+         * Called when the engine's performance governor moves to another
+         * quality level, and on activation if the level changed while the
+         * scene was elsewhere. Level 0 is full quality; higher levels ask
+         * the scene to shed more work.
+         */
+        virtual void onQualityLevelChanged(size_t /*level*/) {}
+
+        /**
+         * Sets the quality level, calling onQualityLevelChanged() if it
+         * differs from the current one.
+         */
+        void setQualityLevel(size_t const level) {
+            if (level != m_qualityLevel) {
+                m_qualityLevel = level;
+                onQualityLevelChanged(level);
+            }
+        }
+
+        size_t getQualityLevel() const { return m_qualityLevel; }
+
+        /**
+         * Called when the scene becomes the active one, to publish its
+         * metrics into `metrics` from then on. By default only the scene's
+         * systems are timed into it; scenes that own an EntityManager
+         * override this to publish its counts too. Scenes the engine never
+         * activates, such as SceneBatch worlds, publish nothing.
+         */
+        virtual void publishMetrics(MetricsRegistry &metrics) {
+            m_systems.setMetrics(&metrics);
+        }
+
+        /**
+         * Runs onPrepared() unless it already ran.
+         */
+        void completePreparation() {
+            if (!m_prepared) {
+                m_prepared = true;
+                onPrepared();
+            }
+        }
+
+        /**
+         * Advances the simulation by one fixed tick of `tickSeconds`.
+         *
+         * The engine calls this zero or more times per frame, before
+         * update(), at the rate set by engine.simulation.tickRate. By default
+         * it advances the scene's tasks by one tick, then runs one Simulate
+         * and one Post pass of the scene's systems.
+         */
+        virtual void fixedUpdate(float const tickSeconds) {
+            m_tasks.update(static_cast<double>(tickSeconds) * 1000.0);
+            m_systems.run(SystemPhase::Simulate);
+            m_systems.run(SystemPhase::Post);
+        }
+
+        /**
+         * Floats observe() writes per call. SceneBatch lays every world's
+         * observation out back to back at this stride; 0 means the scene
+         * cannot be observed.
+         */
+        virtual size_t getObservationSize() const { return 0; }
+
+        /**
+         * Writes the scene's current state into `out`, which holds exactly
+         * getObservationSize() floats.
+         */
+        virtual void observe(std::span<float> /*out*/) const {}
+
+        /**
+         * Floats applyControls() reads per call; 0 means the scene takes no
+         * controls.
+         */
+        virtual size_t getControlSize() const { return 0; }
+
+        /**
+         * Drives the scene from `controls`, which holds exactly
+         * getControlSize() floats, in place of device input.
+         */
+        virtual void applyControls(std::span<float const> /*controls*/) {}
+
+        bool isEndTriggered() const { return m_endTriggered; }
+
+        SystemPipeline       &getSystems() { return m_systems; }
+        SystemPipeline const &getSystems() const { return m_systems; }
+
+        TaskScheduler       &getTasks() { return m_tasks; }
+        TaskScheduler const &getTasks() const { return m_tasks; }
+
+        /**
+         * Binds `inputKey` to the action named `actionName`, interning the
+         * name.
+         *
+         * @returns the action's id, which sDoAction sees.
+         */
+        ActionId registerAction(int const              inputKey,
+                                std::string_view const actionName) {
+            ActionId const action = ActionNames::intern(actionName);
+            m_actionMap.bind(inputKey, action);
+            return action;
+        }
+        void registerAction(int const inputKey, ActionId const action) {
+            m_actionMap.bind(inputKey, action);
         }
         void             setPaused(bool const paused) { m_paused = paused; }
         ActionMap const &getActionMap() const { return m_actionMap; }
@@ -41,6 +175,11 @@ namespace YerbEngine {
             m_SceneStartTime = startTime;
         }
         Uint64 const &getStartTime() const { return m_SceneStartTime; }
+
+        void setInterpolationAlpha(float const alpha) {
+            m_interpolationAlpha = alpha;
+        }
+        float getInterpolationAlpha() const { return m_interpolationAlpha; }
     };
 
 } // namespace YerbEngine
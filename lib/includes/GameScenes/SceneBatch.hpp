@@ -0,0 +1,110 @@
+#pragma once
+
+#include <GameScenes/Scene.hpp>
+#include <Threading/JobSystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * Builds world `index` of a batch. `seed` is the only source of
+     * randomness the world may use, so the same seed always plays out the
+     * same way.
+     */
+    using SceneFactory =
+        std::function<std::shared_ptr<Scene>(size_t index, uint64_t seed)>;
+
+    /**
+     * Many independent copies of a scene, stepped together.
+     *
+     * Each world is its own Scene with its own entities, random generator
+     * and task clock, and nothing it does during a tick may touch another
+     * world, so step() runs them in parallel across the job system. Only
+     * fixed ticks run: worlds are never rendered, never receive device
+     * input and never call update(), so a world that ends just stays
+     * ended until it is reset.
+     *
+     * Controls and observations are flat float arrays holding one block
+     * per world, in world order, at the stride the scene reports.
+     */
+    class SceneBatch {
+        JobSystem                          &m_jobSystem;
+        SceneFactory                        m_factory;
+        uint64_t                            m_seed;
+        std::vector<std::shared_ptr<Scene>> m_worlds;
+        std::vector<uint64_t>               m_episodes;
+        std::vector<uint8_t>                m_done;
+        size_t                              m_observationSize = 0;
+        size_t                              m_controlSize     = 0;
+
+        uint64_t worldSeed(size_t index) const;
+        void     build(size_t index);
+
+      public:
+        /**
+         * Builds `count` worlds through `factory` on the calling thread.
+         *
+         * @throws std::runtime_error if the factory returns no scene, or
+         * scenes that disagree on their observation or control size.
+         */
+        SceneBatch(JobSystem   &jobSystem,
+                   size_t       count,
+                   uint64_t     seed,
+                   SceneFactory factory);
+
+        size_t size() const { return m_worlds.size(); }
+        size_t getObservationSize() const { return m_observationSize; }
+        size_t getControlSize() const { return m_controlSize; }
+
+        /**
+         * Rebuilds every world with a fresh seed.
+         */
+        void reset();
+
+        /**
+         * Rebuilds world `index` with a fresh seed.
+         */
+        void reset(size_t index);
+
+        /**
+         * Rebuilds every world that has ended.
+         *
+         * @returns how many were rebuilt.
+         */
+        size_t resetDone();
+
+        /**
+         * Applies each world's block of `controls`, then advances every
+         * world that has not ended by up to `ticks` fixed ticks of
+         * `tickSeconds`, in parallel.
+         *
+         * @throws std::runtime_error if `controls` does not hold exactly
+         * size() * getControlSize() floats.
+         */
+        void step(std::span<float const> controls,
+                  float                  tickSeconds,
+                  size_t                 ticks = 1);
+
+        /**
+         * Writes every world's observation into `out`, in parallel.
+         *
+         * @throws std::runtime_error if `out` does not hold exactly
+         * size() * getObservationSize() floats.
+         */
+        void observe(std::span<float> out) const;
+
+        /**
+         * One flag per world, set once the world has ended.
+         */
+        std::span<uint8_t const> getDone() const { return m_done; }
+
+        Scene       &getWorld(size_t index) { return *m_worlds[index]; }
+        Scene const &getWorld(size_t index) const { return *m_worlds[index]; }
+    };
+
+} // namespace YerbEngine
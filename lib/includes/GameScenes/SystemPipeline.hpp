@@ -0,0 +1,198 @@
+#pragma once
+
+#include <EntityManagement/ComponentAccess.hpp>
+#include <Profiling/Metrics.hpp>
+#include <SDL.h>
+#include <Threading/JobSystem.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * When a system runs within a frame:
+     *  - Input runs once per frame, after events are dispatched,
+     *  - Simulate and Post run once per fixed tick, Post after Simulate,
+     *  - Render runs once per frame, after all ticks and before
+     *    Scene::update().
+     */
+    enum class SystemPhase : Uint8 { Input, Simulate, Post, Render };
+
+    struct SystemStats {
+        Uint64 runs             = 0;
+        double lastMs           = 0.0;
+        double totalMs          = 0.0;
+        double maxMs            = 0.0;
+        Uint64 accessViolations = 0; // undeclared component accesses
+        Uint64 allocations      = 0; // on the thread that ran the system
+
+        double averageMs() const {
+            return runs == 0 ? 0.0 : totalMs / static_cast<double>(runs);
+        }
+    };
+
+    struct System {
+        std::string           name;
+        SystemPhase           phase;
+        std::function<void()> run;
+        SystemAccess          access;
+        bool                  enabled     = true;
+        Uint32                interval    = 1; // runs every `interval` passes
+        Uint32                wave        = 0; // position in the phase's DAG
+        SystemStats           stats;
+        char const           *zoneName    = nullptr; // interned profiler zone
+        Histogram            *timeUs      = nullptr; // "system.<name>" metric
+        Counter              *allocations = nullptr; // ".allocations" metric
+
+        std::vector<std::type_index> reportedViolations;
+    };
+
+    /**
+     * Ordered list of a scene's systems.
+     *
+     * Systems run grouped by phase and, within a phase, in the order they
+     * were added. Each call to run(phase) is one pass of that phase; a
+     * system with an interval of N runs on every Nth pass, starting with
+     * the first. Every run is timed into the system's stats and is a
+     * profiler zone named after the system. Allocations made on the thread
+     * running a system are counted into its stats; work the system hands
+     * to other threads is not, and neither is work of other systems that
+     * the thread picks up while the system waits on the job system; that
+     * is left out of its time as well. Once setMetrics() names a registry,
+     * each run is also recorded there as the "system.<name>" histogram and
+     * "system.<name>.allocations" counter.
+     *
+     * Systems are looked up by name, so the engine or tools can disable,
+     * throttle or inspect them without knowing the scene's type.
+     *
+     * Systems that declare their SystemAccess can run concurrently. Within
+     * a phase, each system depends on every earlier system it conflicts
+     * with; the resulting DAG is split into waves, where a system's wave is
+     * one past the latest wave it depends on. Systems in the same wave never
+     * conflict and run together on the job system; waves run in order.
+     * Systems without a declaration conflict with everything, so they run
+     * alone and keep their place in the order. The waves are computed on
+     * the first pass after a system is added and cached until the next
+     * addition.
+     *
+     * With access checks on (the default in builds with
+     * YERB_CHECK_SYSTEM_ACCESS), Entity component lookups made by a
+     * declared system are checked against its declaration, and each
+     * undeclared type is logged once and counted in its stats. The check
+     * sees which types are touched, not whether a returned component is
+     * modified, so writing through a component declared read-only goes
+     * unnoticed.
+     */
+    class SystemPipeline {
+        static constexpr size_t PHASE_COUNT = 4;
+
+        std::vector<System>             m_systems; // sorted by phase
+        std::array<Uint64, PHASE_COUNT> m_passes{};
+        std::array<Uint32, PHASE_COUNT> m_waveCounts{};
+        bool                            m_scheduleDirty = true;
+        bool                            m_accessChecks  = true;
+        JobSystem                      *m_jobSystem    = nullptr;
+        MetricsRegistry                *m_metrics      = nullptr;
+        std::vector<size_t>             m_dueSystems; // scratch
+
+        System       &get(std::string const &name);
+        System const &get(std::string const &name) const;
+
+        void buildSchedule();
+        void runSystem(System &system) const;
+
+      public:
+        SystemPipeline() = default;
+
+        SystemPipeline(SystemPipeline const &)            = delete;
+        SystemPipeline &operator=(SystemPipeline const &) = delete;
+
+        /**
+         * Adds a system at the end of its phase, with undeclared access.
+         *
+         * @throws std::runtime_error if a system with the same name exists
+         * or the interval is 0.
+         */
+        SystemPipeline &add(std::string           name,
+                            SystemPhase           phase,
+                            std::function<void()> run,
+                            Uint32                interval = 1);
+
+        /**
+         * Adds a system at the end of its phase that only touches what
+         * `access` declares.
+         *
+         * @throws std::runtime_error if a system with the same name exists
+         * or the interval is 0.
+         */
+        SystemPipeline &add(std::string           name,
+                            SystemPhase           phase,
+                            SystemAccess          access,
+                            std::function<void()> run,
+                            Uint32                interval = 1);
+
+        /**
+         * Runs independent systems on `jobSystem`, or everything on the
+         * calling thread if it is null. The pool must outlive the pipeline.
+         */
+        void setJobSystem(JobSystem *jobSystem) {
+            m_jobSystem = jobSystem;
+        }
+
+        /**
+         * Records system timings into `metrics`, or only into the systems'
+         * stats if it is null, the default. The engine points the active
+         * scene's pipeline at the global registry, so pipelines it does
+         * not run, e.g. SceneBatch worlds, stay out of it. The registry
+         * must outlive the pipeline.
+         */
+        void setMetrics(MetricsRegistry *metrics);
+
+        /**
+         * Turns undeclared-access checks on or off. Has no effect in
+         * builds without YERB_CHECK_SYSTEM_ACCESS.
+         */
+        void setAccessChecks(bool const enabled) { m_accessChecks = enabled; }
+
+        /**
+         * Runs one pass of `phase`.
+         */
+        void run(SystemPhase phase);
+
+        bool contains(std::string const &name) const;
+
+        /**
+         * @throws std::runtime_error if no system is named `name`.
+         */
+        void setEnabled(std::string const &name,
+                        bool               enabled);
+        bool isEnabled(std::string const &name) const;
+
+        /**
+         * @throws std::runtime_error if no system is named `name` or the
+         * interval is 0.
+         */
+        void setInterval(std::string const &name,
+                         Uint32             interval);
+
+        /**
+         * Wave the system runs in within its phase; systems sharing a wave
+         * may run concurrently.
+         *
+         * @throws std::runtime_error if no system is named `name`.
+         */
+        Uint32 getWave(std::string const &name);
+        Uint32 getWaveCount(SystemPhase phase);
+
+        SystemStats const &getStats(std::string const &name) const;
+        void               resetStats();
+
+        std::vector<System> const &getSystems() const { return m_systems; }
+    };
+
+} // namespace YerbEngine
@@ -4,6 +4,7 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <iostream>
+#include <string>
 
 namespace YerbEngine {
 
@@ -13,6 +14,40 @@ namespace YerbEngine {
                               std::string const &text,
                               SDL_Color const   &color,
                               Vec2 const        &position);
+
+        /**
+         * A line of text kept as a texture, so drawing it every frame costs
+         * a copy, and the font is only rasterised again when the text,
+         * colour or font changes.
+         */
+        class CachedText {
+            SDL_Texture *m_texture = nullptr;
+            TTF_Font    *m_font    = nullptr;
+            std::string  m_text;
+            SDL_Color    m_color = {.r = 0, .g = 0, .b = 0, .a = 0};
+            int          m_width  = 0;
+            int          m_height = 0;
+
+            void release();
+
+          public:
+            CachedText() = default;
+            ~CachedText();
+            CachedText(CachedText const &)            = delete;
+            CachedText &operator=(CachedText const &) = delete;
+
+            /**
+             * Sets the text to draw, rendering a new texture only if it
+             * changed. Empty text draws nothing.
+             */
+            void set(SDL_Renderer      *renderer,
+                     TTF_Font          *font,
+                     std::string const &text,
+                     SDL_Color const   &color);
+
+            void draw(SDL_Renderer *renderer,
+                      Vec2 const   &position) const;
+        };
     } // namespace TextHelpers
 
 } // namespace YerbEngine
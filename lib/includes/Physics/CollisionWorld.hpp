@@ -0,0 +1,369 @@
+#pragma once
+
+#include <EntityManagement/Entity.hpp>
+#include <EntityManagement/EntityManager.hpp>
+#include <Physics/SpatialGrid.hpp>
+#include <Threading/FunctionRef.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace YerbEngine {
+
+    /**
+     * `swept` marks a pair found only by sweeping a fast mover: the two
+     * boxes crossed during the tick but no longer overlap, so responses
+     * must not re-check the overlap.
+     */
+    struct ContactPair {
+        std::shared_ptr<Entity> entityA;
+        std::shared_ptr<Entity> entityB;
+        bool                    swept = false;
+    };
+
+    enum class ContactEventType : Uint8 { Begin, Stay, End };
+
+    struct ContactEvent {
+        ContactEventType        type;
+        std::shared_ptr<Entity> entityA;
+        std::shared_ptr<Entity> entityB;
+        bool                    swept = false;
+    };
+
+    /**
+     * Filter for spatial queries. `tags` holds one bit per EntityTags value
+     * (see tagBit) and `layers` is matched against CCollider::layers.
+     * Entities without a collider are on CCollider::DEFAULT_LAYER.
+     */
+    struct QueryFilter {
+        Uint32 tags   = ~0u;
+        Uint32 layers = ~0u;
+
+        static constexpr Uint32 tagBit(EntityTags const tag) {
+            return 1u << static_cast<Uint32>(tag);
+        }
+
+        static constexpr QueryFilter
+        withTags(std::initializer_list<EntityTags> const tags) {
+            QueryFilter filter{.tags = 0};
+            for (EntityTags const tag : tags) {
+                filter.tags |= tagBit(tag);
+            }
+            return filter;
+        }
+
+        bool accepts(Entity const &entity) const;
+    };
+
+    /**
+     * Broadphase for entities with a transform and a shape.
+     *
+     * Bodies are split into three sets, each with its own grid:
+     *  - static bodies (CCollider::bodyType == Static) are gathered once and
+     *    only rebuilt when a static body is added or destroyed,
+     *  - sleeping bodies keep their grid entries untouched until woken,
+     *  - awake bodies are rebuilt every update.
+     *
+     * Pairs are only generated for awake-awake, awake-static and
+     * awake-sleeping combinations, so static-static and sleeping-sleeping
+     * pairs never reach the narrowphase. A sleeping body that touches an
+     * awake body is woken up.
+     *
+     * Contacts persist across updates in a cache keyed by the entity id
+     * pair. Each update merges the new pairs against last update's cache
+     * and emits one Begin, Stay or End event per contact. Contacts between
+     * two bodies that are both asleep or static are kept as Stay until one
+     * of them wakes or is destroyed.
+     *
+     * Fast movers (CCollider::fastMover) are swept from their previous
+     * position to their current one. While there are any, every moving
+     * awake body goes into the awake grid with the box covering its whole
+     * move, so a fast mover finds bodies that crossed its path during the
+     * tick as well as ones that ended up on it. A swept AABB test, against
+     * the relative displacement for awake bodies, finds the earliest time
+     * of impact. On a hit the body is moved back to just inside the first
+     * thing it touched and the pair is reported, even if that body has
+     * since moved on, instead of tunnelling through thin walls or small
+     * enemies. Only bodies accepted by the mover's CCollider::sweepTags
+     * and CCollider::sweepLayers stop it; it passes through the rest.
+     *
+     * Spatial queries run against the grids from the last update and append
+     * to caller-provided lists, so they only touch nearby cells and do not
+     * allocate once the caller's buffer has grown.
+     *
+     * With a job system attached, pair generation runs in fixed-size tasks
+     * (cell ranges, then body ranges) whose outputs are merged in task
+     * order, and resolveContacts() colours contacts so that no two in the
+     * same batch share a dynamic body. Batches run one after another and
+     * the contacts inside a batch in parallel. Task sizes and colouring do
+     * not depend on the thread count, so results are identical with any
+     * number of threads.
+     */
+    class CollisionWorld {
+        enum class BodyState : Uint8 { None, Awake, Sleeping, Static };
+
+        struct BodySlot {
+            size_t    id              = 0; // entity id
+            BodyState state           = BodyState::None;
+            Uint32    idleTicks       = 0;
+            bool      hasLastPosition = false;
+            Vec2      lastPosition{0, 0};
+            Uint64    usedColors = 0; // colours taken by this body's contacts
+        };
+
+        float  m_cellSize;
+        Uint32 m_sleepAfterTicks;
+        Vec2   m_bounds{0, 0};
+        size_t m_updateCount = 0;
+
+        // One slot per live entity, sorted by entity id and rebuilt from
+        // the entity list every update, so it never outgrows the scene.
+        std::vector<BodySlot> m_slots;
+        std::vector<BodySlot> m_nextSlots;
+
+        EntityList        m_staticBodies;
+        std::vector<AABB> m_staticBoxes;
+        SpatialGrid       m_staticGrid;
+        bool              m_staticDirty = false;
+
+        EntityList        m_sleepingBodies;
+        std::vector<AABB> m_sleepingBoxes;
+        SpatialGrid       m_sleepingGrid;
+        bool              m_sleepingDirty = false;
+
+        EntityList        m_awakeBodies;
+        std::vector<AABB> m_awakeBoxes;
+        std::vector<Vec2> m_awakeDisplacements; // movement since last update
+        SpatialGrid       m_awakeGrid;
+        bool              m_awakeDirty = false;
+
+        // Which set a swept fast mover hit, and the index of the body in it.
+        enum class BodySet : Uint8 { Static, Sleeping, Awake };
+
+        struct SweptHit {
+            uint32_t mover; // index into m_awakeBodies
+            BodySet  set;
+            uint32_t target;
+        };
+
+        std::vector<uint32_t> m_fastMovers; // indices into m_awakeBodies
+        std::vector<AABB>     m_sweptBoxes; // awake boxes over their move
+        std::vector<SweptHit> m_sweptHits;
+
+        struct CachedContact {
+            Uint64      key;
+            ContactPair pair;
+        };
+
+        struct PairTaskOutput {
+            std::vector<ContactPair> pairs;
+            std::vector<size_t>      wakes;
+            size_t                   tested = 0; // candidate pairs checked
+        };
+
+        JobSystem *m_jobSystem = nullptr;
+
+        std::vector<ContactPair>    m_pairs;
+        std::vector<PairTaskOutput> m_pairTasks;
+        std::vector<size_t>         m_pendingWakes;
+        size_t                      m_pairsTested = 0;
+
+        // Contact event indices grouped by colour; batch b is
+        // m_batchContacts[m_batchStart[b] .. m_batchStart[b + 1]).
+        std::vector<uint32_t> m_batchContacts;
+        std::vector<uint32_t> m_batchStart;
+        std::vector<uint32_t> m_contactColors;
+        bool                  m_hasOverflowBatch = false;
+
+        std::vector<CachedContact> m_contactCache;    // sorted by key
+        std::vector<CachedContact> m_currentContacts; // this update, sorted
+        std::vector<CachedContact> m_nextContacts;
+        std::vector<ContactEvent>  m_contactEvents;
+
+        BodySlot       *findSlot(size_t id);
+        BodySlot const *findSlot(size_t id) const;
+        void      removeDeadBodies(EntityList        &bodies,
+                                   std::vector<AABB> &boxes,
+                                   bool              &dirty);
+        void      moveSleepingBodyToAwake(size_t id);
+        void      syncBodies(EntityManager &entityManager);
+        void      resolveFastMovers();
+        float     findEarliestImpact(uint32_t  index,
+                                     SweptHit &hit) const;
+        void      addSweptPairs();
+        void      generatePairs();
+        void      runPairTask(size_t task, uint32_t cellTasks);
+        void      colorContacts();
+        void      updateContacts();
+        bool      isResting(ContactPair const &pair) const;
+
+        template <typename Visitor>
+        void forEachBodyIn(AABB const &area,
+                           Visitor   &&visit) const;
+
+      public:
+        static constexpr float  DEFAULT_CELL_SIZE   = 64.0f;
+        static constexpr Uint32 DEFAULT_SLEEP_TICKS = 30;
+        static constexpr float  SLEEP_EPSILON       = 0.01f;
+        // How far a swept body is pushed past its time of impact so the
+        // discrete overlap test sees the contact.
+        static constexpr float SWEEP_SKIN = 1.0f;
+
+        explicit CollisionWorld(float  cellSize        = DEFAULT_CELL_SIZE,
+                                Uint32 sleepAfterTicks = DEFAULT_SLEEP_TICKS);
+
+        static constexpr uint32_t CELLS_PER_TASK    = 64;
+        static constexpr uint32_t BODIES_PER_TASK   = 64;
+        static constexpr uint32_t CONTACTS_PER_TASK = 32;
+
+        /**
+         * Runs pair generation and contact resolution on `jobSystem`, or on
+         * the calling thread if it is null. The pool must outlive the world.
+         */
+        void setJobSystem(JobSystem *jobSystem);
+
+        /**
+         * Sizes the broadphase grids to cover [0, size]. Does nothing if the
+         * size is unchanged; otherwise every grid is rebuilt on the next
+         * update.
+         */
+        void setBounds(Vec2 const &size);
+
+        /**
+         * Syncs bodies from the entity manager, updates sleep state and
+         * regenerates the overlapping pairs for this tick.
+         */
+        void update(EntityManager &entityManager);
+
+        /**
+         * Overlapping pairs found by the last update. Each pair is reported
+         * once; order within the pair follows the entity list.
+         */
+        std::vector<ContactPair> const &getPairs() const;
+
+        /**
+         * Candidate pairs the broadphase tested for overlap in the last
+         * update; getPairs().size() of them overlapped. Both also feed the
+         * global "broadphase.pairs_tested" and "broadphase.pairs_hit"
+         * counters.
+         */
+        size_t getPairsTested() const { return m_pairsTested; }
+
+        /**
+         * Contact events from the last update, sorted by entity id pair.
+         * Entities in End events may already be destroyed.
+         */
+        std::vector<ContactEvent> const &getContactEvents() const;
+
+        /**
+         * Calls resolve(event) for every Begin and Stay event, in batches
+         * where no two contacts share a dynamic body. Static bodies are
+         * treated as read-only and never cause a conflict. Contacts inside a
+         * batch may run concurrently, so `resolve` must only write to the
+         * two bodies of its contact.
+         */
+        void resolveContacts(FunctionRef<void(ContactEvent const &)> resolve);
+
+        size_t getContactBatchCount() const {
+            return m_batchStart.empty() ? 0 : m_batchStart.size() - 1;
+        }
+
+        /**
+         * Sizes the pair and contact buffers for `contacts` contacts up
+         * front. They otherwise grow on demand, so an update that sets a
+         * new high allocates; a scene that knows its peak, or has measured
+         * it, can reserve once instead.
+         */
+        void reserveContacts(size_t contacts);
+
+        /**
+         * Appends every entity whose box overlaps `area` to `results` and
+         * returns how many were added.
+         */
+        size_t queryRect(AABB const        &area,
+                         QueryFilter const &filter,
+                         EntityList        &results) const;
+
+        /**
+         * Appends every entity whose center lies strictly within `radius`
+         * of `center` to `results` and returns how many were added.
+         */
+        size_t queryRadius(Vec2 const        &center,
+                           float              radius,
+                           QueryFilter const &filter,
+                           EntityList        &results) const;
+
+        /**
+         * Appends up to `count` entities closest to `center`, nearest
+         * first, to `results` and returns how many were added. The search
+         * radius doubles from one cell until enough entities are found.
+         */
+        size_t queryNearest(Vec2 const        &center,
+                            size_t             count,
+                            QueryFilter const &filter,
+                            EntityList        &results) const;
+
+        /**
+         * Whether any entity's box overlaps `area`. Same cells as
+         * queryRect, without building a result list.
+         */
+        bool anyBodyIn(AABB const        &area,
+                       QueryFilter const &filter = {}) const;
+
+        /**
+         * How many times update() has run, so callers can tell whether
+         * bodies added since they last looked are in the grids yet.
+         */
+        size_t getUpdateCount() const { return m_updateCount; }
+
+        bool isSleeping(size_t entityId) const;
+        bool isStatic(size_t entityId) const;
+
+        /**
+         * Wakes a sleeping body so it takes part in integration and the
+         * broadphase again. Call it when gameplay code moves or drives a
+         * body that may be asleep (e.g. player input). The body joins the
+         * awake set straight away, so queries made before the next update
+         * still find it.
+         */
+        void wake(size_t entityId);
+
+        size_t getStaticBodyCount() const { return m_staticBodies.size(); }
+        size_t getSleepingBodyCount() const { return m_sleepingBodies.size(); }
+        size_t getAwakeBodyCount() const { return m_awakeBodies.size(); }
+    };
+
+    template <typename Visitor>
+    void CollisionWorld::forEachBodyIn(AABB const &area,
+                                       Visitor   &&visit) const {
+        // A set whose grid is out of date (after a wake or a resize) is
+        // scanned directly until the next update rebuilds it. Bodies added
+        // since the grid was built (woken ones) sit past the end of it.
+        auto const visitSet = [&](EntityList const        &bodies,
+                                  std::vector<AABB> const &boxes,
+                                  SpatialGrid const       &grid,
+                                  bool const               dirty) {
+            size_t first = 0;
+            if (!dirty) {
+                grid.query(area, [&](uint32_t const index) {
+                    visit(bodies[index], boxes[index]);
+                });
+                first = grid.size();
+            }
+            for (size_t index = first; index < bodies.size(); ++index) {
+                if (area.overlaps(boxes[index])) {
+                    visit(bodies[index], boxes[index]);
+                }
+            }
+        };
+
+        visitSet(m_staticBodies, m_staticBoxes, m_staticGrid, m_staticDirty);
+        visitSet(m_sleepingBodies, m_sleepingBoxes, m_sleepingGrid,
+                 m_sleepingDirty);
+        visitSet(m_awakeBodies, m_awakeBoxes, m_awakeGrid, m_awakeDirty);
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <Helpers/Vec2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace YerbEngine {
+
+    struct AABB {
+        Vec2 min{0, 0};
+        Vec2 max{0, 0};
+
+        /**
+         * Strict overlap test. Touching edges do not count, matching
+         * CollisionHelpers::calculateCollisionBetweenEntities.
+         */
+        constexpr bool overlaps(AABB const &other) const {
+            return min.x() < other.max.x() && other.min.x() < max.x() &&
+                   min.y() < other.max.y() && other.min.y() < max.y();
+        }
+    };
+
+    /**
+     * Uniform grid over a fixed rectangle of the world.
+     *
+     * The grid is built in one pass from a list of boxes using a counting
+     * sort, so each cell is a contiguous run of body indices. Boxes outside
+     * the bounds are clamped into the border cells so nothing is ever lost.
+     */
+    class SpatialGrid {
+        float    m_cellSize = 64.0f;
+        uint32_t m_columns  = 1;
+        uint32_t m_rows     = 1;
+
+        // cell -> first slot in m_cellItems, with one trailing sentinel
+        std::vector<uint32_t> m_cellStart = std::vector<uint32_t>(2, 0);
+        std::vector<uint32_t> m_cellItems; // body indices grouped by cell
+        std::vector<AABB>     m_boxes;     // body index -> box
+        std::vector<uint32_t> m_cursor;    // build() scratch, kept to reuse
+
+        uint32_t cellX(float x) const;
+        uint32_t cellY(float y) const;
+
+      public:
+        SpatialGrid() = default;
+        explicit SpatialGrid(float cellSize);
+
+        /**
+         * Sizes the grid to cover [0, size]. Existing contents are dropped.
+         */
+        void setBounds(Vec2 const &size);
+
+        /**
+         * Rebuilds the grid from scratch. Body index i refers to boxes[i].
+         */
+        void build(std::vector<AABB> const &boxes);
+
+        void clear();
+
+        size_t      size() const { return m_boxes.size(); }
+        bool        empty() const { return m_boxes.empty(); }
+        AABB const &box(size_t index) const { return m_boxes[index]; }
+
+        /**
+         * Returns the index of the cell that owns the point. Used to report
+         * a pair only from the cell holding the top-left corner of the
+         * intersection, so boxes spanning several cells are reported once.
+         */
+        uint32_t cellOf(Vec2 const &point) const;
+
+        /**
+         * Invokes visit(index) once for every box overlapping `area`.
+         * Returns how many candidate boxes were tested for overlap.
+         */
+        template <typename Visitor>
+        size_t query(AABB const &area,
+                     Visitor   &&visit) const;
+
+        uint32_t cellCount() const { return m_columns * m_rows; }
+
+        /**
+         * Invokes visit(a, b) once for every overlapping pair with a < b.
+         * Returns how many candidate pairs were tested for overlap.
+         */
+        template <typename Visitor>
+        size_t forEachPair(Visitor &&visit) const;
+
+        /**
+         * Same as forEachPair, restricted to pairs owned by cells in
+         * [firstCell, lastCell). Disjoint cell ranges report disjoint pairs,
+         * so ranges can be processed on different threads.
+         */
+        template <typename Visitor>
+        size_t forEachPairInCells(uint32_t  firstCell,
+                                  uint32_t  lastCell,
+                                  Visitor &&visit) const;
+    };
+
+    template <typename Visitor>
+    size_t SpatialGrid::query(AABB const &area,
+                              Visitor   &&visit) const {
+        if (m_boxes.empty()) {
+            return 0;
+        }
+
+        uint32_t const x0 = cellX(area.min.x());
+        uint32_t const x1 = cellX(area.max.x());
+        uint32_t const y0 = cellY(area.min.y());
+        uint32_t const y1 = cellY(area.max.y());
+
+        size_t tested = 0;
+        for (uint32_t y = y0; y <= y1; ++y) {
+            for (uint32_t x = x0; x <= x1; ++x) {
+                uint32_t const cell = y * m_columns + x;
+                tested += m_cellStart[cell + 1] - m_cellStart[cell];
+                for (uint32_t slot = m_cellStart[cell];
+                     slot < m_cellStart[cell + 1]; ++slot) {
+                    uint32_t const index = m_cellItems[slot];
+                    AABB const    &other = m_boxes[index];
+                    if (!area.overlaps(other)) {
+                        continue;
+                    }
+
+                    Vec2 const corner{std::max(area.min.x(), other.min.x()),
+                                      std::max(area.min.y(), other.min.y())};
+                    if (cellOf(corner) != cell) {
+                        continue;
+                    }
+                    visit(index);
+                }
+            }
+        }
+        return tested;
+    }
+
+    template <typename Visitor>
+    size_t SpatialGrid::forEachPair(Visitor &&visit) const {
+        return forEachPairInCells(0, cellCount(),
+                                  std::forward<Visitor>(visit));
+    }
+
+    template <typename Visitor>
+    size_t SpatialGrid::forEachPairInCells(uint32_t const firstCell,
+                                           uint32_t const lastCell,
+                                           Visitor      &&visit) const {
+        size_t tested = 0;
+        for (uint32_t cell = firstCell; cell < lastCell; ++cell) {
+            uint32_t const begin = m_cellStart[cell];
+            uint32_t const end   = m_cellStart[cell + 1];
+            size_t const   count = end - begin;
+            tested += count * (count - 1) / 2; // 0 for an empty cell
+
+            for (uint32_t i = begin; i < end; ++i) {
+                uint32_t const a    = m_cellItems[i];
+                AABB const    &boxA = m_boxes[a];
+
+                for (uint32_t j = i + 1; j < end; ++j) {
+                    uint32_t const b    = m_cellItems[j];
+                    AABB const    &boxB = m_boxes[b];
+                    if (!boxA.overlaps(boxB)) {
+                        continue;
+                    }
+
+                    Vec2 const corner{std::max(boxA.min.x(), boxB.min.x()),
+                                      std::max(boxA.min.y(), boxB.min.y())};
+                    if (cellOf(corner) != cell) {
+                        continue;
+                    }
+                    a < b ? visit(a, b) : visit(b, a);
+                }
+            }
+        }
+        return tested;
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Physics/CollisionWorld.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace YerbEngine {
+
+    struct SpawnConstraints {
+        Vec2  avoidCenter{0, 0}; // e.g. the player's center
+        float avoidRadius = 0;   // min distance from avoidCenter
+        float margin      = 0;   // min distance from the bounds
+    };
+
+    /**
+     * Finds free spawn positions without testing against every entity.
+     *
+     * A candidate is checked against the collision world's grids from its
+     * last update, which only visits the cells under the candidate's box,
+     * so a random try costs O(1) expected and nothing is rescanned between
+     * spawn rounds. Random candidates are tried first; if those keep
+     * landing on bodies, the free cell-aligned anchors are enumerated, so
+     * a position is found whenever one exists. That fallback is not O(1):
+     * it makes one grid query per anchor, (bounds area / cellSize^2) of
+     * them, so it is only meant for nearly full arenas.
+     *
+     * Boxes placed here are not in the world until its next update, so
+     * they are kept in a short list and checked as well; the list is
+     * dropped once the world has updated and holds them itself.
+     */
+    class SpawnPlacer {
+        CollisionWorld const &m_world;
+        float                 m_cellSize; // anchor spacing for the scan
+        Vec2                  m_bounds{0, 0};
+
+        std::vector<AABB> m_placed; // since the world's last update
+        size_t            m_placedAtUpdate = 0;
+
+        // Poisson-disk background grid, one accepted sample per cell.
+        std::vector<int32_t> m_diskCells;
+        std::vector<Vec2>    m_freeAnchors; // scanForFreeAnchor() scratch
+
+        void      dropStalePlacements();
+        bool      isCandidateValid(Vec2 const             &position,
+                                   Vec2 const             &size,
+                                   SpawnConstraints const &constraints) const;
+        bool      scanForFreeAnchor(std::mt19937           &randomGenerator,
+                                    Vec2 const             &size,
+                                    SpawnConstraints const &constraints,
+                                    Vec2                   &position);
+
+      public:
+        static constexpr float DEFAULT_CELL_SIZE = 16.0f;
+        static constexpr int   RANDOM_ATTEMPTS   = 16;
+        static constexpr int   BATCH_ATTEMPTS    = 30; // per requested spawn
+
+        /**
+         * Samples against `world`, which must outlive the placer.
+         */
+        explicit SpawnPlacer(CollisionWorld const &world,
+                             float cellSize = DEFAULT_CELL_SIZE);
+
+        /**
+         * Positions are sampled inside [0, bounds].
+         */
+        void setBounds(Vec2 const &bounds) { m_bounds = bounds; }
+
+        /**
+         * Marks `box` as taken until the world's next update.
+         */
+        void occupy(AABB const &box);
+        bool isFree(AABB const &box) const;
+
+        /**
+         * Picks a free top-left position for a box of `size`, marks it as
+         * occupied and writes it to `position`. Returns false if no position
+         * satisfies the constraints.
+         */
+        bool sample(std::mt19937           &randomGenerator,
+                    Vec2 const             &size,
+                    SpawnConstraints const &constraints,
+                    Vec2                   &position);
+
+        /**
+         * Appends up to `count` free positions whose centers are at least
+         * `minSpacing` apart (Poisson-disk dart throwing) and returns how
+         * many were added. Useful for wave spawns that should not clump.
+         */
+        size_t sampleBatch(std::mt19937           &randomGenerator,
+                           Vec2 const             &size,
+                           size_t                  count,
+                           float                   minSpacing,
+                           SpawnConstraints const &constraints,
+                           std::vector<Vec2>      &positions);
+    };
+
+} // namespace YerbEngine
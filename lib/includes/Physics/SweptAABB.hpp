@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Physics/SpatialGrid.hpp>
+
+namespace YerbEngine {
+
+    /**
+     * Swept AABB time-of-impact test.
+     *
+     * Moves `moving` by `displacement` against a stationary `target` and
+     * writes the fraction of the move at which they first touch to
+     * `timeOfImpact`. Returns false if they never touch within the move,
+     * only graze, or already overlap at the start (the discrete overlap test
+     * handles those).
+     */
+    bool sweepAABB(AABB const &moving,
+                   Vec2 const &displacement,
+                   AABB const &target,
+                   float      &timeOfImpact);
+
+} // namespace YerbEngine
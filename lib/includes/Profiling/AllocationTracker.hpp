@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Global operator new and delete are replaced, and every allocation
+// counted, in debug builds or any build that defines
+// YERB_ALLOCATION_TRACKING=1.
+#if !defined(YERB_ALLOCATION_TRACKING)
+#if defined(NDEBUG)
+#define YERB_ALLOCATION_TRACKING 0
+#else
+#define YERB_ALLOCATION_TRACKING 1
+#endif
+#endif
+
+namespace YerbEngine {
+
+    struct AllocationCounts {
+        uint64_t allocations = 0;
+        uint64_t frees       = 0;
+        uint64_t bytes       = 0; // requested; frees do not subtract
+
+        AllocationCounts operator-(AllocationCounts const &other) const {
+            return {.allocations = allocations - other.allocations,
+                    .frees       = frees - other.frees,
+                    .bytes       = bytes - other.bytes};
+        }
+    };
+
+    /**
+     * Allocations from one call stack, innermost frame first, starting at
+     * the caller of operator new.
+     */
+    struct AllocationSite {
+        std::vector<std::string> frames;
+        uint64_t                 allocations = 0;
+        uint64_t                 bytes       = 0;
+    };
+
+    /**
+     * Counts allocations made through global operator new, per thread and
+     * in total, and optionally per call site.
+     *
+     * Counting is a few relaxed atomic operations per allocation and is
+     * always on in builds with YERB_ALLOCATION_TRACKING; without it,
+     * counts stay at zero. Call sites are recorded only while site
+     * tracking is on, since each allocation then walks the stack. Frames
+     * are named when the symbol is exported (link with -rdynamic) and are
+     * otherwise module+offset, for addr2line. Allocations that bypass
+     * operator new, such as SDL's, are not seen.
+     */
+    class AllocationTracker {
+      public:
+        static constexpr size_t MAX_SITES  = 4096;
+        static constexpr size_t MAX_FRAMES = 8;
+
+        static constexpr bool isEnabled() {
+            return YERB_ALLOCATION_TRACKING != 0;
+        }
+
+        /**
+         * Whether this platform can walk the stack for site tracking.
+         */
+        static bool canTrackSites();
+
+        /**
+         * Allocations made by the calling thread since it started.
+         */
+        static AllocationCounts getThreadCounts();
+
+        /**
+         * Allocations made by all threads since the process started.
+         */
+        static AllocationCounts getTotalCounts();
+
+        /**
+         * Turns call-site recording on or off. Sites recorded so far are
+         * kept. Has no effect where canTrackSites() is false.
+         */
+        static void setSiteTracking(bool enabled);
+        static bool isSiteTracking();
+
+        /**
+         * The `limit` sites that allocated most often, most first.
+         */
+        static std::vector<AllocationSite> getTopSites(size_t limit);
+
+        /**
+         * Allocations not attributed to a site because the table was full.
+         */
+        static uint64_t getDroppedSiteCount();
+
+        /**
+         * Logs the `limit` sites that allocated most often.
+         */
+        static void logTopSites(size_t limit);
+    };
+
+    /**
+     * Counts the allocations the calling thread makes while it is alive.
+     */
+    class AllocationScope {
+        AllocationCounts m_start;
+
+      public:
+        AllocationScope();
+
+        AllocationCounts getCounts() const;
+    };
+
+    /**
+     * Asserts that the calling thread does not allocate while it is alive,
+     * e.g. around a steady-state tick in a test:
+     *
+     *     NoAllocationScope scope("pipeline tick");
+     *     pipeline.run(SystemPhase::Simulate);
+     *     BOOST_CHECK_EQUAL(scope.getViolations(), 0);
+     *
+     * The stack of the first allocation is captured where the platform
+     * allows, and logged with the count when the scope ends.
+     */
+    class NoAllocationScope {
+        using Stack = std::array<void *, AllocationTracker::MAX_FRAMES>;
+
+        char const        *m_label;
+        AllocationScope    m_counts;
+        NoAllocationScope *m_previous;
+        Stack              m_firstStack{};
+        size_t             m_firstDepth = 0;
+        size_t             m_firstSize  = 0;
+        bool               m_captured   = false;
+
+        friend void noteSteadyStateAllocation(size_t      size,
+                                              void const *caller);
+
+      public:
+        explicit NoAllocationScope(char const *label);
+        ~NoAllocationScope();
+
+        NoAllocationScope(NoAllocationScope const &)            = delete;
+        NoAllocationScope &operator=(NoAllocationScope const &) = delete;
+
+        uint64_t getViolations() const {
+            return m_counts.getCounts().allocations;
+        }
+
+        /**
+         * Stack of the first allocation, innermost first; empty if there
+         * was none or the stack could not be walked.
+         */
+        std::vector<std::string> getFirstStack() const;
+    };
+
+} // namespace YerbEngine
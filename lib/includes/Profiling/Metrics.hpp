@@ -0,0 +1,251 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace YerbEngine {
+
+    namespace Metrics {
+        /**
+         * This thread's slot in a sharded counter.
+         */
+        size_t threadShard();
+    } // namespace Metrics
+
+    /**
+     * A monotonically increasing count. Increments go to one of several
+     * cache-line-sized shards picked per thread, so threads counting the
+     * same thing do not contend.
+     */
+    class Counter {
+      public:
+        static constexpr size_t SHARDS = 16;
+
+      private:
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> value{0};
+        };
+
+        std::array<Shard, SHARDS> m_shards;
+        uint64_t                  m_windowStart = 0; // total at last window
+
+        friend class MetricsRegistry;
+
+      public:
+        void add(uint64_t const amount = 1) {
+            m_shards[Metrics::threadShard()].value.fetch_add(
+                amount, std::memory_order_relaxed);
+        }
+
+        uint64_t get() const;
+    };
+
+    /**
+     * A value that is set rather than accumulated, e.g. a live entity
+     * count.
+     */
+    class Gauge {
+        std::atomic<double> m_value{0.0};
+
+      public:
+        void set(double const value) {
+            m_value.store(value, std::memory_order_relaxed);
+        }
+
+        void add(double const amount) {
+            m_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        double get() const { return m_value.load(std::memory_order_relaxed); }
+    };
+
+    struct HistogramStats {
+        uint64_t count = 0;
+        double   mean  = 0.0;
+        double   p50   = 0.0;
+        double   p95   = 0.0;
+        double   p99   = 0.0;
+        double   max   = 0.0;
+    };
+
+    /**
+     * Distribution of non-negative integer values, e.g. microseconds, over
+     * the current window.
+     *
+     * Buckets are log-linear, as in HdrHistogram: values below
+     * 2 * SUB_BUCKETS get a bucket each, and every power of two above that
+     * is split into SUB_BUCKETS equal buckets, so a percentile is within
+     * 1 / SUB_BUCKETS of the true value. Values above MAX_VALUE share the
+     * last bucket; the maximum is tracked exactly. Recording is a few
+     * relaxed atomic operations and never allocates.
+     */
+    class Histogram {
+      public:
+        static constexpr unsigned SUB_BUCKET_BITS = 6;
+        static constexpr uint64_t SUB_BUCKETS     = uint64_t{1}
+                                                << SUB_BUCKET_BITS;
+        static constexpr unsigned MAX_BITS  = 36;
+        static constexpr uint64_t MAX_VALUE = (uint64_t{1} << MAX_BITS) - 1;
+        static constexpr size_t   BUCKETS =
+            (MAX_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+      private:
+        std::array<std::atomic<uint64_t>, BUCKETS> m_buckets{};
+        std::atomic<uint64_t>                      m_sum{0};
+        std::atomic<uint64_t>                      m_max{0};
+        std::string                                m_unit;
+
+        HistogramStats stats(std::array<uint64_t, BUCKETS> const &buckets,
+                             uint64_t                             sum,
+                             uint64_t                             max) const;
+
+      public:
+        explicit Histogram(std::string unit = {});
+
+        static size_t bucketOf(uint64_t value);
+
+        /**
+         * The largest value that falls into `bucket`.
+         */
+        static uint64_t bucketHighest(size_t bucket);
+
+        void record(uint64_t value);
+
+        /**
+         * Records a duration in microseconds.
+         */
+        template <typename Rep, typename Period>
+        void recordDuration(std::chrono::duration<Rep, Period> const d) {
+            auto const us =
+                std::chrono::duration_cast<std::chrono::microseconds>(d)
+                    .count();
+            record(us > 0 ? static_cast<uint64_t>(us) : 0);
+        }
+
+        /**
+         * Statistics over the window so far. Percentiles are nearest-rank,
+         * reported as the highest value of their bucket and never above the
+         * maximum.
+         */
+        HistogramStats getStats() const;
+
+        /**
+         * Statistics over the window so far, then starts a new window.
+         */
+        HistogramStats takeWindow();
+
+        std::string const &getUnit() const { return m_unit; }
+    };
+
+    enum class MetricKind { Counter, Gauge, Histogram };
+
+    char const *toString(MetricKind kind);
+
+    struct MetricValue {
+        std::string    name;
+        MetricKind     kind  = MetricKind::Counter;
+        std::string    unit;        // histograms only
+        double         value = 0.0; // counter total or gauge value
+        double         delta = 0.0; // counter increase over the window
+        HistogramStats stats;       // histograms only
+    };
+
+    struct MetricsWindow {
+        size_t                   index        = 0;
+        double                   startSeconds = 0.0; // since registry start
+        double                   endSeconds   = 0.0;
+        std::vector<MetricValue> metrics; // sorted by name
+    };
+
+    /**
+     * Named counters, gauges and histograms.
+     *
+     * Looking a metric up takes a lock, so callers look each one up once
+     * and keep the reference, which stays valid as long as the registry;
+     * updating it is lock-free. Asking for an existing name returns the
+     * same metric.
+     *
+     * The engine's own metrics live in global(), which is never destroyed,
+     * so metrics can be updated from anywhere until the process exits.
+     */
+    class MetricsRegistry {
+        using Clock = std::chrono::steady_clock;
+
+        mutable std::mutex m_mutex;
+        std::map<std::string, std::unique_ptr<Counter>, std::less<>>
+            m_counters;
+        std::map<std::string, std::unique_ptr<Gauge>, std::less<>> m_gauges;
+        std::map<std::string, std::unique_ptr<Histogram>, std::less<>>
+                          m_histograms;
+        Clock::time_point m_start       = Clock::now();
+        Clock::time_point m_windowStart = m_start;
+        size_t            m_windows     = 0;
+
+        void checkUnused(std::string_view name,
+                         MetricKind       kind) const;
+
+      public:
+        static MetricsRegistry &global();
+
+        /**
+         * @throws std::runtime_error if `name` is a metric of another kind.
+         */
+        Counter   &counter(std::string_view name);
+        Gauge     &gauge(std::string_view name);
+        Histogram &histogram(std::string_view name,
+                             std::string_view unit = {});
+
+        Counter const   *findCounter(std::string_view name) const;
+        Gauge const     *findGauge(std::string_view name) const;
+        Histogram const *findHistogram(std::string_view name) const;
+
+        /**
+         * Every metric's value over the window since the last call (or
+         * since the registry was created), then starts a new window:
+         * histograms are cleared and counter deltas restart.
+         */
+        MetricsWindow closeWindow();
+    };
+
+    /**
+     * Streams metrics windows to a file as they close: CSV, one row per
+     * metric per window, or, for a path ending in .json, a JSON object
+     * holding an array of windows. Rows are flushed as they are written;
+     * a JSON file is complete once the writer is destroyed.
+     */
+    class MetricsFile {
+        std::filesystem::path m_path;
+        std::ofstream         m_file;
+        bool                  m_json    = false;
+        size_t                m_written = 0;
+
+      public:
+        /**
+         * @throws std::runtime_error if the file cannot be created.
+         */
+        explicit MetricsFile(std::filesystem::path path);
+        ~MetricsFile();
+
+        MetricsFile(MetricsFile const &)            = delete;
+        MetricsFile &operator=(MetricsFile const &) = delete;
+
+        /**
+         * @throws std::runtime_error if the window cannot be written.
+         */
+        void write(MetricsWindow const &window);
+
+        std::filesystem::path const &getPath() const { return m_path; }
+    };
+
+} // namespace YerbEngine
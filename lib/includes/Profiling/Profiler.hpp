@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+// Zones are compiled in unless a build defines YERB_PROFILING=0, in which
+// case YERB_ZONE expands to nothing. Compiled in, a zone costs one relaxed
+// load while no capture is running.
+#if !defined(YERB_PROFILING)
+#define YERB_PROFILING 1
+#endif
+
+namespace YerbEngine {
+
+    /**
+     * Frame profiler writing Chrome trace (about://tracing, Perfetto) JSON.
+     *
+     * Zones are timed with the TSC on x86-64 and the steady clock
+     * elsewhere, and recorded as complete events into a fixed buffer owned
+     * by the recording thread, so recording takes no lock and never
+     * allocates. A thread's buffer is taken on its first zone, from those
+     * left by exited threads when one no longer holds the current capture,
+     * so short-lived threads do not grow memory. Zones past a buffer's
+     * capacity are dropped and counted. benchmarks/bench_profiler_zone.cpp
+     * reports the cost of a zone with and without a capture running.
+     *
+     * Start and stop captures between frames: a zone is recorded if the
+     * capture was running when it began. Zone names must outlive the
+     * capture; use string literals, or intern() names built at runtime.
+     */
+    class Profiler {
+        static std::atomic<bool> s_capturing;
+
+      public:
+        static constexpr size_t EVENTS_PER_THREAD = size_t{1} << 16;
+
+        static bool isCapturing() {
+            return s_capturing.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * The profiler's clock, in ticks that writeChromeTrace() converts.
+         */
+        static uint64_t now();
+
+        /**
+         * Records a zone on the calling thread's buffer.
+         */
+        static void record(char const *name,
+                           uint64_t    start,
+                           uint64_t    end);
+
+        /**
+         * Starts recording a new capture. Earlier zones stop counting at
+         * once; each thread clears its buffer on its first zone after this.
+         */
+        static void startCapture();
+        static void stopCapture();
+
+        /**
+         * Writes the last capture as Chrome trace JSON, one track per
+         * thread.
+         *
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        static void writeChromeTrace(std::filesystem::path const &path);
+
+        /**
+         * A copy of `name` that lives until the process ends, for zone names
+         * built at runtime. Interning the same name again returns the same
+         * pointer.
+         */
+        static char const *intern(std::string_view name);
+
+        /**
+         * Names the calling thread's track in the trace.
+         */
+        static void setThreadName(std::string_view name);
+
+        /**
+         * Zones recorded and dropped in the current or last capture.
+         */
+        static size_t getRecordedCount();
+        static size_t getDroppedCount();
+    };
+
+    /**
+     * Times the enclosing scope; see YERB_ZONE.
+     */
+    class ProfileZone {
+        char const *m_name;
+        uint64_t    m_start  = 0;
+        bool        m_active = false;
+
+      public:
+        explicit ProfileZone(char const *name)
+            : m_name(name),
+              m_active(Profiler::isCapturing()) {
+            if (m_active) {
+                m_start = Profiler::now();
+            }
+        }
+
+        ~ProfileZone() {
+            if (m_active) {
+                Profiler::record(m_name, m_start, Profiler::now());
+            }
+        }
+
+        ProfileZone(ProfileZone const &)            = delete;
+        ProfileZone &operator=(ProfileZone const &) = delete;
+    };
+
+} // namespace YerbEngine
+
+#if YERB_PROFILING
+#define YERB_ZONE_JOIN_(a, b) a##b
+#define YERB_ZONE_JOIN(a, b) YERB_ZONE_JOIN_(a, b)
+/**
+ * Times the rest of the enclosing scope as a zone named `name` while a
+ * capture runs.
+ */
+#define YERB_ZONE(name)                                                        \
+    ::YerbEngine::ProfileZone YERB_ZONE_JOIN(yerbZone, __LINE__)(name)
+#else
+#define YERB_ZONE(name) static_cast<void>(0)
+#endif
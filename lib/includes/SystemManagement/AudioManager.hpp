@@ -34,6 +34,8 @@ namespace YerbEngine {
         int chunksize = 2048;
         std::vector<AudioTrackDefinition>  tracks{};
         std::vector<AudioSampleDefinition> samples{};
+        // Open no audio device and load nothing; playback calls do nothing.
+        bool nullDevice = false;
     };
 
     class AudioManager {
@@ -49,12 +51,17 @@ namespace YerbEngine {
         AudioTrackId  m_lastAudioTrack{};
         AudioSampleId m_lastAudioSample{};
         bool          m_audioTrackPaused = false;
+        bool          m_nullDevice       = false;
 
         bool                       m_tracksMuted      = false;
         bool                       m_samplesMuted     = false;
         int                        m_savedTrackVolume = MIX_MAX_VOLUME;
         std::map<AudioSampleId, int> m_savedSampleVolumes;
 
+        bool m_ducked              = false;
+        int  m_unduckedTrackVolume = MIX_MAX_VOLUME;
+        bool m_allPaused           = false;
+
         /**
          * Loads an audio track from a file.
          *
@@ -92,7 +99,8 @@ namespace YerbEngine {
          * Constructor for AudioManager.
          *
          * Initializes SDL audio subsystem and loads all audio tracks and
-         * samples.
+         * samples. With options.nullDevice set, neither happens and the
+         * manager only keeps track state, for machines without a sound card.
          *
          * @throws std::runtime_error if SDL_Init(SDL_INIT_AUDIO) or
          * Mix_OpenAudio fails.
@@ -276,6 +284,29 @@ namespace YerbEngine {
          */
         void toggleMuteSamples();
 
+        /**
+         * Scales the track and every sample channel to `factor` of their
+         * volume, e.g. while the window is in the background. Calling it
+         * again while ducked changes the factor.
+         */
+        void duck(float factor);
+
+        /**
+         * Restores the volumes duck() lowered.
+         */
+        void unduck();
+
+        /**
+         * Pauses the track and every playing sample, remembering whether
+         * the track was already paused.
+         */
+        void pauseAll();
+
+        /**
+         * Resumes what pauseAll() paused.
+         */
+        void resumeAll();
+
         /**
          * Get the current audio track.
          *
@@ -297,6 +328,11 @@ namespace YerbEngine {
          */
         AudioSampleId getLastAudioSample() const;
 
+        /**
+         * Whether the manager was created without an audio device.
+         */
+        bool hasNullDevice() const { return m_nullDevice; }
+
         /**
          * Checks if the currently playing audio track is paused.
          *
@@ -2,16 +2,24 @@
 #include <Configuration/ConfigAdapter.hpp>
 #include <Helpers/Vec2.hpp>
 #include <SDL.h>
+#include <chrono>
+#include <cstdint>
 
 namespace YerbEngine {
 
     class VideoManager {
         SDL_Renderer *m_renderer = nullptr;
         SDL_Window   *m_window   = nullptr;
+        SDL_Surface  *m_surface  = nullptr; // headless render target
 
         Vec2           m_currentWindowSize;
         ConfigAdapter &m_config;
 
+        std::chrono::steady_clock::time_point m_lastPresentTime;
+        std::chrono::steady_clock::duration   m_lastPresentDuration{0};
+        uint64_t                              m_presentCount = 0;
+        uint64_t m_drawCallsAtPresent = 0; // draw call total at last present
+
         /**
          * @brief Initializes the SDL video subsystem.
          *
@@ -54,6 +62,17 @@ namespace YerbEngine {
          */
         SDL_Window *createWindow();
 
+        /**
+         * @brief Creates a software renderer drawing into an offscreen
+         * surface the size of the configured window.
+         *
+         * Needs neither a display nor the SDL video subsystem.
+         *
+         * @throws std::runtime_error if the surface or renderer could not be
+         * created.
+         */
+        SDL_Renderer *createOffscreenRenderer();
+
       public:
         /**
          * @brief Constructor method for the VideoManager.
@@ -61,9 +80,14 @@ namespace YerbEngine {
          * This initializes the VideoManager object by initializing SDL_VIDEO
          * and by creating an SDL_Window and SDL_Renderer.
          *
+         * When `headless` is set there is no window: the renderer is a
+         * software renderer over an offscreen surface, so textures still
+         * load and draw calls still succeed on machines without a display.
+         *
          * @param config The ConfigAdapter to read window settings.
+         * @param headless Whether to skip the window and the video subsystem.
          */
-        explicit VideoManager(ConfigAdapter &config);
+        explicit VideoManager(ConfigAdapter &config, bool headless = false);
 
         /**
          * @brief Destructor for the VideoManager.
@@ -96,13 +120,69 @@ namespace YerbEngine {
          */
         SDL_Renderer *getRenderer() const;
 
+        /**
+         * Presents the renderer's back buffer. Scenes present through this
+         * rather than SDL_RenderPresent so the engine knows when, and
+         * whether, a frame reached the screen.
+         */
+        void present();
+
+        /**
+         * Counts draw calls on the global "render.draw_calls" metric. Each
+         * present also records the calls made since the previous one in
+         * "render.draw_calls_per_frame".
+         */
+        static void countDrawCalls(uint64_t count = 1);
+
+        /**
+         * Number of presents so far; compare across a frame to tell whether
+         * it presented.
+         */
+        uint64_t getPresentCount() const { return m_presentCount; }
+
+        /**
+         * When the last present returned. With vsync this is after the wait
+         * for the display, so it is close to when the frame was shown.
+         */
+        std::chrono::steady_clock::time_point getLastPresentTime() const {
+            return m_lastPresentTime;
+        }
+
+        /**
+         * How long the last present blocked, mostly waiting for vsync.
+         */
+        std::chrono::steady_clock::duration getLastPresentDuration() const {
+            return m_lastPresentDuration;
+        }
+
         /**
          * Get a pointer to the SDL window.
          *
-         * @returns SDL_Window* Pointer to the SDL window.
+         * @returns SDL_Window* Pointer to the SDL window, or nullptr when
+         * headless.
          */
         SDL_Window *getWindow() const;
 
+        /**
+         * Whether rendering goes to an offscreen surface instead of a window.
+         */
+        bool isHeadless() const { return m_window == nullptr; }
+
+        /**
+         * Whether the renderer actually presents with vsync. Requested through
+         * engine.display.vsync; some drivers ignore the request.
+         *
+         * @returns true if presenting waits for the display's refresh.
+         */
+        bool isVsyncEnabled() const;
+
+        /**
+         * Refresh rate of the display the window is on.
+         *
+         * @returns The refresh rate in Hz, or 0 if SDL cannot report it.
+         */
+        int getRefreshRate() const;
+
         /**
          * @brief Cleans up the SDL resources.
          *
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace YerbEngine {
+
+    /**
+     * Bounded work-stealing deque (Chase–Lev, with the memory orderings from
+     * Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+     * Models").
+     *
+     * One owner thread pushes and pops at the bottom; any thread may steal
+     * from the top. The buffer does not grow: push reports failure when it
+     * is full and the caller runs the item itself.
+     */
+    template <typename T, size_t Capacity> class ChaseLevDeque {
+        static_assert((Capacity & (Capacity - 1)) == 0,
+                      "ChaseLevDeque capacity must be a power of two");
+
+        static constexpr int64_t MASK = static_cast<int64_t>(Capacity) - 1;
+
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        std::array<std::atomic<T *>, Capacity> m_buffer{};
+
+      public:
+        /**
+         * Owner only. Returns false if the deque is full.
+         */
+        bool push(T *item) {
+            int64_t const bottom = m_bottom.load(std::memory_order_relaxed);
+            int64_t const top    = m_top.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<int64_t>(Capacity)) {
+                return false;
+            }
+
+            m_buffer[bottom & MASK].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * Owner only. Takes the most recently pushed item, or nullptr.
+         */
+        T *pop() {
+            int64_t const bottom =
+                m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T *item = m_buffer[bottom & MASK].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // Last item: race thieves for it.
+                if (!m_top.compare_exchange_strong(top, top + 1,
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * Any thread. Takes the oldest item, or nullptr if the deque is
+         * empty or another thread won the race for it.
+         */
+        T *steal() {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t const bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom) {
+                return nullptr;
+            }
+
+            T *item = m_buffer[top & MASK].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /**
+         * Approximate; exact only when called by the owner with no thieves
+         * running.
+         */
+        bool empty() const {
+            return m_bottom.load(std::memory_order_relaxed) <=
+                   m_top.load(std::memory_order_relaxed);
+        }
+    };
+
+} // namespace YerbEngine
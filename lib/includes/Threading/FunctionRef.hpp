@@ -0,0 +1,44 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace YerbEngine {
+
+    template <typename Signature> class FunctionRef;
+
+    /**
+     * Non-owning reference to a callable, in the spirit of C++26's
+     * std::function_ref. It is two pointers and never allocates, so hot
+     * paths such as JobSystem::parallelFor can take any lambda without the
+     * heap allocation a capturing std::function may need. The callable must
+     * outlive the reference, which holds for one passed straight to a call
+     * that only uses it until it returns.
+     */
+    template <typename Result, typename... Args>
+    class FunctionRef<Result(Args...)> {
+        using Call = Result (*)(void const *, Args...);
+
+        void const *m_callable;
+        Call        m_call;
+
+      public:
+        template <typename Callable>
+            requires(!std::is_same_v<std::remove_cvref_t<Callable>,
+                                     FunctionRef> &&
+                     std::is_invocable_r_v<Result, Callable const &, Args...>)
+        FunctionRef(Callable const &callable)
+            : m_callable(std::addressof(callable)),
+              m_call([](void const *target, Args... args) -> Result {
+                  return std::invoke(*static_cast<Callable const *>(target),
+                                     std::forward<Args>(args)...);
+              }) {}
+
+        Result operator()(Args... args) const {
+            return m_call(m_callable, std::forward<Args>(args)...);
+        }
+    };
+
+} // namespace YerbEngine
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Threading/FunctionRef.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace YerbEngine {
+
+    struct Job;
+
+    /**
+     * Counts outstanding jobs. submit increments it, finishing a job
+     * decrements it, and JobSystem::wait blocks until it reaches zero. A job
+     * that depends on others waits on their counter before doing its work.
+     */
+    class JobCounter {
+        friend class JobSystem;
+        std::atomic<size_t> m_pending{0};
+
+      public:
+        JobCounter() = default;
+
+        JobCounter(JobCounter const &)            = delete;
+        JobCounter &operator=(JobCounter const &) = delete;
+
+        bool isDone() const {
+            return m_pending.load(std::memory_order_acquire) == 0;
+        }
+    };
+
+    /**
+     * Time and allocations a thread spent running jobs of another owner;
+     * see JobSystem::setOwner().
+     */
+    struct ForeignWork {
+        std::chrono::steady_clock::duration time{0};
+        uint64_t                            allocations = 0;
+
+        ForeignWork operator-(ForeignWork const &other) const {
+            return {.time        = time - other.time,
+                    .allocations = allocations - other.allocations};
+        }
+    };
+
+    /**
+     * Work-stealing job system: one thread per core, each with its own
+     * Chase–Lev deque. Threads pop their own work newest-first and steal
+     * the oldest work from a random victim when they run dry.
+     *
+     * The thread that constructs the system takes deque 0 and is expected
+     * to be the main thread. Any other thread may still submit and wait;
+     * its jobs go through a shared injection queue.
+     *
+     * Waiting never just blocks: the waiting thread runs queued jobs until
+     * its counter clears, so jobs may submit and wait on further jobs, and
+     * parallelFor may be nested, without tying up a thread.
+     */
+    class JobSystem {
+        struct Worker;
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::vector<std::thread>             m_threads;
+
+        std::mutex        m_injectMutex;
+        std::deque<Job *> m_injected;
+
+        std::mutex              m_sleepMutex;
+        std::condition_variable m_wake;
+        std::atomic<size_t>     m_sleepers{0};
+        std::atomic<size_t>     m_queued{0};
+        std::atomic<bool>       m_stopping{false};
+
+        Worker *currentWorker() const;
+        Job    *allocate(Worker *worker);
+        void    enqueue(Worker *worker, Job *job);
+        Job    *findJob(Worker *worker);
+        void    execute(Job *job);
+        void    workerLoop(size_t index);
+
+        void runRange(FunctionRef<void(size_t)> task, size_t begin,
+                      size_t end, size_t grain, JobCounter &counter);
+        bool spawnRange(FunctionRef<void(size_t)> task, size_t begin,
+                        size_t end, size_t grain, JobCounter &counter);
+
+      public:
+        /**
+         * Chunks parallelFor aims to give each thread when no grain size is
+         * passed. More chunks balance uneven work better; fewer cost less to
+         * schedule.
+         */
+        static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+        /**
+         * @param threadCount Total threads including the caller. 0 picks
+         * the hardware concurrency; 1 runs everything on the caller.
+         */
+        explicit JobSystem(size_t threadCount = 0);
+        ~JobSystem();
+
+        JobSystem(JobSystem const &)            = delete;
+        JobSystem &operator=(JobSystem const &) = delete;
+
+        size_t getThreadCount() const { return m_threads.size() + 1; }
+
+        /**
+         * Queues task to run on any thread and adds it to counter.
+         */
+        void submit(std::function<void()> task, JobCounter &counter);
+
+        /**
+         * Returns once counter reaches zero. With help set, the calling
+         * thread runs queued jobs meanwhile; otherwise it only yields (a
+         * system with no worker threads always helps, as nothing else
+         * would run the jobs).
+         */
+        void wait(JobCounter const &counter, bool help = true);
+
+        /**
+         * Marks the calling thread's work as `owner`'s and returns the
+         * previous owner (nullptr by default). A job belongs to the owner
+         * of the thread that queued it, and a thread takes on the job's
+         * owner while running it.
+         *
+         * A job run by a thread with a different owner, e.g. while waiting
+         * on its own parallelFor, is foreign: its time and allocations are
+         * added to getForeignWork(), so the owner can leave them out of
+         * what it measures on that thread.
+         */
+        static void const *setOwner(void const *owner);
+
+        /**
+         * Foreign work done by the calling thread since it started.
+         */
+        static ForeignWork getForeignWork();
+
+        /**
+         * Runs task(i) for every i in [0, count) and blocks until all calls
+         * have returned. task(0) always runs on the calling thread. The
+         * task is referenced, not copied, so passing a lambda allocates
+         * nothing.
+         *
+         * The range is split lazily: a thread runs `grain` indices at a
+         * time and only halves what is left when its own deque is empty,
+         * so chunks stay large unless other threads are hungry. A grain of
+         * 0 picks count / (threads * CHUNKS_PER_THREAD).
+         */
+        void parallelFor(size_t count, FunctionRef<void(size_t)> task,
+                         size_t grain = 0);
+    };
+
+} // namespace YerbEngine
@@ -7,12 +7,20 @@
 
 #include <GameEngine/Action.hpp>
 #include <GameEngine/GameEngine.hpp>
+#include <GameEngine/InputReplay.hpp>
+#include <GameEngine/SimClock.hpp>
+#include <GameEngine/TimerWheel.hpp>
 
 #include <GameScenes/Scene.hpp>
+#include <GameScenes/SceneBatch.hpp>
+
+#include <Coroutines/FramePool.hpp>
+#include <Coroutines/Task.hpp>
 
 #include <EntityManagement/Components.hpp>
 #include <EntityManagement/Entity.hpp>
 #include <EntityManagement/EntityManager.hpp>
+#include <EntityManagement/LifespanTracker.hpp>
 
 #include <Configuration/ConfigAdapter.hpp>
 #include <Configuration/ConfigDictionary.hpp>
@@ -22,6 +30,13 @@
 #include <AssetManagement/FontManager.hpp>
 #include <AssetManagement/TextureManager.hpp>
 
+#include <Physics/CollisionWorld.hpp>
+#include <Physics/SpatialGrid.hpp>
+#include <Physics/SpawnPlacer.hpp>
+#include <Physics/SweptAABB.hpp>
+
+#include <Threading/JobSystem.hpp>
+
 #include <SystemManagement/AudioManager.hpp>
 #include <SystemManagement/VideoManager.hpp>
 
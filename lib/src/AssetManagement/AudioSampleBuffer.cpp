@@ -1,13 +1,26 @@
 #include <AssetManagement/AudioSampleBuffer.hpp>
+#include <Profiling/Metrics.hpp>
+#include <Profiling/Profiler.hpp>
 
 namespace YerbEngine {
 
-    AudioSampleBuffer::AudioSampleBuffer(AudioManager &audioManager)
-        : m_audioManager(audioManager) {}
+    namespace {
+        // Samples discarded without playing because the buffer was full.
+        Counter &droppedSamples() {
+            static Counter &dropped =
+                MetricsRegistry::global().counter("audio.samples_dropped");
+            return dropped;
+        }
+    } // namespace
+
+    AudioSampleBuffer::AudioSampleBuffer(AudioManager   &audioManager,
+                                         SimClock const &clock)
+        : m_audioManager(audioManager),
+          m_clock(clock) {}
 
     void AudioSampleBuffer::queueSample(std::string_view const sample,
                                         PriorityLevel const    priority) {
-        Uint64 const currentTime = SDL_GetTicks64();
+        Uint64 const currentTime = m_clock.now();
         removeExpiredSamples(currentTime);
 
         AudioSampleId const sampleKey(sample);
@@ -25,8 +38,12 @@ namespace YerbEngine {
             }
         }
 
-        if (isBufferFull() && !evictLowerPrioritySample(priority)) {
-            return;
+        if (isBufferFull()) {
+            // Either the incoming sample or a lower-priority one is lost.
+            droppedSamples().add();
+            if (!evictLowerPrioritySample(priority)) {
+                return;
+            }
         }
 
         pushSample(
@@ -34,7 +51,8 @@ namespace YerbEngine {
     }
 
     void AudioSampleBuffer::update() {
-        Uint64 const     currentTime           = SDL_GetTicks64();
+        YERB_ZONE("Audio update");
+        Uint64 const     currentTime           = m_clock.now();
         size_t           soundsPlayedThisFrame = 0;
         constexpr size_t MAX_SOUNDS_PER_FRAME =
             AudioManager::MAX_SAMPLES_PER_FRAME;
@@ -188,6 +206,7 @@ namespace YerbEngine {
         if (!removed) {
             return;
         }
+        droppedSamples().add(m_size - newSize);
 
         m_sampleBuffer = newBuffer;
         m_head         = 0;
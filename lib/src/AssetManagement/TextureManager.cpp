@@ -1,6 +1,10 @@
 #include <AssetManagement/TextureManager.hpp>
+#include <Profiling/Metrics.hpp>
+#include <Profiling/Profiler.hpp>
 #include <SDL.h>
 #include <SDL_image.h>
+#include <Threading/JobSystem.hpp>
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -41,6 +45,7 @@ namespace YerbEngine {
             return;
         }
 
+        YERB_ZONE("Texture load");
         SDL_Surface *img = IMG_Load(path.c_str());
 
         if (img == nullptr) {
@@ -63,6 +68,67 @@ namespace YerbEngine {
         m_textures.emplace(std::move(key), texture);
     }
 
+    void TextureManager::registerTextures(
+        std::vector<std::pair<std::string, std::filesystem::path>> const
+            &textures) {
+        YERB_ZONE("Texture batch load");
+        std::vector<std::pair<std::string, std::filesystem::path>> pending;
+        for (auto const &[name, path] : textures) {
+            if (name.empty()) {
+                registerTexture(name, path); // logs the warning
+                continue;
+            }
+            if (m_textures.contains(name)) {
+                continue;
+            }
+            bool const duplicate = std::any_of(
+                pending.begin(), pending.end(),
+                [&](auto const &entry) { return entry.first == name; });
+            if (!duplicate) {
+                pending.emplace_back(name, path);
+            }
+        }
+
+        std::vector<SDL_Surface *> surfaces(pending.size(), nullptr);
+        auto const                 decode = [&](size_t const index) {
+            YERB_ZONE("Texture decode");
+            surfaces[index] = IMG_Load(pending[index].second.c_str());
+        };
+
+        if (m_jobSystem != nullptr) {
+            m_jobSystem->parallelFor(pending.size(), decode, 1);
+        } else {
+            for (size_t index = 0; index < pending.size(); ++index) {
+                decode(index);
+            }
+        }
+
+        for (size_t index = 0; index < pending.size(); ++index) {
+            auto const &[name, path] = pending[index];
+            SDL_Surface *img         = surfaces[index];
+
+            if (img == nullptr) {
+                // The SDL_image error was set on the decoding thread.
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                             "Unable to load image %s!", path.c_str());
+                continue;
+            }
+
+            SDL_Texture *texture =
+                SDL_CreateTextureFromSurface(m_renderer, img);
+            SDL_FreeSurface(img);
+
+            if (texture == nullptr) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                             "Unable to create texture from %s! SDL Error: %s",
+                             path.c_str(), SDL_GetError());
+                continue;
+            }
+
+            m_textures.emplace(name, texture);
+        }
+    }
+
     bool TextureManager::hasTexture(std::string_view name) const {
         return m_textures.contains(std::string{name});
     }
@@ -71,6 +137,9 @@ namespace YerbEngine {
         std::string key{name};
         auto const  it = m_textures.find(key);
         if (it == m_textures.end()) {
+            static Counter &misses =
+                MetricsRegistry::global().counter("texture.cache_misses");
+            misses.add();
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                         "Texture %.*s not found in TextureManager.",
                         static_cast<int>(name.size()), name.data());
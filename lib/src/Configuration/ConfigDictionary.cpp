@@ -0,0 +1,62 @@
+#include "Configuration/ConfigDictionary.hpp"
+
+#include <bit>
+
+namespace YerbEngine {
+
+    namespace {
+        constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+        constexpr uint64_t FNV_PRIME  = 1099511628211ull;
+
+        void mix(uint64_t &hash, void const *data, size_t const size) {
+            auto const *bytes = static_cast<unsigned char const *>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * FNV_PRIME;
+            }
+        }
+
+        // Fixed-width little-endian, so hashes match across platforms.
+        void mixInteger(uint64_t &hash, uint64_t const value) {
+            for (int byte = 0; byte < 8; ++byte) {
+                unsigned char const b =
+                    static_cast<unsigned char>(value >> (byte * 8));
+                mix(hash, &b, 1);
+            }
+        }
+
+        void mixValue(uint64_t &hash, ConfigValue const &value) {
+            mixInteger(hash, value.index());
+            std::visit(
+                [&hash](auto const &v) {
+                    using T = std::decay_t<decltype(v)>;
+                    if constexpr (std::is_same_v<T, std::string>) {
+                        mixInteger(hash, v.size());
+                        mix(hash, v.data(), v.size());
+                    } else if constexpr (std::is_same_v<T, SDL_Color>) {
+                        unsigned char const rgba[] = {v.r, v.g, v.b, v.a};
+                        mix(hash, rgba, sizeof(rgba));
+                    } else if constexpr (std::is_same_v<T, float>) {
+                        mixInteger(hash, std::bit_cast<uint32_t>(v));
+                    } else {
+                        mixInteger(hash, static_cast<uint64_t>(v));
+                    }
+                },
+                value);
+        }
+    } // namespace
+
+    uint64_t ConfigDictionary::hash() const {
+        // Entries are hashed on their own and summed, since the map has no
+        // stable order.
+        uint64_t combined = 0;
+        for (auto const &[key, value] : m_configuration) {
+            uint64_t entry = FNV_OFFSET;
+            mixInteger(entry, key.size());
+            mix(entry, key.data(), key.size());
+            mixValue(entry, value);
+            combined += entry;
+        }
+        return combined;
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,65 @@
+#include <Coroutines/FramePool.hpp>
+
+#include <new>
+
+namespace YerbEngine {
+
+    FramePool &FramePool::instance() {
+        static FramePool pool;
+        return pool;
+    }
+
+    void FramePool::refill(size_t const sizeClass) {
+        size_t const blockSize = (sizeClass + 1) * CLASS_SIZE;
+
+        m_chunks.push_back(std::make_unique<std::byte[]>(CHUNK_SIZE));
+        m_stats.chunks += 1;
+
+        std::byte *chunk = m_chunks.back().get();
+        for (size_t offset = 0; offset + blockSize <= CHUNK_SIZE;
+             offset += blockSize) {
+            auto *block = reinterpret_cast<FreeBlock *>(chunk + offset);
+            block->next = m_freeLists[sizeClass];
+            m_freeLists[sizeClass] = block;
+        }
+    }
+
+    void *FramePool::allocate(size_t const size) {
+        if (size == 0 || size > MAX_POOLED_SIZE) {
+            std::lock_guard lock(m_mutex);
+            m_stats.largeFrames += 1;
+            return ::operator new(size);
+        }
+
+        size_t const    sizeClass = (size - 1) / CLASS_SIZE;
+        std::lock_guard lock(m_mutex);
+        if (m_freeLists[sizeClass] == nullptr) {
+            refill(sizeClass);
+        }
+
+        FreeBlock *block       = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block->next;
+        m_stats.liveFrames += 1;
+        return block;
+    }
+
+    void FramePool::deallocate(void *const block, size_t const size) {
+        if (size == 0 || size > MAX_POOLED_SIZE) {
+            ::operator delete(block);
+            return;
+        }
+
+        auto *const     freed     = static_cast<FreeBlock *>(block);
+        size_t const    sizeClass = (size - 1) / CLASS_SIZE;
+        std::lock_guard lock(m_mutex);
+        freed->next            = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = freed;
+        m_stats.liveFrames -= 1;
+    }
+
+    FramePoolStats FramePool::getStats() {
+        std::lock_guard lock(m_mutex);
+        return m_stats;
+    }
+
+} // namespace YerbEngine
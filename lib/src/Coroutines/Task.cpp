@@ -0,0 +1,108 @@
+#include <Coroutines/Task.hpp>
+
+#include <SDL.h>
+#include <algorithm>
+#include <utility>
+
+namespace YerbEngine {
+
+    void Task::promise_type::unhandled_exception() {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                     "A task ended with an uncaught exception.");
+        // Propagates out of whoever resumed the task. The frame stays on the
+        // scheduler's live list until it is cancelled.
+        throw;
+    }
+
+    Task::promise_type::~promise_type() {
+        if (scheduler != nullptr) {
+            scheduler->unlink(*this);
+        }
+    }
+
+    TaskEvent::TaskEvent(TaskScheduler &scheduler) : m_scheduler(scheduler) {
+        m_scheduler.m_events.push_back(this);
+    }
+
+    TaskEvent::~TaskEvent() { std::erase(m_scheduler.m_events, this); }
+
+    void TaskEvent::signal() {
+        m_scheduler.m_ready.insert(m_scheduler.m_ready.end(),
+                                   m_waiters.begin(), m_waiters.end());
+        m_waiters.clear();
+    }
+
+    void TaskScheduler::WaitFor::await_suspend(
+        std::coroutine_handle<> const handle) const {
+        scheduler.m_timers.push({.wakeTime = scheduler.m_now + milliseconds,
+                                 .sequence = scheduler.m_sequence++,
+                                 .handle   = handle});
+    }
+
+    TaskScheduler::~TaskScheduler() { cancelAll(); }
+
+    void TaskScheduler::unlink(Task::promise_type &promise) {
+        if (promise.previous != nullptr) {
+            promise.previous->next = promise.next;
+        } else {
+            m_live = promise.next;
+        }
+        if (promise.next != nullptr) {
+            promise.next->previous = promise.previous;
+        }
+        promise.scheduler = nullptr;
+        m_taskCount -= 1;
+    }
+
+    void TaskScheduler::spawn(Task task) {
+        Task::Handle const handle = std::exchange(task.m_handle, nullptr);
+        if (!handle) {
+            return;
+        }
+
+        Task::promise_type &promise = handle.promise();
+        promise.scheduler           = this;
+        promise.next                = m_live;
+        if (m_live != nullptr) {
+            m_live->previous = &promise;
+        }
+        m_live = &promise;
+        m_taskCount += 1;
+
+        handle.resume();
+    }
+
+    void TaskScheduler::update(double const elapsedMs) {
+        double const target = m_now + elapsedMs;
+
+        while (!m_timers.empty() && m_timers.top().wakeTime <= target) {
+            Timer const timer = m_timers.top();
+            m_timers.pop();
+            m_now = timer.wakeTime;
+            timer.handle.resume();
+        }
+        m_now = target;
+
+        // Tasks that wait for the next frame again land in m_ready and run
+        // on the following update.
+        std::swap(m_resuming, m_ready);
+        for (std::coroutine_handle<> const handle : m_resuming) {
+            handle.resume();
+        }
+        m_resuming.clear();
+    }
+
+    void TaskScheduler::cancelAll() {
+        // Drop every reference to a suspended frame before destroying them.
+        m_timers = {};
+        m_ready.clear();
+        for (TaskEvent *event : m_events) {
+            event->m_waiters.clear();
+        }
+
+        while (m_live != nullptr) {
+            Task::Handle::from_promise(*m_live).destroy();
+        }
+    }
+
+} // namespace YerbEngine
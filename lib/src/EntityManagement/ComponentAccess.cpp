@@ -0,0 +1,37 @@
+#include <EntityManagement/ComponentAccess.hpp>
+
+#include <Profiling/Metrics.hpp>
+#include <SDL.h>
+
+namespace YerbEngine::ComponentAccess {
+
+    SystemAccessScope *&currentScope() {
+        thread_local SystemAccessScope *scope = nullptr;
+        return scope;
+    }
+
+    void reportUndeclared(std::type_index const type,
+                          bool const            write) {
+        SystemAccessScope *scope = currentScope();
+        if (scope == nullptr) {
+            return;
+        }
+
+        scope->violations += 1;
+        if (std::ranges::find(*scope->reported, type) !=
+            scope->reported->end()) {
+            return;
+        }
+        scope->reported->push_back(type);
+        SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                     "System '%s' %s %s without declaring it",
+                     scope->systemName, write ? "wrote" : "read", type.name());
+    }
+
+    void countLookup() {
+        static Counter &lookups =
+            MetricsRegistry::global().counter("components.lookups");
+        lookups.add();
+    }
+
+} // namespace YerbEngine::ComponentAccess
@@ -1,9 +1,17 @@
 #include <EntityManagement/Entity.hpp>
 #include <EntityManagement/EntityManager.hpp>
+#include <Profiling/Metrics.hpp>
+#include <Profiling/Profiler.hpp>
 #include <ranges>
+#include <sstream>
 
 namespace YerbEngine {
 
+    namespace {
+        constexpr size_t TAG_COUNT =
+            static_cast<size_t>(EntityTags::Default) + 1;
+    } // namespace
+
     std::shared_ptr<Entity> EntityManager::addEntity(EntityTags const tag) {
         auto entityToAdd = std::shared_ptr<Entity>(
             new Entity(m_totalEntities++, tag, m_components));
@@ -17,6 +25,14 @@ namespace YerbEngine {
         return m_entityMap[tag];
     }
 
+    EntityList const &EntityManager::getEntities() const { return m_entities; }
+
+    EntityList const &EntityManager::getEntities(EntityTags const tag) const {
+        static EntityList const empty;
+        auto const              it = m_entityMap.find(tag);
+        return it != m_entityMap.end() ? it->second : empty;
+    }
+
     ComponentRegistry &EntityManager::components() { return *m_components; }
 
     ComponentRegistry const &EntityManager::components() const {
@@ -24,6 +40,7 @@ namespace YerbEngine {
     }
 
     void EntityManager::update() {
+        YERB_ZONE("Entity update");
         auto removeDeadEntities = [this](EntityList &entityVec) -> void {
             std::erase_if(entityVec, [this](auto &entity) {
                 if (!entity->isActive()) {
@@ -48,6 +65,31 @@ namespace YerbEngine {
         }
 
         m_toAdd.clear();
+
+        if (m_totalGauge == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < TAG_COUNT; ++i) {
+            auto const it = m_entityMap.find(static_cast<EntityTags>(i));
+            m_tagGauges[i]->set(
+                it != m_entityMap.end() ? static_cast<double>(it->second.size())
+                                        : 0.0);
+        }
+        m_totalGauge->set(static_cast<double>(m_entities.size()));
+    }
+
+    void EntityManager::setMetrics(MetricsRegistry *const metrics) {
+        m_tagGauges.clear();
+        m_totalGauge = nullptr;
+        if (metrics == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < TAG_COUNT; ++i) {
+            std::ostringstream name;
+            name << "entities." << static_cast<EntityTags>(i);
+            m_tagGauges.push_back(&metrics->gauge(name.str()));
+        }
+        m_totalGauge = &metrics->gauge("entities.total");
     }
 
 } // namespace YerbEngine
@@ -0,0 +1,110 @@
+#include <EntityManagement/LifespanTracker.hpp>
+
+#include <algorithm>
+
+namespace YerbEngine {
+
+    namespace {
+        Uint64 expiryOf(Components::CLifespan const &lifespan) {
+            return lifespan.birthTime + lifespan.lifespan;
+        }
+
+        Uint64 windowOf(Components::CLifespan const &lifespan,
+                        Uint64 const                 fadeWindow) {
+            return lifespan.fades ? std::min(fadeWindow, lifespan.lifespan)
+                                  : 0;
+        }
+    } // namespace
+
+    LifespanTracker::LifespanTracker(Uint64 const fadeWindow)
+        : m_fadeWindow(fadeWindow) {}
+
+    void LifespanTracker::schedule(std::shared_ptr<Entity> const &entity,
+                                   Components::CLifespan         &lifespan) {
+        Uint64 const expiry    = expiryOf(lifespan);
+        Uint64 const fadeStart = expiry - windowOf(lifespan, m_fadeWindow);
+
+        if (now() < fadeStart) {
+            lifespan.timer = m_timers.schedule(fadeStart, entity);
+            return;
+        }
+
+        if (lifespan.fades) {
+            m_fading.push_back(entity);
+        }
+        lifespan.timer = m_timers.schedule(expiry, entity);
+    }
+
+    void LifespanTracker::track(std::shared_ptr<Entity> const &entity) {
+        auto const &cLifespan = entity->getComponent<Components::CLifespan>();
+        if (cLifespan == nullptr) {
+            return;
+        }
+
+        cLifespan->birthTime = now();
+        schedule(entity, *cLifespan);
+    }
+
+    void LifespanTracker::retime(std::shared_ptr<Entity> const &entity) {
+        auto const &cLifespan = entity->getComponent<Components::CLifespan>();
+        if (cLifespan == nullptr) {
+            return;
+        }
+
+        m_timers.cancel(cLifespan->timer);
+        std::erase(m_fading, entity);
+        schedule(entity, *cLifespan);
+    }
+
+    void LifespanTracker::advance(Uint64 const now, EntityList &expired) {
+        m_timers.advance(now, [&](std::weak_ptr<Entity> const &weakEntity) {
+            std::shared_ptr<Entity> const entity = weakEntity.lock();
+            if (entity == nullptr || !entity->isActive()) {
+                return;
+            }
+
+            auto const &cLifespan =
+                entity->getComponent<Components::CLifespan>();
+            if (cLifespan == nullptr) {
+                return;
+            }
+
+            // Either the final window opened or the lifespan is over.
+            Uint64 const expiry = expiryOf(*cLifespan);
+            if (m_timers.now() >= expiry) {
+                cLifespan->timer = 0;
+                expired.push_back(entity);
+                return;
+            }
+
+            m_fading.push_back(entity);
+            cLifespan->timer = m_timers.schedule(expiry, entity);
+        });
+
+        std::erase_if(m_fading, [&](std::shared_ptr<Entity> const &entity) {
+            if (!entity->isActive()) {
+                return true;
+            }
+            auto const &cLifespan =
+                entity->getComponent<Components::CLifespan>();
+            return cLifespan == nullptr || now >= expiryOf(*cLifespan);
+        });
+    }
+
+    float LifespanTracker::getFadeProgress(
+        Components::CLifespan const &lifespan) const {
+        Uint64 const window = windowOf(lifespan, m_fadeWindow);
+        Uint64 const expiry = expiryOf(lifespan);
+        if (window == 0 || now() >= expiry) {
+            return 1.0f;
+        }
+
+        Uint64 const fadeStart = expiry - window;
+        if (now() <= fadeStart) {
+            return 0.0f;
+        }
+        return static_cast<float>(now() - fadeStart) /
+               static_cast<float>(window);
+    }
+
+} // namespace YerbEngine
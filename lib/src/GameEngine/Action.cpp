@@ -1,20 +1,53 @@
 #include <GameEngine/Action.hpp>
-#include <Helpers/Vec2.hpp>
-#include <utility>
+
+#include <SDL.h>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 
 namespace YerbEngine {
 
-    Action::Action(std::string                name,
-                   ActionState const         &state,
-                   std::optional<Vec2> const &pos)
-        : m_name(std::move(name)),
-          m_state(state),
-          m_pos(pos) {}
+    namespace {
+        struct NameTable {
+            std::mutex mutex;
+            // A deque never moves its elements, so views into it stay valid.
+            std::deque<std::string>                        names;
+            std::unordered_map<std::string_view, ActionId> ids;
+        };
+
+        NameTable &table() {
+            static NameTable instance;
+            return instance;
+        }
+    } // namespace
+
+    ActionId ActionNames::intern(std::string_view const name) {
+        NameTable      &names = table();
+        std::lock_guard lock(names.mutex);
 
-    std::string const &Action::getName() const { return m_name; }
+        if (auto const it = names.ids.find(name); it != names.ids.end()) {
+            return it->second;
+        }
+        if (names.names.size() >= NO_ACTION) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Too many action names to intern %.*s.",
+                         static_cast<int>(name.size()), name.data());
+            throw std::runtime_error("Too many action names");
+        }
 
-    ActionState const &Action::getState() const { return m_state; }
+        auto const id = static_cast<ActionId>(names.names.size());
+        names.names.emplace_back(name);
+        names.ids.emplace(names.names.back(), id);
+        return id;
+    }
 
-    std::optional<Vec2> const &Action::getPos() const { return m_pos; }
+    std::string_view ActionNames::name(ActionId const id) {
+        NameTable      &names = table();
+        std::lock_guard lock(names.mutex);
+        return id < names.names.size() ? std::string_view{names.names[id]}
+                                       : std::string_view{};
+    }
 
-} // namespace YerbEngine
\ No newline at end of file
+} // namespace YerbEngine
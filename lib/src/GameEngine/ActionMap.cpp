@@ -0,0 +1,62 @@
+#include <GameEngine/ActionMap.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace YerbEngine {
+
+    namespace {
+        constexpr size_t MIN_CAPACITY = 16;
+
+        // Fibonacci hashing: SDL keycodes are either small ASCII values or
+        // scancodes with bit 30 set, which a multiply spreads evenly.
+        size_t hashInput(int32_t const input) {
+            return static_cast<size_t>(static_cast<uint32_t>(input) *
+                                       UINT64_C(0x9E3779B97F4A7C15) >> 32);
+        }
+    } // namespace
+
+    size_t ActionMap::indexOf(int32_t const input) const {
+        size_t const mask  = m_slots.size() - 1;
+        size_t       index = hashInput(input) & mask;
+        while (m_slots[index].action != NO_ACTION &&
+               m_slots[index].input != input) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void ActionMap::grow() {
+        std::vector<Slot> old = std::exchange(
+            m_slots,
+            std::vector<Slot>(std::max(MIN_CAPACITY, m_slots.size() * 2)));
+        for (Slot const &slot : old) {
+            if (slot.action != NO_ACTION) {
+                m_slots[indexOf(slot.input)] = slot;
+            }
+        }
+    }
+
+    void ActionMap::bind(int32_t const input, ActionId const action) {
+        if (action == NO_ACTION) {
+            return;
+        }
+        if ((m_size + 1) * 2 > m_slots.size()) {
+            grow();
+        }
+
+        Slot &slot = m_slots[indexOf(input)];
+        if (slot.action == NO_ACTION) {
+            m_size += 1;
+        }
+        slot = {.input = input, .action = action};
+    }
+
+    ActionId ActionMap::find(int32_t const input) const {
+        if (m_slots.empty()) {
+            return NO_ACTION;
+        }
+        return m_slots[indexOf(input)].action;
+    }
+
+} // namespace YerbEngine
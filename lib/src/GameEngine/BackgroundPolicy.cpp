@@ -0,0 +1,53 @@
+#include <GameEngine/BackgroundPolicy.hpp>
+
+namespace YerbEngine {
+
+    BackgroundPolicy BackgroundSettings::select(bool const hidden,
+                                                bool const focused) const {
+        if (hidden) {
+            return this->hidden;
+        }
+        return focused ? BackgroundPolicy::Run : unfocused;
+    }
+
+    std::optional<BackgroundPolicy>
+    parseBackgroundPolicy(std::string_view const name) {
+        if (name == "run") {
+            return BackgroundPolicy::Run;
+        }
+        if (name == "simulate") {
+            return BackgroundPolicy::Simulate;
+        }
+        if (name == "pause") {
+            return BackgroundPolicy::Pause;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<BackgroundAudio>
+    parseBackgroundAudio(std::string_view const name) {
+        if (name == "keep") {
+            return BackgroundAudio::Keep;
+        }
+        if (name == "duck") {
+            return BackgroundAudio::Duck;
+        }
+        if (name == "pause") {
+            return BackgroundAudio::Pause;
+        }
+        return std::nullopt;
+    }
+
+    char const *toString(BackgroundPolicy const policy) {
+        switch (policy) {
+        case BackgroundPolicy::Run:
+            return "run";
+        case BackgroundPolicy::Simulate:
+            return "simulate";
+        case BackgroundPolicy::Pause:
+            return "pause";
+        }
+        return "unknown";
+    }
+
+} // namespace YerbEngine
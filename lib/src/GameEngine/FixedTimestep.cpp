@@ -0,0 +1,57 @@
+#include <GameEngine/FixedTimestep.hpp>
+
+#include <SDL.h>
+#include <algorithm>
+#include <cmath>
+
+namespace YerbEngine {
+
+    FixedTimestep::FixedTimestep(int const    tickRate,
+                                 size_t const maxStepsPerFrame)
+        : m_tickSeconds(1.0 / DEFAULT_TICK_RATE),
+          m_maxStepsPerFrame(std::max<size_t>(1, maxStepsPerFrame)) {
+        if (tickRate <= 0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Invalid simulation tick rate %d. Using %d.", tickRate,
+                        DEFAULT_TICK_RATE);
+            return;
+        }
+        m_tickSeconds = 1.0 / tickRate;
+    }
+
+    size_t FixedTimestep::advance(double const frameSeconds) {
+        if (frameSeconds > 0.0 && std::isfinite(frameSeconds)) {
+            m_accumulator += frameSeconds;
+        }
+
+        size_t const limit = getStepLimit();
+        auto         steps = static_cast<size_t>(m_accumulator / m_tickSeconds);
+        if (steps > limit) {
+            m_droppedTicks += steps - limit;
+            steps           = limit;
+            // Keep only the sub-tick remainder so interpolation stays smooth
+            // after the clamp.
+            m_accumulator = std::fmod(m_accumulator, m_tickSeconds);
+            return steps;
+        }
+
+        m_accumulator -= static_cast<double>(steps) * m_tickSeconds;
+        m_accumulator = std::max(0.0, m_accumulator); // rounding error
+        return steps;
+    }
+
+    void FixedTimestep::setFrameRate(int const framesPerSecond) {
+        if (framesPerSecond <= 0) {
+            m_stepsPerFrame = 1;
+            return;
+        }
+        // The epsilon keeps an exact ratio such as 60 / 10 from rounding
+        // up to an extra tick.
+        double const ticksPerFrame =
+            1.0 / (static_cast<double>(framesPerSecond) * m_tickSeconds);
+        m_stepsPerFrame =
+            std::max<size_t>(1, static_cast<size_t>(
+                                    std::ceil(ticksPerFrame - 1e-9)));
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,120 @@
+#include <GameEngine/FramePacer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace YerbEngine {
+
+    namespace {
+        double toMilliseconds(FramePacer::Clock::duration const duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    } // namespace
+
+    FramePacer::FramePacer()
+        : m_spinWindow(std::chrono::duration_cast<Clock::duration>(
+              std::chrono::microseconds{1000})) {}
+
+    void FramePacer::setTargetFrameRate(double const framesPerSecond,
+                                        bool const   limit) {
+        if (framesPerSecond <= 0.0 || !std::isfinite(framesPerSecond)) {
+            m_period = Clock::duration{0};
+            m_limit  = false;
+        } else {
+            m_period = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / framesPerSecond));
+            m_limit = limit;
+        }
+        m_hasLastFrame = false;
+        resetStats();
+    }
+
+    double FramePacer::getTargetFrameRate() const {
+        if (m_period.count() <= 0) {
+            return 0.0;
+        }
+        return 1.0 / std::chrono::duration<double>(m_period).count();
+    }
+
+    void FramePacer::waitUntil(Clock::time_point const deadline) {
+        Clock::time_point const sleepUntil = deadline - m_spinWindow;
+        Clock::time_point       now        = Clock::now();
+        if (now < sleepUntil) {
+            std::this_thread::sleep_until(sleepUntil);
+            now = Clock::now();
+
+            // Track how far past the requested wake-up the OS let us sleep,
+            // and keep the spin window at roughly twice that.
+            Clock::duration const oversleep =
+                std::max(Clock::duration{0}, now - sleepUntil);
+            Clock::duration const target = std::clamp(
+                oversleep * 2,
+                std::chrono::duration_cast<Clock::duration>(MIN_SPIN_WINDOW),
+                std::chrono::duration_cast<Clock::duration>(MAX_SPIN_WINDOW));
+            m_spinWindow += (target - m_spinWindow) / 8;
+        }
+
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    void FramePacer::record(Clock::time_point const frameEnd,
+                            Clock::time_point const deadline) {
+        double const errorMs = toMilliseconds(frameEnd - deadline);
+
+        m_errorSumMs        += std::abs(errorMs);
+        m_stats.frames      += 1;
+        m_stats.lastErrorMs  = errorMs;
+        m_stats.maxErrorMs   = std::max(m_stats.maxErrorMs, std::abs(errorMs));
+        m_stats.meanErrorMs =
+            m_errorSumMs / static_cast<double>(m_stats.frames);
+        if (errorMs > toMilliseconds(m_period) / 2) {
+            m_stats.missedDeadlines += 1;
+        }
+    }
+
+    void FramePacer::endFrame() {
+        if (m_period.count() <= 0) {
+            return;
+        }
+
+        Clock::time_point const now = Clock::now();
+        if (!m_hasLastFrame) {
+            m_hasLastFrame = true;
+            m_lastFrameEnd = now;
+            m_deadline     = now + m_period;
+            return;
+        }
+
+        if (!m_limit) {
+            // Measure only: the expected frame end is one period after the
+            // previous one.
+            record(now, m_lastFrameEnd + m_period);
+            m_stats.lastFrameMs = toMilliseconds(now - m_lastFrameEnd);
+            m_lastFrameEnd      = now;
+            return;
+        }
+
+        if (now < m_deadline) {
+            waitUntil(m_deadline);
+        }
+
+        Clock::time_point const frameEnd = Clock::now();
+        record(frameEnd, m_deadline);
+        m_stats.lastFrameMs = toMilliseconds(frameEnd - m_lastFrameEnd);
+        m_lastFrameEnd      = frameEnd;
+
+        m_deadline += m_period;
+        if (m_deadline < frameEnd) {
+            m_deadline = frameEnd + m_period; // too late to catch up
+        }
+    }
+
+    void FramePacer::resetStats() {
+        m_stats      = FramePacingStats{};
+        m_errorSumMs = 0.0;
+    }
+
+} // namespace YerbEngine
@@ -1,6 +1,10 @@
 #include <GameEngine/GameEngine.hpp>
 #include <GameScenes/Scene.hpp>
+#include <Profiling/AllocationTracker.hpp>
+#include <Profiling/Profiler.hpp>
 #include <SystemManagement/VideoManager.hpp>
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #ifdef __EMSCRIPTEN__
@@ -77,23 +81,64 @@ namespace YerbEngine {
             std::make_unique<JsonConfigProvider>(ENGINE_CONFIG_FILE_PATH)));
         m_configAdapter = std::make_unique<ConfigAdapter>(*m_configStore);
 
+        m_headless = m_configAdapter->getGameConfig().headless;
+        if (m_headless) {
+            // Only events are needed, so SIGINT still arrives as SDL_QUIT.
+            if (SDL_Init(SDL_INIT_EVENTS) != 0) {
+                SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                            "SDL events unavailable: %s", SDL_GetError());
+            }
+            audioOptions.nullDevice = true;
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Running headless: no window or audio device.");
+        }
+
         m_audioManager =
             std::make_unique<AudioManager>(std::move(audioOptions));
 
         m_audioSampleBuffer =
-            std::make_unique<AudioSampleBuffer>(*m_audioManager);
+            std::make_unique<AudioSampleBuffer>(*m_audioManager, m_simClock);
 
         {
             auto const gameCfg = m_configAdapter->getGameConfig();
             m_fontManager      = std::make_unique<FontManager>(
                 gameCfg.fontPath, gameCfg.fontSizeSm, gameCfg.fontSizeMd,
                 gameCfg.fontSizeLg);
+            m_jobSystem = std::make_unique<JobSystem>(
+                static_cast<size_t>(std::max(0, gameCfg.workerThreads)));
+            m_fixedTimestep = FixedTimestep(
+                gameCfg.simulationTickRate,
+                static_cast<size_t>(std::max(1, gameCfg.maxSimulationSteps)));
+            m_simClock.setTimeScale(gameCfg.simulationTimeScale);
+            m_simClock.setUnthrottled(
+                gameCfg.unthrottled,
+                static_cast<size_t>(
+                    std::max(1, gameCfg.unthrottledTicksPerFrame)));
         }
 
-        m_videoManager = std::make_unique<VideoManager>(*m_configAdapter);
+        m_videoManager =
+            std::make_unique<VideoManager>(*m_configAdapter, m_headless);
 
         m_textureManager =
             std::make_unique<TextureManager>(m_videoManager->getRenderer());
+        m_textureManager->setJobSystem(m_jobSystem.get());
+
+        configureFramePacing(m_configAdapter->getGameConfig());
+        configureReplay(m_configAdapter->getGameConfig());
+
+        m_lateLatch = m_configAdapter->getGameConfig().lateInputLatch;
+        if (m_lateLatch && (m_recorder != nullptr || m_replay != nullptr)) {
+            // Actions latched mid-frame would replay at the start of the
+            // next one, so a recording would no longer reproduce the run.
+            m_lateLatch = false;
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Late input latching is off while recording or "
+                        "replaying.");
+        }
+        configureGovernor(m_configAdapter->getGameConfig());
+        configureBackground(m_configAdapter->getGameConfig());
+        configureProfiler(m_configAdapter->getGameConfig());
+        configureMetrics(m_configAdapter->getGameConfig());
 
         m_isRunning = true;
 
@@ -101,7 +146,14 @@ namespace YerbEngine {
                     "Game engine initialized successfully!");
     }
 
-    GameEngine::~GameEngine() { CleanUp(); }
+    GameEngine::~GameEngine() {
+        // Let background preparations finish, and scenes release what they
+        // hold, while SDL is still up.
+        m_preparing.clear();
+        m_prepared.clear();
+        m_sceneStack.clear();
+        CleanUp();
+    }
 
     void GameEngine::CleanUp() {
         SDL_Quit();
@@ -110,29 +162,582 @@ namespace YerbEngine {
     }
 
     void GameEngine::Update() {
-        std::shared_ptr<Scene> const &activeScene =
-            m_scenes[m_currentSceneName];
+        YERB_ZONE("Update");
+
+        // Held by value: a tick may pop or replace the scene.
+        std::shared_ptr<Scene> const activeScene = getActiveScene();
         if (activeScene == nullptr) {
             return;
         }
 
-        activeScene->update();
+        auto const now          = std::chrono::steady_clock::now();
+        double     frameSeconds = 0.0;
+        if (m_hasLastFrameTime) {
+            frameSeconds =
+                std::chrono::duration<double>(now - m_lastFrameTime).count();
+            m_frameTimeUs->recordDuration(now - m_lastFrameTime);
+            m_runFrameTimeUs.recordDuration(now - m_lastFrameTime);
+        }
+        m_lastFrameTime    = now;
+        m_hasLastFrameTime = true;
+
+        size_t steps = 0;
+        if (m_replay != nullptr) {
+            checkReplayConfig();
+            if (!m_replay->nextFrame(steps, m_replayActions)) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Replay finished.");
+                quit();
+                return;
+            }
+            // Recorded actions were dispatched before the frame's systems.
+            for (Action &action : m_replayActions) {
+                dispatchAction(*activeScene, action);
+            }
+        }
+
+        SystemPipeline &systems = activeScene->getSystems();
+        systems.run(SystemPhase::Input);
+        latchInput();
+
+        if (m_replay != nullptr) {
+            // The recorded tick count, whatever the time since last frame.
+            m_fixedTimestep.reset();
+        } else if (m_simClock.isUnthrottled()) {
+            // Real time plays no part; leftover time from before the switch
+            // would otherwise be replayed once throttling resumes.
+            steps = m_simClock.getUnthrottledTicks();
+            m_fixedTimestep.reset();
+        } else {
+            steps = m_fixedTimestep.advance(m_simClock.scale(frameSeconds));
+        }
+
+        double const tickSeconds = m_fixedTimestep.getTickSeconds();
+        for (size_t step = 0; step < steps; ++step) {
+            YERB_ZONE("Fixed tick");
+            m_simClock.tick(tickSeconds);
+            activeScene->fixedUpdate(static_cast<float>(tickSeconds));
+        }
+        if (m_recorder != nullptr) {
+            m_recorder->endFrame(steps);
+        }
+
+        if (m_background == BackgroundPolicy::Simulate) {
+            // Scenes draw from update() too, so it waits for the window to
+            // come back, but a match that ended in the background still
+            // moves on to its next scene.
+            if (activeScene->isEndTriggered()) {
+                activeScene->onEnd();
+            }
+            return;
+        }
+
+        activeScene->setInterpolationAlpha(m_fixedTimestep.alpha());
+        latchInput();
+        if (!m_headless) {
+            systems.run(SystemPhase::Render);
+        }
+        {
+            YERB_ZONE("Scene update");
+            activeScene->update();
+        }
+        notePresent();
+    }
+
+    void GameEngine::configureBackground(GameConfig const &gameConfig) {
+        auto const policyOr = [](std::string const     &name,
+                                 BackgroundPolicy const fallback,
+                                 char const            *key) {
+            std::optional<BackgroundPolicy> const policy =
+                parseBackgroundPolicy(name);
+            if (!policy.has_value()) {
+                SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                            "Unknown %s '%s'; using '%s'.", key, name.c_str(),
+                            toString(fallback));
+            }
+            return policy.value_or(fallback);
+        };
+
+        BackgroundSettings settings;
+        settings.unfocused = policyOr(gameConfig.backgroundUnfocused,
+                                      settings.unfocused,
+                                      "engine.background.unfocused");
+        settings.hidden    = policyOr(gameConfig.backgroundHidden,
+                                      settings.hidden,
+                                      "engine.background.hidden");
+        settings.simulateFrameRate =
+            std::max(1, gameConfig.backgroundFrameRate);
+        settings.duckVolume = gameConfig.backgroundDuckVolume;
+
+        if (std::optional<BackgroundAudio> const audio =
+                parseBackgroundAudio(gameConfig.backgroundAudio)) {
+            settings.audio = *audio;
+        } else {
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Unknown engine.background.audio '%s'; ducking.",
+                        gameConfig.backgroundAudio.c_str());
+        }
+        m_backgroundSettings = settings;
+    }
+
+    void GameEngine::updateBackground() {
+        bool const inBackground = m_windowHidden || !m_windowFocused;
+        if (inBackground != m_inBackground) {
+            m_inBackground = inBackground;
+            switch (m_backgroundSettings.audio) {
+            case BackgroundAudio::Keep:
+                break;
+            case BackgroundAudio::Duck:
+                if (inBackground) {
+                    m_audioManager->duck(m_backgroundSettings.duckVolume);
+                } else {
+                    m_audioManager->unduck();
+                }
+                break;
+            case BackgroundAudio::Pause:
+                if (inBackground) {
+                    m_audioManager->pauseAll();
+                } else {
+                    m_audioManager->resumeAll();
+                }
+                break;
+            }
+        }
+
+        BackgroundPolicy const policy =
+            m_backgroundSettings.select(m_windowHidden, m_windowFocused);
+        if (policy == m_background) {
+            return;
+        }
+        m_background = policy;
+
+        // Time spent away is not caught up on, whichever way this goes.
+        // Simulated frames come at a low rate, so each one runs several
+        // ticks and the simulation keeps up with wall time.
+        m_fixedTimestep.reset();
+        int const framesPerSecond = policy == BackgroundPolicy::Simulate
+                                        ? m_backgroundSettings.simulateFrameRate
+                                        : 0;
+        m_fixedTimestep.setFrameRate(framesPerSecond);
+        m_hasLastFrameTime    = false;
+        m_nextBackgroundFrame = std::chrono::steady_clock::now();
+
+        if (policy == BackgroundPolicy::Run) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Window in the foreground.");
+        } else if (policy == BackgroundPolicy::Simulate) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Window in the background: simulating at %d FPS "
+                        "without rendering.",
+                        m_backgroundSettings.simulateFrameRate);
+        } else {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Window in the background: paused.");
+        }
+    }
+
+    bool GameEngine::isFrameDue() {
+        switch (m_background) {
+        case BackgroundPolicy::Run:
+            return true;
+        case BackgroundPolicy::Pause:
+            return false;
+        case BackgroundPolicy::Simulate:
+            break;
+        }
+
+        using Clock    = std::chrono::steady_clock;
+        auto const now = Clock::now();
+        if (now < m_nextBackgroundFrame) {
+            return false; // woken early by an event
+        }
+        m_nextBackgroundFrame =
+            now + std::chrono::duration_cast<Clock::duration>(
+                      std::chrono::duration<double>(
+                          1.0 / m_backgroundSettings.simulateFrameRate));
+        return true;
+    }
+
+    void GameEngine::waitInBackground() {
+        // Paused, the loop still wakes now and then, e.g. to notice a
+        // preparation finishing or a quit request that came some other way.
+        constexpr int PAUSED_WAKE_MS = 250;
+
+        int timeoutMs = PAUSED_WAKE_MS;
+        if (m_background == BackgroundPolicy::Simulate) {
+            auto const remaining =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    m_nextBackgroundFrame - std::chrono::steady_clock::now());
+            timeoutMs =
+                static_cast<int>(std::max<int64_t>(0, remaining.count()));
+        }
+        if (timeoutMs > 0) {
+            // Returns as soon as an event is queued, without taking it.
+            SDL_WaitEventTimeout(nullptr, timeoutMs);
+        }
+    }
+
+    void GameEngine::configureProfiler(GameConfig const &gameConfig) {
+        m_profilerOutput = gameConfig.profilerOutput;
+        if (!gameConfig.profilerHotkey.empty()) {
+            m_profilerHotkey =
+                SDL_GetKeyFromName(gameConfig.profilerHotkey.c_str());
+            if (m_profilerHotkey == SDLK_UNKNOWN) {
+                SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                            "Unknown engine.profiler.hotkey '%s'.",
+                            gameConfig.profilerHotkey.c_str());
+            }
+        }
+
+        Profiler::setThreadName("Main");
+        if (gameConfig.profilerCapture) {
+            Profiler::startCapture();
+        }
+    }
+
+    void GameEngine::toggleProfiler() {
+        if (!Profiler::isCapturing()) {
+            Profiler::startCapture();
+            return;
+        }
+
+        Profiler::stopCapture();
+        try {
+            Profiler::writeChromeTrace(m_profilerOutput);
+        } catch (std::runtime_error const &) {
+            // Already logged; a lost trace should not stop the game.
+        }
+    }
+
+    void GameEngine::configureMetrics(GameConfig const &gameConfig) {
+        MetricsRegistry &metrics = MetricsRegistry::global();
+        m_frameTimeUs            = &metrics.histogram("frame.time", "us");
+        m_frameWorkUs            = &metrics.histogram("frame.work", "us");
+
+        m_frameAllocations =
+            &metrics.histogram("frame.allocations", "allocs");
+        AllocationTracker::setSiteTracking(gameConfig.allocationSites);
+
+        if (gameConfig.metricsOutput.empty()) {
+            return;
+        }
+        try {
+            m_metricsFile =
+                std::make_unique<MetricsFile>(gameConfig.metricsOutput);
+        } catch (std::runtime_error const &) {
+            return; // already logged; run without writing metrics
+        }
+        m_metricsInterval = std::chrono::milliseconds(
+            std::max(0, gameConfig.metricsIntervalMs));
+        m_nextMetricsWindow =
+            std::chrono::steady_clock::now() + m_metricsInterval;
+        // Start the first window now rather than at registry creation.
+        static_cast<void>(metrics.closeWindow());
+    }
+
+    void GameEngine::writeMetricsWindow() {
+        if (m_metricsFile == nullptr) {
+            return;
+        }
+        try {
+            m_metricsFile->write(MetricsRegistry::global().closeWindow());
+        } catch (std::runtime_error const &) {
+            // Already logged; stop writing rather than fail every window.
+            m_metricsFile.reset();
+        }
+    }
+
+    void GameEngine::reportAllocations() const {
+        HistogramStats const perFrame = m_runFrameAllocations.getStats();
+        if (!AllocationTracker::isEnabled() || perFrame.count == 0) {
+            return;
+        }
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Allocations per frame over the run's %llu frames: "
+                    "mean %.1f, p50 %.0f, p99 %.0f, max %.0f.",
+                    static_cast<unsigned long long>(perFrame.count),
+                    perFrame.mean, perFrame.p50, perFrame.p99, perFrame.max);
+        if (AllocationTracker::isSiteTracking()) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Top allocation sites:");
+            AllocationTracker::logTopSites(10);
+        }
+    }
+
+    void GameEngine::latchInput() {
+        if (m_lateLatch && m_isRunning) {
+            S_UserInput();
+        }
+    }
+
+    std::chrono::steady_clock::duration GameEngine::frameWorkTime(
+        std::chrono::steady_clock::time_point const frameStart,
+        uint64_t const                              presentsBefore) const {
+        auto work = std::chrono::steady_clock::now() - frameStart;
+        if (m_videoManager->getPresentCount() != presentsBefore) {
+            work -= m_videoManager->getLastPresentDuration();
+        }
+        return work;
+    }
+
+    void GameEngine::governFrame(
+        std::chrono::steady_clock::duration const work) {
+        if (!m_governor.isEnabled() || m_simClock.isUnthrottled()) {
+            return;
+        }
+
+        auto const transition = m_governor.recordFrame(
+            std::chrono::duration<double, std::milli>(work).count());
+        if (!transition.has_value()) {
+            return;
+        }
+
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Performance governor: level %zu -> %zu after %zu frames "
+                    "(mean %.2f ms, max %.2f ms, budget %.2f ms).",
+                    transition->from, transition->to, transition->frames,
+                    transition->meanMs, transition->maxMs,
+                    transition->budgetMs);
+        if (std::shared_ptr<Scene> const scene = getActiveScene()) {
+            scene->setQualityLevel(transition->to);
+        }
+    }
+
+    void GameEngine::notePresent() {
+        uint64_t const presents = m_videoManager->getPresentCount();
+        if (presents == m_presentsSeen) {
+            return;
+        }
+        m_presentsSeen = presents;
+        m_inputLatency.notePresent(m_videoManager->getLastPresentTime());
     }
 
     bool GameEngine::IsRunning() const { return m_isRunning; }
 
+    void GameEngine::configureFramePacing(GameConfig const &gameConfig) {
+        constexpr int FALLBACK_REFRESH_RATE = 60;
+
+        if (m_headless) {
+            // Nothing is presented, so nothing is worth waiting for.
+            m_framePacer.setTargetFrameRate(0, false);
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Frame pacing: unlimited (headless).");
+            return;
+        }
+
+        bool const vsyncActive = m_videoManager->isVsyncEnabled();
+        int        refreshRate = m_videoManager->getRefreshRate();
+        if (refreshRate <= 0) {
+            refreshRate = FALLBACK_REFRESH_RATE;
+        }
+
+        if (gameConfig.targetFps > 0) {
+            m_framePacer.setTargetFrameRate(gameConfig.targetFps, true);
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Frame pacing: limited to %d FPS (vsync %s).",
+                        gameConfig.targetFps, vsyncActive ? "on" : "off");
+            return;
+        }
+
+        if (vsyncActive) {
+            m_framePacer.setTargetFrameRate(refreshRate, false);
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Frame pacing: vsync at %d Hz.", refreshRate);
+            return;
+        }
+
+        if (gameConfig.vsync) {
+            m_framePacer.setTargetFrameRate(refreshRate, true);
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Vsync unavailable. Limiting to %d FPS instead.",
+                        refreshRate);
+            return;
+        }
+
+        m_framePacer.setTargetFrameRate(0, false);
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Frame pacing: unlimited.");
+    }
+
+    void GameEngine::configureGovernor(GameConfig const &gameConfig) {
+        if (!gameConfig.governorEnabled) {
+            return;
+        }
+        if (m_headless) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Performance governor: off (headless).");
+            return;
+        }
+        if (m_recorder != nullptr || m_replay != nullptr) {
+            // Levels follow this machine's load, and scenes may change what
+            // they spawn, so a recording would not reproduce the run.
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Performance governor: off while recording or "
+                        "replaying.");
+            return;
+        }
+
+        double budgetMs = gameConfig.governorBudgetMs;
+        if (budgetMs <= 0.0 && m_framePacer.getTargetFrameRate() > 0.0) {
+            budgetMs = 1000.0 / m_framePacer.getTargetFrameRate();
+        }
+        if (budgetMs <= 0.0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Performance governor: off, no frame budget (set "
+                        "engine.governor.budgetMs or a frame rate).");
+            return;
+        }
+
+        m_governor = PerformanceGovernor(GovernorSettings{
+            .budgetMs     = budgetMs,
+            .windowFrames = static_cast<size_t>(
+                std::max(1, gameConfig.governorWindowFrames)),
+            .degradeAbove = gameConfig.governorDegradeAbove,
+            .recoverBelow = gameConfig.governorRecoverBelow,
+            .holdFrames   = static_cast<size_t>(
+                std::max(0, gameConfig.governorHoldFrames)),
+            .maxLevel =
+                static_cast<size_t>(std::max(0, gameConfig.governorLevels))});
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Performance governor: %.2f ms budget, %d levels.",
+                    budgetMs, gameConfig.governorLevels);
+    }
+
+    void GameEngine::configureReplay(GameConfig const &gameConfig) {
+        if (!gameConfig.replayPlayPath.empty()) {
+            m_replay = std::make_unique<InputReplay>(gameConfig.replayPlayPath);
+            m_seed   = m_replay->getHeader().seed;
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Replaying input from %s.",
+                        gameConfig.replayPlayPath.c_str());
+        } else {
+            std::random_device device;
+            m_seed = (static_cast<uint64_t>(device()) << 32) | device();
+        }
+        m_seedSequence.seed(m_seed);
+
+        if (!gameConfig.replayRecordPath.empty()) {
+            m_recorder   = std::make_unique<InputRecorder>();
+            m_recordPath = gameConfig.replayRecordPath;
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Recording input to %s.",
+                        gameConfig.replayRecordPath.c_str());
+        }
+    }
+
+    void GameEngine::dispatchAction(Scene &scene, Action &action) {
+        if (m_recorder != nullptr) {
+            m_recorder->recordAction(action);
+        }
+        scene.sDoAction(action);
+    }
+
+    std::vector<std::pair<std::string, uint64_t>>
+    GameEngine::getConfigHashes() const {
+        std::vector<std::pair<std::string, uint64_t>> hashes;
+        hashes.emplace_back("engine", m_configStore->hash());
+        for (auto const &[name, store] : m_namedStores) {
+            hashes.emplace_back(name, store->hash());
+        }
+        return hashes;
+    }
+
+    void GameEngine::checkReplayConfig() {
+        // Deferred to the first frame so configs added after construction
+        // are compared too.
+        if (m_replayChecked) {
+            return;
+        }
+        m_replayChecked = true;
+
+        auto const current = getConfigHashes();
+        for (auto const &[name, hash] : m_replay->getHeader().configHashes) {
+            auto const it = std::ranges::find(
+                current, name, &std::pair<std::string, uint64_t>::first);
+            if (it == current.end() || it->second != hash) {
+                SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                            "Config '%s' differs from the recording; the "
+                            "replay may diverge.",
+                            name.c_str());
+            }
+        }
+    }
+
+    void GameEngine::saveRecording() {
+        if (m_recorder == nullptr) {
+            return;
+        }
+
+        ReplayHeader const header{.seed         = m_seed,
+                                  .configHashes = getConfigHashes()};
+        try {
+            m_recorder->save(m_recordPath, header);
+        } catch (std::runtime_error const &) {
+            // Already logged; losing the recording should not stop shutdown.
+        }
+        m_recorder.reset();
+    }
+
     void GameEngine::run() {
 #ifdef __EMSCRIPTEN__
-        emscripten_set_main_loop_arg(MainLoop, this, 0, 1);
+        // The browser paces requestAnimationFrame itself; a fixed rate is
+        // only passed on when the pacer is limiting.
+        int const fps =
+            m_framePacer.isLimiting()
+                ? static_cast<int>(
+                      std::lround(m_framePacer.getTargetFrameRate()))
+                : 0;
+        emscripten_set_main_loop_arg(MainLoop, this, fps, 1);
 #else
         while (m_isRunning) {
             MainLoop(this);
+            if (m_background != BackgroundPolicy::Run) {
+                waitInBackground();
+            } else if (!m_simClock.isUnthrottled()) {
+                m_framePacer.endFrame();
+            }
         }
 #endif
     }
 
     void GameEngine::quit() {
         SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Quitting game engine...");
+        saveRecording();
+        if (Profiler::isCapturing()) {
+            toggleProfiler();
+        }
+
+        HistogramStats const frameTime = m_runFrameTimeUs.getStats();
+        if (frameTime.count > 0) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Frame time over the run's %llu frames: p50 %.2f ms, "
+                        "p95 %.2f ms, p99 %.2f ms, max %.2f ms.",
+                        static_cast<unsigned long long>(frameTime.count),
+                        frameTime.p50 / 1000.0, frameTime.p95 / 1000.0,
+                        frameTime.p99 / 1000.0, frameTime.max / 1000.0);
+        }
+        reportAllocations();
+        writeMetricsWindow();
+        m_metricsFile.reset();
+
+        FramePacingStats const &stats = m_framePacer.getStats();
+        if (stats.frames > 0) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Frame pacing over %zu frames: mean error %.3f ms, "
+                        "max %.3f ms, %zu missed deadlines.",
+                        stats.frames, stats.meanErrorMs, stats.maxErrorMs,
+                        stats.missedDeadlines);
+        }
+        InputLatencyStats const latency = m_inputLatency.getStats();
+        if (latency.frames > 0) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Input to present over %zu frames: p50 %.2f ms, "
+                        "p95 %.2f ms, p99 %.2f ms, max %.2f ms.",
+                        latency.frames, latency.p50Ms, latency.p95Ms,
+                        latency.p99Ms, latency.maxMs);
+        }
+        if (m_governor.getTransitionCount() > 0) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "Performance governor: %zu transitions, ended at "
+                        "level %zu.",
+                        m_governor.getTransitionCount(),
+                        m_governor.getLevel());
+        }
 #ifdef __EMSCRIPTEN__
         emscripten_cancel_main_loop();
 #else
@@ -140,12 +745,141 @@ namespace YerbEngine {
 #endif
     }
 
+    std::shared_ptr<Scene> GameEngine::getActiveScene() const {
+        return m_sceneStack.empty() ? nullptr : m_sceneStack.back().scene;
+    }
+
+    void GameEngine::activateScene(Scene &scene) {
+        scene.completePreparation();
+        scene.setQualityLevel(m_governor.getLevel());
+        // Suspended scenes neither tick nor update their entities, so
+        // only this scene writes the shared system and entity metrics.
+        scene.publishMetrics(MetricsRegistry::global());
+
+        // The scene starts from a clean tick instead of catching up on time
+        // spent in the old one (or in its constructor).
+        m_fixedTimestep.reset();
+        m_hasLastFrameTime = false;
+    }
+
     void GameEngine::LoadScene(std::string const            &sceneName,
                                std::shared_ptr<Scene> const &scene) {
-        m_scenes[sceneName] = scene;
+        m_sceneStack.clear();
+        m_sceneStack.push_back({sceneName, scene});
+        scene->setStartTime(m_simClock.now());
+        activateScene(*scene);
+    }
+
+    void GameEngine::PushScene(std::string const            &sceneName,
+                               std::shared_ptr<Scene> const &scene) {
+        if (!m_sceneStack.empty()) {
+            m_sceneStack.back().scene->onSuspend();
+        }
+        m_sceneStack.push_back({sceneName, scene});
+        scene->setStartTime(m_simClock.now());
+        activateScene(*scene);
+    }
+
+    void GameEngine::ReplaceScene(std::string const            &sceneName,
+                                  std::shared_ptr<Scene> const &scene) {
+        if (m_sceneStack.empty()) {
+            LoadScene(sceneName, scene);
+            return;
+        }
+        m_sceneStack.back() = {sceneName, scene};
+        scene->setStartTime(m_simClock.now());
+        activateScene(*scene);
+    }
+
+    void GameEngine::PopScene() {
+        if (m_sceneStack.size() < 2) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Cannot pop the last scene on the stack.");
+            throw std::runtime_error("Cannot pop the last scene on the stack");
+        }
+        m_sceneStack.pop_back();
+
+        Scene &resumed = *m_sceneStack.back().scene;
+        activateScene(resumed);
+        resumed.onResume();
+    }
+
+    std::shared_ptr<Scene>
+    GameEngine::getScene(std::string const &sceneName) const {
+        auto const it = std::find_if(
+            m_sceneStack.rbegin(), m_sceneStack.rend(),
+            [&](StackedScene const &entry) { return entry.name == sceneName; });
+        return it != m_sceneStack.rend() ? it->scene : nullptr;
+    }
 
-        scene->setStartTime(SDL_GetTicks64());
-        m_currentSceneName = sceneName;
+    void GameEngine::PrepareScene(
+        std::string const                      &sceneName,
+        std::function<std::shared_ptr<Scene>()> factory) {
+        m_prepared.erase(sceneName);
+#ifdef __EMSCRIPTEN__
+        // No threads on the web build: build the scene now. It still waits
+        // in m_preparing, so onPrepared() runs at the start of a frame as
+        // it does elsewhere.
+        std::promise<std::shared_ptr<Scene>> built;
+        try {
+            built.set_value(factory());
+        } catch (...) {
+            built.set_exception(std::current_exception());
+        }
+        m_preparing[sceneName] = built.get_future();
+#else
+        // Assigning over a pending future waits for the old preparation.
+        m_preparing[sceneName] =
+            std::async(std::launch::async, std::move(factory));
+#endif
+    }
+
+    bool GameEngine::hasPreparedScene(std::string const &sceneName) const {
+        return m_preparing.contains(sceneName) ||
+               m_prepared.contains(sceneName);
+    }
+
+    std::shared_ptr<Scene>
+    GameEngine::TakePreparedScene(std::string const &sceneName) {
+        if (auto const it = m_preparing.find(sceneName);
+            it != m_preparing.end()) {
+            std::future<std::shared_ptr<Scene>> pending = std::move(it->second);
+            m_preparing.erase(it);
+            std::shared_ptr<Scene> scene = pending.get();
+            if (scene != nullptr) {
+                scene->completePreparation();
+            }
+            return scene;
+        }
+
+        auto const it = m_prepared.find(sceneName);
+        if (it == m_prepared.end()) {
+            return nullptr;
+        }
+        std::shared_ptr<Scene> scene = std::move(it->second);
+        m_prepared.erase(it);
+        return scene;
+    }
+
+    void GameEngine::pollPreparedScenes() {
+        for (auto it = m_preparing.begin(); it != m_preparing.end();) {
+            if (it->second.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready) {
+                ++it;
+                continue;
+            }
+            // Taken off the list first, so a factory that threw is only
+            // reported once.
+            std::string const                   name  = it->first;
+            std::future<std::shared_ptr<Scene>> ready = std::move(it->second);
+            it = m_preparing.erase(it);
+
+            std::shared_ptr<Scene> scene = ready.get();
+            if (scene != nullptr) {
+                scene->completePreparation();
+            }
+            m_prepared[name] = std::move(scene);
+        }
     }
 
     void GameEngine::AddConfig(std::string const           &name,
@@ -221,9 +955,48 @@ namespace YerbEngine {
         return *m_textureManager;
     }
 
+    JobSystem &GameEngine::getJobSystem() const {
+        if (!m_jobSystem) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "JobSystem not initialized");
+            throw std::runtime_error("JobSystem not initialized");
+        }
+        return *m_jobSystem;
+    }
+
     void GameEngine::S_UserInput() {
+        YERB_ZONE("Input");
         SDL_Event                    event;
-        std::shared_ptr<Scene> const activeScene = m_scenes[m_currentSceneName];
+        std::shared_ptr<Scene> const activeScene = getActiveScene();
+        if (activeScene == nullptr) {
+            return;
+        }
+
+        ActionMap const    &actionMap    = activeScene->getActionMap();
+        ActionId const      motionAction = actionMap.find(SDL_MOUSEMOTION);
+        std::optional<Vec2> motion;
+
+        // SDL timestamps events in SDL_GetTicks milliseconds; their age at
+        // poll time places them on the steady clock presents are timed by.
+        auto const   pollTime  = InputLatencyTracker::Clock::now();
+        Uint32 const pollTicks = SDL_GetTicks();
+        auto const   noteInput = [&](Uint32 const timestamp) {
+            auto const ageMs =
+                std::max(0, static_cast<Sint32>(pollTicks - timestamp));
+            m_inputLatency.noteInput(pollTime -
+                                     std::chrono::milliseconds(ageMs));
+        };
+
+        // Delivers the pending motion before anything that follows it.
+        auto const flushMotion = [&] {
+            if (!motion.has_value()) {
+                return;
+            }
+            if (motionAction != NO_ACTION) {
+                Action action(motionAction, ActionState::START, motion);
+                dispatchAction(*activeScene, action);
+            }
+            motion.reset();
+        };
 
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
@@ -237,33 +1010,77 @@ namespace YerbEngine {
                 case SDL_WINDOWEVENT_RESIZED:
                 case SDL_WINDOWEVENT_SIZE_CHANGED:
                     m_videoManager->updateWindowSize();
-                    activeScene->onSceneWindowResize();
+                    // Suspended scenes too, so they resume at the new size.
+                    for (StackedScene const &entry : m_sceneStack) {
+                        entry.scene->onSceneWindowResize();
+                    }
+                    break;
+                case SDL_WINDOWEVENT_MINIMIZED:
+                case SDL_WINDOWEVENT_HIDDEN:
+                    m_windowHidden = true;
+                    updateBackground();
+                    break;
+                case SDL_WINDOWEVENT_RESTORED:
+                case SDL_WINDOWEVENT_MAXIMIZED:
+                case SDL_WINDOWEVENT_SHOWN:
+                    m_windowHidden = false;
+                    updateBackground();
+                    break;
+                case SDL_WINDOWEVENT_FOCUS_LOST:
+                    m_windowFocused = false;
+                    updateBackground();
+                    break;
+                case SDL_WINDOWEVENT_FOCUS_GAINED:
+                    m_windowFocused = true;
+                    updateBackground();
                     break;
                 default:
                     break;
                 }
             }
 
+            if (event.type == SDL_KEYDOWN && event.key.repeat == 0 &&
+                m_profilerHotkey != SDLK_UNKNOWN &&
+                event.key.keysym.sym == m_profilerHotkey) {
+                toggleProfiler();
+                continue;
+            }
+
+            if (m_replay != nullptr) {
+                continue; // scene input comes from the replay
+            }
+
+            if (event.type == SDL_MOUSEMOTION) {
+                // Only the last position of a run of motion events counts,
+                // so a high-rate mouse costs one action per frame.
+                motion = Vec2{static_cast<float>(event.motion.x),
+                              static_cast<float>(event.motion.y)};
+                if (motionAction != NO_ACTION) {
+                    noteInput(event.motion.timestamp);
+                }
+                continue;
+            }
+
             if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
-                if (!activeScene->getActionMap().contains(
-                        event.key.keysym.sym)) {
+                ActionId const actionId =
+                    actionMap.find(event.key.keysym.sym);
+                if (actionId == NO_ACTION) {
                     continue;
                 }
 
+                flushMotion();
+                noteInput(event.key.timestamp);
                 ActionState const actionState = event.type == SDL_KEYDOWN
                                                     ? ActionState::START
                                                     : ActionState::END;
-
-                std::string const &actionName =
-                    activeScene->getActionMap().at(event.key.keysym.sym);
-                Action action(actionName, actionState, std::nullopt);
-                activeScene->sDoAction(action);
+                Action action(actionId, actionState, std::nullopt);
+                dispatchAction(*activeScene, action);
             }
 
             if (event.type == SDL_MOUSEBUTTONDOWN ||
                 event.type == SDL_MOUSEBUTTONUP) {
-                if (!activeScene->getActionMap().contains(
-                        event.button.button)) {
+                ActionId const actionId = actionMap.find(event.button.button);
+                if (actionId == NO_ACTION) {
                     continue;
                 }
 
@@ -271,41 +1088,26 @@ namespace YerbEngine {
                  * If the event is a mouse button event, set the action state to
                  * start on mouse down, and end on mouse up.
                  */
+                flushMotion();
+                noteInput(event.button.timestamp);
                 ActionState const actionState =
                     event.type == SDL_MOUSEBUTTONDOWN ? ActionState::START
                                                       : ActionState::END;
 
-                std::string const &actionName =
-                    activeScene->getActionMap().at(event.button.button);
-
-                // Get mouse position and convert to game coordinates
-                int mouseX, mouseY;
-                SDL_GetMouseState(&mouseX, &mouseY);
-
-                Vec2 gamePosition{static_cast<float>(mouseX),
-                                  static_cast<float>(mouseY)};
-
-                Action action(actionName, actionState, gamePosition);
-                activeScene->sDoAction(action);
-            }
+                // The position the button changed at, in game coordinates.
+                Vec2 const gamePosition{static_cast<float>(event.button.x),
+                                        static_cast<float>(event.button.y)};
 
-            // Mouse motion handling
-            if (event.type == SDL_MOUSEMOTION &&
-                activeScene->getActionMap().contains(SDL_MOUSEMOTION)) {
-                int mouseX, mouseY;
-                SDL_GetMouseState(&mouseX, &mouseY);
-                Vec2 gamePosition{static_cast<float>(mouseX),
-                                  static_cast<float>(mouseY)};
-
-                std::string const &actionName =
-                    activeScene->getActionMap().at(SDL_MOUSEMOTION);
-                Action action(actionName, ActionState::START, gamePosition);
-                activeScene->sDoAction(action);
+                Action action(actionId, actionState, gamePosition);
+                dispatchAction(*activeScene, action);
             }
         }
+
+        flushMotion();
     }
 
     void GameEngine::MainLoop(void *arg) {
+        YERB_ZONE("Frame");
         auto *gameEngine = static_cast<GameEngine *>(arg);
 #ifdef __EMSCRIPTEN__
         const bool isWebCanvasEnabled = VideoManager::isWebCanvasEnabled();
@@ -314,8 +1116,42 @@ namespace YerbEngine {
             return;
         }
 #endif
+        auto const     frameStart = std::chrono::steady_clock::now();
+        uint64_t const presents =
+            gameEngine->m_videoManager->getPresentCount();
+        AllocationCounts const allocations =
+            AllocationTracker::getTotalCounts();
         gameEngine->S_UserInput();
+        // Before the frame check, so a preparation finishing while paused
+        // is picked up on the next wake.
+        gameEngine->pollPreparedScenes();
+        if (!gameEngine->isFrameDue()) {
+            return;
+        }
         gameEngine->Update();
+
+        auto const work = gameEngine->frameWorkTime(frameStart, presents);
+        gameEngine->m_frameWorkUs->recordDuration(work);
+        if (AllocationTracker::isEnabled()) {
+            // Every thread's, so work handed to the job system counts.
+            uint64_t const frameAllocations =
+                (AllocationTracker::getTotalCounts() - allocations)
+                    .allocations;
+            gameEngine->m_frameAllocations->record(frameAllocations);
+            gameEngine->m_runFrameAllocations.record(frameAllocations);
+        }
+        if (gameEngine->m_background == BackgroundPolicy::Run) {
+            gameEngine->governFrame(work);
+        }
+        auto const now = std::chrono::steady_clock::now();
+        if (gameEngine->m_metricsFile != nullptr &&
+            gameEngine->m_metricsInterval.count() > 0 &&
+            now >= gameEngine->m_nextMetricsWindow) {
+            // From now, so time in the background is not caught up on.
+            gameEngine->m_nextMetricsWindow =
+                now + gameEngine->m_metricsInterval;
+            gameEngine->writeMetricsWindow();
+        }
     }
 
 } // namespace YerbEngine
@@ -0,0 +1,68 @@
+#include <GameEngine/InputLatency.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+
+namespace YerbEngine {
+
+    namespace {
+        // Nearest-rank percentile of the sorted `samples`.
+        double percentile(std::span<float const> const samples,
+                          double const                  fraction) {
+            auto const rank = static_cast<size_t>(
+                std::ceil(fraction * static_cast<double>(samples.size())));
+            return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+        }
+    } // namespace
+
+    void InputLatencyTracker::noteInput(Clock::time_point const eventTime) {
+        if (!m_oldestPending.has_value() || eventTime < *m_oldestPending) {
+            m_oldestPending = eventTime;
+        }
+    }
+
+    void InputLatencyTracker::notePresent(Clock::time_point const presentTime) {
+        if (!m_oldestPending.has_value()) {
+            return;
+        }
+
+        double const latencyMs =
+            std::max(0.0, std::chrono::duration<double, std::milli>(
+                              presentTime - *m_oldestPending)
+                              .count());
+        m_oldestPending.reset();
+
+        m_samplesMs[m_next] = static_cast<float>(latencyMs);
+        m_next              = (m_next + 1) % WINDOW;
+        m_frames += 1;
+        m_lastMs = latencyMs;
+        m_maxMs  = std::max(m_maxMs, latencyMs);
+    }
+
+    InputLatencyStats InputLatencyTracker::getStats() const {
+        InputLatencyStats stats{
+            .frames = m_frames, .lastMs = m_lastMs, .maxMs = m_maxMs};
+        size_t const count = std::min(m_frames, WINDOW);
+        if (count == 0) {
+            return stats;
+        }
+
+        std::array<float, WINDOW> sorted = m_samplesMs;
+        std::span<float> const    window(sorted.data(), count);
+        std::ranges::sort(window);
+        stats.p50Ms = percentile(window, 0.50);
+        stats.p95Ms = percentile(window, 0.95);
+        stats.p99Ms = percentile(window, 0.99);
+        return stats;
+    }
+
+    void InputLatencyTracker::resetStats() {
+        m_next   = 0;
+        m_frames = 0;
+        m_lastMs = 0.0;
+        m_maxMs  = 0.0;
+        m_oldestPending.reset();
+    }
+
+} // namespace YerbEngine
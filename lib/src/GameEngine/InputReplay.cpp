@@ -0,0 +1,270 @@
+#include <GameEngine/InputReplay.hpp>
+
+#include <SDL.h>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+namespace YerbEngine {
+
+    namespace {
+        constexpr std::array<uint8_t, 4> MAGIC   = {'Y', 'R', 'P', 'L'};
+        constexpr uint64_t               VERSION = 1;
+
+        // Action flag bits.
+        constexpr uint8_t ACTION_END  = 1 << 0;
+        constexpr uint8_t ACTION_POS  = 1 << 1;
+        constexpr uint8_t ACTION_NAME = 1 << 2; // name follows inline
+
+        void writeVarint(std::vector<uint8_t> &out, uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        void writeFixed64(std::vector<uint8_t> &out, uint64_t const value) {
+            for (int byte = 0; byte < 8; ++byte) {
+                out.push_back(static_cast<uint8_t>(value >> (byte * 8)));
+            }
+        }
+
+        void writeFloat(std::vector<uint8_t> &out, float const value) {
+            auto const bits = std::bit_cast<uint32_t>(value);
+            for (int byte = 0; byte < 4; ++byte) {
+                out.push_back(static_cast<uint8_t>(bits >> (byte * 8)));
+            }
+        }
+
+        void writeString(std::vector<uint8_t> &out, std::string_view value) {
+            writeVarint(out, value.size());
+            out.insert(out.end(), value.begin(), value.end());
+        }
+
+        [[noreturn]] void corrupt() {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Replay file is truncated or corrupt.");
+            throw std::runtime_error("Replay file is truncated or corrupt");
+        }
+
+        class Reader {
+            std::vector<uint8_t> const &m_data;
+            size_t                     &m_cursor;
+
+          public:
+            Reader(std::vector<uint8_t> const &data, size_t &cursor)
+                : m_data(data),
+                  m_cursor(cursor) {}
+
+            uint8_t byte() {
+                if (m_cursor >= m_data.size()) {
+                    corrupt();
+                }
+                return m_data[m_cursor++];
+            }
+
+            uint64_t varint() {
+                uint64_t value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    uint8_t const b = byte();
+                    value |= static_cast<uint64_t>(b & 0x7F) << shift;
+                    if ((b & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                corrupt();
+            }
+
+            uint64_t fixed64() {
+                uint64_t value = 0;
+                for (int b = 0; b < 8; ++b) {
+                    value |= static_cast<uint64_t>(byte()) << (b * 8);
+                }
+                return value;
+            }
+
+            float float32() {
+                uint32_t bits = 0;
+                for (int b = 0; b < 4; ++b) {
+                    bits |= static_cast<uint32_t>(byte()) << (b * 8);
+                }
+                return std::bit_cast<float>(bits);
+            }
+
+            std::string string() {
+                uint64_t const size = varint();
+                if (size > m_data.size() - m_cursor) {
+                    corrupt();
+                }
+                auto const first = m_data.begin() +
+                                   static_cast<std::ptrdiff_t>(m_cursor);
+                m_cursor += size;
+                return {first, first + static_cast<std::ptrdiff_t>(size)};
+            }
+        };
+    } // namespace
+
+    void InputRecorder::recordAction(Action const &action) {
+        uint8_t flags = 0;
+        if (action.getState() == ActionState::END) {
+            flags |= ACTION_END;
+        }
+        if (action.getPos().has_value()) {
+            flags |= ACTION_POS;
+        }
+
+        ActionId const id = action.getId();
+        if (id >= m_nameIndices.size()) {
+            m_nameIndices.resize(static_cast<size_t>(id) + 1, SIZE_MAX);
+        }
+        bool const isNew = m_nameIndices[id] == SIZE_MAX;
+        if (isNew) {
+            flags |= ACTION_NAME;
+            m_nameIndices[id] = m_nameCount++;
+        }
+
+        m_pendingActions.push_back(flags);
+        if (isNew) {
+            writeString(m_pendingActions, action.getName());
+        } else {
+            writeVarint(m_pendingActions, m_nameIndices[id]);
+        }
+        if (action.getPos().has_value()) {
+            writeFloat(m_pendingActions, action.getPos()->x());
+            writeFloat(m_pendingActions, action.getPos()->y());
+        }
+        m_pendingCount += 1;
+    }
+
+    void InputRecorder::endFrame(size_t const ticks) {
+        // The low bit says whether an action list follows.
+        bool const hasActions = m_pendingCount > 0;
+        writeVarint(m_frames, (static_cast<uint64_t>(ticks) << 1) |
+                                  (hasActions ? 1 : 0));
+        if (hasActions) {
+            writeVarint(m_frames, m_pendingCount);
+            m_frames.insert(m_frames.end(), m_pendingActions.begin(),
+                            m_pendingActions.end());
+            m_pendingActions.clear();
+            m_pendingCount = 0;
+        }
+        m_frameCount += 1;
+    }
+
+    void InputRecorder::save(std::filesystem::path const &path,
+                             ReplayHeader const          &header) const {
+        std::vector<uint8_t> head(MAGIC.begin(), MAGIC.end());
+        writeVarint(head, VERSION);
+        writeFixed64(head, header.seed);
+        writeVarint(head, header.configHashes.size());
+        for (auto const &[name, hash] : header.configHashes) {
+            writeString(head, name);
+            writeFixed64(head, hash);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<char const *>(head.data()),
+                   static_cast<std::streamsize>(head.size()));
+        file.write(reinterpret_cast<char const *>(m_frames.data()),
+                   static_cast<std::streamsize>(m_frames.size()));
+        if (!file) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Failed to write replay file: %s",
+                         path.string().c_str());
+            throw std::runtime_error("Failed to write replay file: " +
+                                     path.string());
+        }
+
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Recorded %zu frames (%zu bytes) to %s.", m_frameCount,
+                    head.size() + m_frames.size(), path.string().c_str());
+    }
+
+    InputReplay::InputReplay(std::filesystem::path const &path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Failed to open replay file: %s",
+                         path.string().c_str());
+            throw std::runtime_error("Failed to open replay file: " +
+                                     path.string());
+        }
+        m_data.assign(std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>());
+
+        Reader reader(m_data, m_cursor);
+        for (uint8_t const expected : MAGIC) {
+            if (m_cursor >= m_data.size() || reader.byte() != expected) {
+                SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                             "Not a replay file: %s", path.string().c_str());
+                throw std::runtime_error("Not a replay file: " +
+                                         path.string());
+            }
+        }
+
+        uint64_t const version = reader.varint();
+        if (version != VERSION) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Unsupported replay version %llu in %s.",
+                         static_cast<unsigned long long>(version),
+                         path.string().c_str());
+            throw std::runtime_error("Unsupported replay version: " +
+                                     path.string());
+        }
+
+        m_header.seed          = reader.fixed64();
+        uint64_t const configs = reader.varint();
+        for (uint64_t i = 0; i < configs; ++i) {
+            std::string    name = reader.string();
+            uint64_t const hash = reader.fixed64();
+            m_header.configHashes.emplace_back(std::move(name), hash);
+        }
+    }
+
+    bool InputReplay::nextFrame(size_t &ticks, std::vector<Action> &actions) {
+        actions.clear();
+        if (isFinished()) {
+            return false;
+        }
+
+        Reader         reader(m_data, m_cursor);
+        uint64_t const frame = reader.varint();
+        ticks                = static_cast<size_t>(frame >> 1);
+        if ((frame & 1) == 0) {
+            return true;
+        }
+
+        uint64_t const count = reader.varint();
+        for (uint64_t i = 0; i < count; ++i) {
+            uint8_t const flags = reader.byte();
+            if ((flags & ACTION_NAME) != 0) {
+                m_actionIds.push_back(ActionNames::intern(reader.string()));
+            }
+            size_t const index = (flags & ACTION_NAME) != 0
+                                     ? m_actionIds.size() - 1
+                                     : static_cast<size_t>(reader.varint());
+            if (index >= m_actionIds.size()) {
+                corrupt();
+            }
+
+            std::optional<Vec2> pos;
+            if ((flags & ACTION_POS) != 0) {
+                float const x = reader.float32();
+                float const y = reader.float32();
+                pos           = Vec2{x, y};
+            }
+
+            ActionState const state = (flags & ACTION_END) != 0
+                                          ? ActionState::END
+                                          : ActionState::START;
+            actions.emplace_back(m_actionIds[index], state, pos);
+        }
+        return true;
+    }
+
+} // namespace YerbEngine
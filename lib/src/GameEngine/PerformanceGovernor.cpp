@@ -0,0 +1,62 @@
+#include <GameEngine/PerformanceGovernor.hpp>
+
+#include <algorithm>
+
+namespace YerbEngine {
+
+    PerformanceGovernor::PerformanceGovernor(GovernorSettings const &settings)
+        : m_settings(settings),
+          m_frameMs(std::max<size_t>(1, settings.windowFrames), 0.0) {}
+
+    void PerformanceGovernor::clearWindow() {
+        std::ranges::fill(m_frameMs, 0.0);
+        m_next        = 0;
+        m_filled      = 0;
+        m_sumMs       = 0.0;
+        m_sinceChange = 0;
+    }
+
+    std::optional<GovernorTransition>
+    PerformanceGovernor::recordFrame(double const frameMs) {
+        if (!isEnabled()) {
+            return std::nullopt;
+        }
+
+        m_frames += 1;
+        m_sinceChange += 1;
+        m_sumMs += frameMs - m_frameMs[m_next];
+        m_frameMs[m_next] = frameMs;
+        m_next            = (m_next + 1) % m_frameMs.size();
+        m_filled          = std::min(m_filled + 1, m_frameMs.size());
+
+        if (m_filled < m_frameMs.size() ||
+            m_sinceChange < m_settings.holdFrames) {
+            return std::nullopt;
+        }
+
+        double const meanMs = m_sumMs / static_cast<double>(m_filled);
+        size_t       level  = m_level;
+        if (meanMs > m_settings.budgetMs * m_settings.degradeAbove &&
+            m_level < m_settings.maxLevel) {
+            level += 1;
+        } else if (meanMs < m_settings.budgetMs * m_settings.recoverBelow &&
+                   m_level > 0) {
+            level -= 1;
+        } else {
+            return std::nullopt;
+        }
+
+        GovernorTransition const transition{
+            .from     = m_level,
+            .to       = level,
+            .meanMs   = meanMs,
+            .maxMs    = *std::ranges::max_element(m_frameMs),
+            .budgetMs = m_settings.budgetMs,
+            .frames   = m_frames};
+        m_level = level;
+        m_transitions += 1;
+        clearWindow();
+        return transition;
+    }
+
+} // namespace YerbEngine
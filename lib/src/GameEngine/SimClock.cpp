@@ -0,0 +1,43 @@
+#include <GameEngine/SimClock.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace YerbEngine {
+
+    double SimClock::scale(double const realSeconds) const {
+        if (m_paused || m_unthrottled) {
+            return 0.0;
+        }
+        return realSeconds * m_timeScale;
+    }
+
+    size_t SimClock::getUnthrottledTicks() const {
+        if (m_paused || !m_unthrottled) {
+            return 0;
+        }
+        return m_unthrottledTicks;
+    }
+
+    void SimClock::tick(double const tickSeconds) {
+        m_nowMs += tickSeconds * 1000.0;
+        m_ticks += 1;
+    }
+
+    void SimClock::setTimeScale(double const timeScale) {
+        if (timeScale < 0.0 || !std::isfinite(timeScale)) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                        "Invalid time scale %f. Keeping %f.", timeScale,
+                        m_timeScale);
+            return;
+        }
+        m_timeScale = timeScale;
+    }
+
+    void SimClock::setUnthrottled(bool const   unthrottled,
+                                  size_t const ticksPerFrame) {
+        m_unthrottled      = unthrottled;
+        m_unthrottledTicks = std::max<size_t>(1, ticksPerFrame);
+    }
+
+} // namespace YerbEngine
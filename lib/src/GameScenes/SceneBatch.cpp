@@ -0,0 +1,134 @@
+#include <GameScenes/SceneBatch.hpp>
+
+#include <SDL.h>
+#include <stdexcept>
+#include <utility>
+
+namespace YerbEngine {
+
+    namespace {
+        // SplitMix64 finaliser: spreads nearby inputs across the full range,
+        // so worlds and episodes that differ by one get unrelated seeds.
+        uint64_t mix(uint64_t value) {
+            value += 0x9E3779B97F4A7C15ULL;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+    } // namespace
+
+    SceneBatch::SceneBatch(JobSystem     &jobSystem,
+                           size_t const   count,
+                           uint64_t const seed,
+                           SceneFactory   factory)
+        : m_jobSystem(jobSystem),
+          m_factory(std::move(factory)),
+          m_seed(seed),
+          m_worlds(count),
+          m_episodes(count, 0),
+          m_done(count, 0) {
+        for (size_t index = 0; index < count; ++index) {
+            build(index);
+        }
+        if (count > 0) {
+            m_observationSize = m_worlds[0]->getObservationSize();
+            m_controlSize     = m_worlds[0]->getControlSize();
+        }
+        for (auto const &world : m_worlds) {
+            if (world->getObservationSize() != m_observationSize ||
+                world->getControlSize() != m_controlSize) {
+                SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                             "Scene batch worlds disagree on their "
+                             "observation or control size.");
+                throw std::runtime_error("Scene batch worlds disagree on "
+                                         "their observation or control size");
+            }
+        }
+    }
+
+    uint64_t SceneBatch::worldSeed(size_t const index) const {
+        return mix(mix(m_seed ^ mix(index)) ^ m_episodes[index]);
+    }
+
+    void SceneBatch::build(size_t const index) {
+        std::shared_ptr<Scene> world = m_factory(index, worldSeed(index));
+        if (world == nullptr) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Scene batch factory returned no scene for world "
+                         "%zu.",
+                         index);
+            throw std::runtime_error("Scene batch factory returned no scene");
+        }
+        m_worlds[index] = std::move(world);
+        m_done[index]   = 0;
+    }
+
+    void SceneBatch::reset() {
+        for (size_t index = 0; index < m_worlds.size(); ++index) {
+            reset(index);
+        }
+    }
+
+    void SceneBatch::reset(size_t const index) {
+        m_episodes[index] += 1;
+        // Drop the old world first so two never hold resources at once.
+        m_worlds[index].reset();
+        build(index);
+    }
+
+    size_t SceneBatch::resetDone() {
+        size_t rebuilt = 0;
+        for (size_t index = 0; index < m_worlds.size(); ++index) {
+            if (m_done[index] != 0) {
+                reset(index);
+                rebuilt += 1;
+            }
+        }
+        return rebuilt;
+    }
+
+    void SceneBatch::step(std::span<float const> const controls,
+                          float const                  tickSeconds,
+                          size_t const                 ticks) {
+        if (controls.size() != m_worlds.size() * m_controlSize) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Scene batch expected %zu controls, got %zu.",
+                         m_worlds.size() * m_controlSize, controls.size());
+            throw std::runtime_error("Scene batch got the wrong number of "
+                                     "controls");
+        }
+
+        m_jobSystem.parallelFor(m_worlds.size(), [&](size_t const index) {
+            Scene &world = *m_worlds[index];
+            if (m_controlSize > 0) {
+                world.applyControls(
+                    controls.subspan(index * m_controlSize, m_controlSize));
+            }
+            for (size_t tick = 0; tick < ticks && !world.isEndTriggered();
+                 ++tick) {
+                world.fixedUpdate(tickSeconds);
+            }
+            m_done[index] = world.isEndTriggered() ? 1 : 0;
+        });
+    }
+
+    void SceneBatch::observe(std::span<float> const out) const {
+        if (out.size() != m_worlds.size() * m_observationSize) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Scene batch expected room for %zu observations, "
+                         "got %zu.",
+                         m_worlds.size() * m_observationSize, out.size());
+            throw std::runtime_error("Scene batch got the wrong observation "
+                                     "buffer size");
+        }
+        if (m_observationSize == 0) {
+            return;
+        }
+
+        m_jobSystem.parallelFor(m_worlds.size(), [&](size_t const index) {
+            m_worlds[index]->observe(
+                out.subspan(index * m_observationSize, m_observationSize));
+        });
+    }
+
+} // namespace YerbEngine
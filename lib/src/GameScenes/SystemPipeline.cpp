@@ -0,0 +1,252 @@
+#include <GameScenes/SystemPipeline.hpp>
+#include <Profiling/AllocationTracker.hpp>
+#include <Profiling/Profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+namespace YerbEngine {
+
+    namespace {
+        void checkInterval(std::string const &name,
+                           Uint32 const       interval) {
+            if (interval == 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                             "System '%s' needs an interval of at least 1",
+                             name.c_str());
+                throw std::runtime_error("Invalid interval for system: " +
+                                         name);
+            }
+        }
+
+        size_t phaseIndex(SystemPhase const phase) {
+            return static_cast<size_t>(phase);
+        }
+
+        void bindMetrics(System &system, MetricsRegistry *const metrics) {
+            if (metrics == nullptr) {
+                system.timeUs      = nullptr;
+                system.allocations = nullptr;
+                return;
+            }
+            system.timeUs = &metrics->histogram("system." + system.name, "us");
+            system.allocations =
+                &metrics->counter("system." + system.name + ".allocations");
+        }
+    } // namespace
+
+    System &SystemPipeline::get(std::string const &name) {
+        return const_cast<System &>(std::as_const(*this).get(name));
+    }
+
+    System const &SystemPipeline::get(std::string const &name) const {
+        auto const it = std::ranges::find(m_systems, name, &System::name);
+        if (it == m_systems.end()) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "System '%s' not found",
+                         name.c_str());
+            throw std::runtime_error("System not found: " + name);
+        }
+        return *it;
+    }
+
+    SystemPipeline &SystemPipeline::add(std::string           name,
+                                        SystemPhase const     phase,
+                                        std::function<void()> run,
+                                        Uint32 const          interval) {
+        return add(std::move(name), phase, SystemAccess{}, std::move(run),
+                   interval);
+    }
+
+    SystemPipeline &SystemPipeline::add(std::string           name,
+                                        SystemPhase const     phase,
+                                        SystemAccess          access,
+                                        std::function<void()> run,
+                                        Uint32 const          interval) {
+        if (contains(name)) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "System '%s' is already registered", name.c_str());
+            throw std::runtime_error("System already registered: " + name);
+        }
+        checkInterval(name, interval);
+
+        // Insert after the last system of the same or an earlier phase.
+        auto const position =
+            std::ranges::upper_bound(m_systems, phase, {}, &System::phase);
+        char const *zoneName = Profiler::intern(name);
+        auto const  added =
+            m_systems.insert(position, System{.name     = std::move(name),
+                                              .phase    = phase,
+                                              .run      = std::move(run),
+                                              .access   = std::move(access),
+                                              .interval = interval,
+                                              .zoneName = zoneName});
+        bindMetrics(*added, m_metrics);
+        m_scheduleDirty = true;
+        return *this;
+    }
+
+    void SystemPipeline::buildSchedule() {
+        m_waveCounts.fill(0);
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            System &system = m_systems[i];
+            system.wave    = 0;
+            // Systems are sorted by phase, so earlier systems of the same
+            // phase sit directly before this one.
+            for (size_t j = i; j-- > 0 && m_systems[j].phase == system.phase;) {
+                if (system.access.conflictsWith(m_systems[j].access)) {
+                    system.wave = std::max(system.wave, m_systems[j].wave + 1);
+                }
+            }
+            Uint32 &waveCount = m_waveCounts[phaseIndex(system.phase)];
+            waveCount         = std::max(waveCount, system.wave + 1);
+        }
+        m_scheduleDirty = false;
+    }
+
+    void SystemPipeline::runSystem(System &system) const {
+        using Clock = std::chrono::steady_clock;
+
+        SystemAccessScope scope{.systemName = system.name.c_str(),
+                                .access     = &system.access,
+                                .reported   = &system.reportedViolations};
+        bool const        checked = YERB_CHECK_SYSTEM_ACCESS &&
+                             m_accessChecks && system.access.isDeclared();
+        SystemAccessScope *&current  = ComponentAccess::currentScope();
+        SystemAccessScope  *previous = current;
+        if (checked) {
+            current = &scope;
+        }
+
+        // Jobs of other systems this thread helps with while the system
+        // waits are taken back out of its time and allocations.
+        void const *const previousOwner = JobSystem::setOwner(&system);
+        ForeignWork const foreignStart  = JobSystem::getForeignWork();
+        AllocationScope   allocationScope;
+        auto const        start = Clock::now();
+        {
+            YERB_ZONE(system.zoneName);
+            system.run();
+        }
+        auto const        end     = Clock::now();
+        ForeignWork const foreign = JobSystem::getForeignWork() - foreignStart;
+        auto const        elapsed = end - start - foreign.time;
+        uint64_t const    allocations =
+            allocationScope.getCounts().allocations - foreign.allocations;
+        double const elapsedMs =
+            std::chrono::duration<double, std::milli>(elapsed).count();
+        JobSystem::setOwner(previousOwner);
+        current = previous;
+        if (system.timeUs != nullptr) {
+            system.timeUs->recordDuration(elapsed);
+            system.allocations->add(allocations);
+        }
+
+        SystemStats &stats       = system.stats;
+        stats.runs              += 1;
+        stats.lastMs             = elapsedMs;
+        stats.totalMs           += elapsedMs;
+        stats.maxMs              = std::max(stats.maxMs, elapsedMs);
+        stats.accessViolations  += scope.violations;
+        stats.allocations       += allocations;
+    }
+
+    void SystemPipeline::run(SystemPhase const phase) {
+        if (m_scheduleDirty) {
+            buildSchedule();
+        }
+
+        Uint64 const pass      = m_passes[phaseIndex(phase)]++;
+        Uint32 const waveCount = m_waveCounts[phaseIndex(phase)];
+        auto const   first =
+            std::ranges::lower_bound(m_systems, phase, {}, &System::phase);
+
+        for (Uint32 wave = 0; wave < waveCount; ++wave) {
+            m_dueSystems.clear();
+            for (auto it = first; it != m_systems.end() && it->phase == phase;
+                 ++it) {
+                if (it->wave == wave && it->enabled &&
+                    pass % it->interval == 0) {
+                    m_dueSystems.push_back(
+                        static_cast<size_t>(it - m_systems.begin()));
+                }
+            }
+
+            if (m_jobSystem == nullptr || m_dueSystems.size() < 2) {
+                for (size_t const index : m_dueSystems) {
+                    runSystem(m_systems[index]);
+                }
+                continue;
+            }
+
+            // parallelFor runs index 0 on this thread, so a main-thread
+            // system goes first. There is at most one per wave.
+            auto const mainThread =
+                std::ranges::find_if(m_dueSystems, [&](size_t const index) {
+                    return m_systems[index].access.needsMainThread();
+                });
+            if (mainThread != m_dueSystems.end()) {
+                std::iter_swap(m_dueSystems.begin(), mainThread);
+            }
+
+            m_jobSystem->parallelFor(
+                m_dueSystems.size(), [this](size_t const task) {
+                    runSystem(m_systems[m_dueSystems[task]]);
+                });
+        }
+    }
+
+    void SystemPipeline::setMetrics(MetricsRegistry *const metrics) {
+        m_metrics = metrics;
+        for (System &system : m_systems) {
+            bindMetrics(system, metrics);
+        }
+    }
+
+    bool SystemPipeline::contains(std::string const &name) const {
+        return std::ranges::find(m_systems, name, &System::name) !=
+               m_systems.end();
+    }
+
+    void SystemPipeline::setEnabled(std::string const &name,
+                                    bool const         enabled) {
+        get(name).enabled = enabled;
+    }
+
+    bool SystemPipeline::isEnabled(std::string const &name) const {
+        return get(name).enabled;
+    }
+
+    void SystemPipeline::setInterval(std::string const &name,
+                                     Uint32 const       interval) {
+        System &system = get(name);
+        checkInterval(name, interval);
+        system.interval = interval;
+    }
+
+    Uint32 SystemPipeline::getWave(std::string const &name) {
+        if (m_scheduleDirty) {
+            buildSchedule();
+        }
+        return get(name).wave;
+    }
+
+    Uint32 SystemPipeline::getWaveCount(SystemPhase const phase) {
+        if (m_scheduleDirty) {
+            buildSchedule();
+        }
+        return m_waveCounts[phaseIndex(phase)];
+    }
+
+    SystemStats const &SystemPipeline::getStats(std::string const &name) const {
+        return get(name).stats;
+    }
+
+    void SystemPipeline::resetStats() {
+        for (System &system : m_systems) {
+            system.stats = SystemStats{};
+        }
+    }
+
+} // namespace YerbEngine
@@ -1,4 +1,6 @@
 #include <Helpers/TextHelpers.hpp>
+#include <Profiling/Profiler.hpp>
+#include <SystemManagement/VideoManager.hpp>
 
 namespace YerbEngine {
 
@@ -8,6 +10,7 @@ namespace YerbEngine {
                               std::string const &text,
                               SDL_Color const   &color,
                               Vec2 const        &position) {
+            YERB_ZONE("Text render");
 
             // Render the text to a surface
             SDL_Surface *surface =
@@ -41,11 +44,74 @@ namespace YerbEngine {
 
             // Copy the texture to the renderer
             SDL_RenderCopy(renderer, texture, nullptr, &textRect);
+            VideoManager::countDrawCalls();
 
             SDL_DestroyTexture(texture);
             SDL_FreeSurface(surface);
         }
 
+        CachedText::~CachedText() { release(); }
+
+        void CachedText::release() {
+            if (m_texture != nullptr) {
+                SDL_DestroyTexture(m_texture);
+                m_texture = nullptr;
+            }
+        }
+
+        void CachedText::set(SDL_Renderer      *renderer,
+                             TTF_Font          *font,
+                             std::string const &text,
+                             SDL_Color const   &color) {
+            bool const sameColor = color.r == m_color.r &&
+                                   color.g == m_color.g &&
+                                   color.b == m_color.b && color.a == m_color.a;
+            if (font == m_font && sameColor && text == m_text) {
+                return;
+            }
+
+            YERB_ZONE("Text rasterize");
+            release();
+            m_font  = font;
+            m_text  = text;
+            m_color = color;
+            if (text.empty()) {
+                return;
+            }
+
+            SDL_Surface *surface =
+                TTF_RenderText_Solid(font, text.c_str(), color);
+            if (!surface) {
+                SDL_LogError(SDL_LOG_CATEGORY_ERROR,
+                             "Failed to create surface for text rendering: %s",
+                             TTF_GetError());
+                return;
+            }
+            m_texture = SDL_CreateTextureFromSurface(renderer, surface);
+            m_width   = surface->w;
+            m_height  = surface->h;
+            SDL_FreeSurface(surface);
+            if (!m_texture) {
+                SDL_LogError(SDL_LOG_CATEGORY_ERROR,
+                             "Failed to create texture from surface for text "
+                             "rendering: %s",
+                             SDL_GetError());
+            }
+        }
+
+        void CachedText::draw(SDL_Renderer *renderer,
+                              Vec2 const   &position) const {
+            if (m_texture == nullptr) {
+                return;
+            }
+            SDL_Rect const textRect{.x = static_cast<int>(position.x()),
+                                    .y = static_cast<int>(position.y()),
+                                    .w = m_width,
+                                    .h = m_height};
+            SDL_RenderCopy(renderer, m_texture, nullptr, &textRect);
+            VideoManager::countDrawCalls();
+        }
+
     } // namespace TextHelpers
 
 } // namespace YerbEngine
\ No newline at end of file
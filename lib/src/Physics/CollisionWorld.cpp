@@ -0,0 +1,839 @@
+#include <Physics/CollisionWorld.hpp>
+#include <Physics/SweptAABB.hpp>
+#include <Profiling/Metrics.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+
+namespace YerbEngine {
+
+    namespace {
+        // Contact colours before the rest spill into an overflow batch.
+        constexpr uint32_t MAX_COLORS = 64;
+
+        bool computeBox(std::shared_ptr<Entity> const &entity,
+                        AABB                          &box) {
+            auto const cTransform =
+                entity->getComponent<Components::CTransform>();
+            auto const cShape = entity->getComponent<Components::CShape>();
+            if (cTransform == nullptr || cShape == nullptr) {
+                return false;
+            }
+
+            Vec2 const &position = cTransform->topLeftCornerPos;
+            box.min              = position;
+            box.max = position + Vec2(static_cast<float>(cShape->rect.w),
+                                      static_cast<float>(cShape->rect.h));
+            return true;
+        }
+
+        Uint64 contactKey(ContactPair const &pair) {
+            Uint64 const idA = pair.entityA->id();
+            Uint64 const idB = pair.entityB->id();
+            return idA < idB ? (idA << 32) | idB : (idB << 32) | idA;
+        }
+
+        AABB translated(AABB const &box,
+                        Vec2 const &offset) {
+            return {box.min + offset, box.max + offset};
+        }
+
+        struct NearestCandidate {
+            float                          distanceSquared;
+            std::shared_ptr<Entity> const *entity;
+        };
+
+        // The box covering a body's whole move, given its box at the end.
+        AABB sweptBox(AABB const &end,
+                      Vec2 const &displacement) {
+            AABB const start = translated(end, displacement * -1.0f);
+            return {Vec2{std::min(start.min.x(), end.min.x()),
+                         std::min(start.min.y(), end.min.y())},
+                    Vec2{std::max(start.max.x(), end.max.x()),
+                         std::max(start.max.y(), end.max.y())}};
+        }
+    } // namespace
+
+    bool QueryFilter::accepts(Entity const &entity) const {
+        if (!entity.isActive() || (tags & tagBit(entity.tag())) == 0) {
+            return false;
+        }
+        if (layers == ~0u) {
+            return true;
+        }
+
+        auto const   cCollider = entity.getComponent<Components::CCollider>();
+        Uint32 const bodyLayers = cCollider
+                                      ? cCollider->layers
+                                      : Components::CCollider::DEFAULT_LAYER;
+        return (layers & bodyLayers) != 0;
+    }
+
+    CollisionWorld::CollisionWorld(float const  cellSize,
+                                   Uint32 const sleepAfterTicks)
+        : m_cellSize(cellSize),
+          m_sleepAfterTicks(sleepAfterTicks),
+          m_staticGrid(cellSize),
+          m_sleepingGrid(cellSize),
+          m_awakeGrid(cellSize) {}
+
+    void CollisionWorld::setBounds(Vec2 const &size) {
+        if (size == m_bounds) {
+            return;
+        }
+
+        m_bounds = size;
+        m_staticGrid.setBounds(size);
+        m_sleepingGrid.setBounds(size);
+        m_awakeGrid.setBounds(size);
+        m_staticDirty   = true;
+        m_sleepingDirty = true;
+        m_awakeDirty    = true;
+    }
+
+    CollisionWorld::BodySlot *CollisionWorld::findSlot(size_t const id) {
+        auto const it =
+            std::ranges::lower_bound(m_slots, id, {}, &BodySlot::id);
+        return it != m_slots.end() && it->id == id ? &*it : nullptr;
+    }
+
+    CollisionWorld::BodySlot const *
+    CollisionWorld::findSlot(size_t const id) const {
+        auto const it =
+            std::ranges::lower_bound(m_slots, id, {}, &BodySlot::id);
+        return it != m_slots.end() && it->id == id ? &*it : nullptr;
+    }
+
+    void CollisionWorld::removeDeadBodies(EntityList        &bodies,
+                                          std::vector<AABB> &boxes,
+                                          bool              &dirty) {
+        size_t kept = 0;
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            if (!bodies[i]->isActive()) {
+                dirty = true;
+                continue;
+            }
+            bodies[kept] = std::move(bodies[i]);
+            boxes[kept]  = boxes[i];
+            kept += 1;
+        }
+        bodies.resize(kept);
+        boxes.resize(kept);
+    }
+
+    void CollisionWorld::moveSleepingBodyToAwake(size_t const id) {
+        for (size_t i = 0; i < m_sleepingBodies.size(); ++i) {
+            if (m_sleepingBodies[i]->id() != id) {
+                continue;
+            }
+            // Past the end of the awake grid, where queries scan it directly
+            // until the next update rebuilds the grid.
+            m_awakeBodies.push_back(m_sleepingBodies[i]);
+            m_awakeBoxes.push_back(m_sleepingBoxes[i]);
+            m_awakeDisplacements.push_back(Vec2{0, 0});
+
+            m_sleepingBodies[i] = std::move(m_sleepingBodies.back());
+            m_sleepingBoxes[i]  = m_sleepingBoxes.back();
+            m_sleepingBodies.pop_back();
+            m_sleepingBoxes.pop_back();
+            m_sleepingDirty = true;
+            return;
+        }
+    }
+
+    void CollisionWorld::syncBodies(EntityManager &entityManager) {
+        removeDeadBodies(m_staticBodies, m_staticBoxes, m_staticDirty);
+        removeDeadBodies(m_sleepingBodies, m_sleepingBoxes, m_sleepingDirty);
+
+        m_awakeBodies.clear();
+        m_awakeBoxes.clear();
+        m_awakeDisplacements.clear();
+        m_fastMovers.clear();
+        m_sweptHits.clear();
+
+        // Carry each live entity's slot over in id order; slots of entities
+        // that are gone are dropped here.
+        m_nextSlots.clear();
+        size_t cursor  = 0;
+        bool   inOrder = true;
+        for (std::shared_ptr<Entity> const &entity :
+             entityManager.getEntities()) {
+            if (!entity->isActive()) {
+                continue;
+            }
+
+            size_t const id = entity->id();
+            if (!m_nextSlots.empty() && id < m_nextSlots.back().id) {
+                inOrder = false;
+                cursor  = 0;
+            }
+            while (cursor < m_slots.size() && m_slots[cursor].id < id) {
+                cursor += 1;
+            }
+            bool const known =
+                cursor < m_slots.size() && m_slots[cursor].id == id;
+            m_nextSlots.push_back(known ? m_slots[cursor]
+                                        : BodySlot{.id = id});
+
+            BodySlot &slot = m_nextSlots.back();
+            if (slot.state == BodyState::Static ||
+                slot.state == BodyState::Sleeping) {
+                continue;
+            }
+
+            AABB box;
+            if (!computeBox(entity, box)) {
+                continue;
+            }
+
+            auto const cCollider =
+                entity->getComponent<Components::CCollider>();
+
+            if (cCollider &&
+                cCollider->bodyType == Components::BodyType::Static) {
+                slot.state = BodyState::Static;
+                m_staticBodies.push_back(entity);
+                m_staticBoxes.push_back(box);
+                m_staticDirty = true;
+                continue;
+            }
+
+            slot.state = BodyState::Awake;
+
+            auto const cTransform =
+                entity->getComponent<Components::CTransform>();
+            Vec2 const &position     = cTransform->topLeftCornerPos;
+            Vec2 const  displacement = slot.hasLastPosition
+                                           ? position - slot.lastPosition
+                                           : Vec2{0, 0};
+            slot.lastPosition        = position;
+            slot.hasLastPosition     = true;
+
+            if (cCollider && cCollider->allowSleep) {
+                bool const idle =
+                    displacement.euclideanDistanceSquared(Vec2{0, 0}) <=
+                        SLEEP_EPSILON &&
+                    cTransform->velocity.euclideanDistanceSquared(Vec2{0, 0}) <=
+                        SLEEP_EPSILON;
+
+                slot.idleTicks = idle ? slot.idleTicks + 1 : 0;
+
+                if (slot.idleTicks >= m_sleepAfterTicks) {
+                    slot.state = BodyState::Sleeping;
+                    m_sleepingBodies.push_back(entity);
+                    m_sleepingBoxes.push_back(box);
+                    m_sleepingDirty = true;
+                    continue;
+                }
+            }
+
+            if (cCollider && cCollider->fastMover) {
+                m_fastMovers.push_back(
+                    static_cast<uint32_t>(m_awakeBodies.size()));
+            }
+
+            m_awakeBodies.push_back(entity);
+            m_awakeBoxes.push_back(box);
+            m_awakeDisplacements.push_back(displacement);
+        }
+
+        if (!inOrder) {
+            std::ranges::sort(m_nextSlots, {}, &BodySlot::id);
+        }
+        std::swap(m_slots, m_nextSlots);
+
+        if (m_staticDirty) {
+            m_staticGrid.build(m_staticBoxes);
+            m_staticDirty = false;
+        }
+
+        if (m_sleepingDirty) {
+            m_sleepingGrid.build(m_sleepingBoxes);
+            m_sleepingDirty = false;
+        }
+
+        m_awakeDirty = false;
+        if (m_fastMovers.empty()) {
+            m_awakeGrid.build(m_awakeBoxes);
+            return;
+        }
+
+        // Awake bodies first go in with the box covering their whole move,
+        // so a fast mover also finds bodies that crossed its path, then with
+        // their resolved box once impacts are known.
+        m_sweptBoxes.resize(m_awakeBoxes.size());
+        for (size_t index = 0; index < m_awakeBoxes.size(); ++index) {
+            m_sweptBoxes[index] =
+                sweptBox(m_awakeBoxes[index], m_awakeDisplacements[index]);
+        }
+        m_awakeGrid.build(m_sweptBoxes);
+
+        resolveFastMovers();
+        m_awakeGrid.build(m_awakeBoxes);
+    }
+
+    float CollisionWorld::findEarliestImpact(uint32_t const index,
+                                             SweptHit      &hit) const {
+        Vec2 const &displacement = m_awakeDisplacements[index];
+        AABB const &swept        = m_sweptBoxes[index];
+        AABB const  start =
+            translated(m_awakeBoxes[index], displacement * -1.0f);
+        float earliest = 1.0f;
+        bool  found    = false;
+
+        // Bodies the mover does not respond to never stop it.
+        auto const cCollider =
+            m_awakeBodies[index]->getComponent<Components::CCollider>();
+        QueryFilter const stopsAt{.tags   = cCollider->sweepTags,
+                                  .layers = cCollider->sweepLayers};
+
+        auto const sweep = [&](std::shared_ptr<Entity> const &entity,
+                               AABB const &target, Vec2 const &relative,
+                               BodySet const set, uint32_t const other) {
+            float timeOfImpact = 0.0f;
+            if (sweepAABB(start, relative, target, timeOfImpact) &&
+                timeOfImpact <= earliest && stopsAt.accepts(*entity)) {
+                earliest = timeOfImpact;
+                found    = true;
+                hit      = {.mover = index, .set = set, .target = other};
+            }
+        };
+
+        m_staticGrid.query(swept, [&](uint32_t const other) {
+            sweep(m_staticBodies[other], m_staticBoxes[other], displacement,
+                  BodySet::Static, other);
+        });
+        m_sleepingGrid.query(swept, [&](uint32_t const other) {
+            sweep(m_sleepingBodies[other], m_sleepingBoxes[other],
+                  displacement, BodySet::Sleeping, other);
+        });
+        // Other awake bodies move too, so sweep against their start box
+        // with the relative displacement.
+        m_awakeGrid.query(swept, [&](uint32_t const other) {
+            if (other == index) {
+                return;
+            }
+            Vec2 const &otherDisplacement = m_awakeDisplacements[other];
+            sweep(m_awakeBodies[other],
+                  translated(m_awakeBoxes[other], otherDisplacement * -1.0f),
+                  displacement - otherDisplacement, BodySet::Awake, other);
+        });
+
+        return found ? earliest : -1.0f;
+    }
+
+    void CollisionWorld::resolveFastMovers() {
+        for (uint32_t const index : m_fastMovers) {
+            Vec2 const  &displacement = m_awakeDisplacements[index];
+            float const  distance = displacement.euclideanDistance(Vec2{0, 0});
+            if (distance == 0.0f) {
+                continue;
+            }
+
+            SweptHit    hit{};
+            float const impact = findEarliestImpact(index, hit);
+            if (impact < 0.0f) {
+                continue;
+            }
+            m_sweptHits.push_back(hit);
+
+            // Stop just past the impact so the contact overlaps strictly.
+            float const time = std::min(1.0f, impact + SWEEP_SKIN / distance);
+            Vec2 const  rewind = displacement * (time - 1.0f);
+            if (rewind == Vec2{0, 0}) {
+                continue;
+            }
+
+            std::shared_ptr<Entity> const &entity = m_awakeBodies[index];
+            auto const                     cTransform =
+                entity->getComponent<Components::CTransform>();
+            cTransform->topLeftCornerPos += rewind;
+            findSlot(entity->id())->lastPosition = cTransform->topLeftCornerPos;
+
+            m_awakeBoxes[index] = translated(m_awakeBoxes[index], rewind);
+            m_awakeDisplacements[index] = displacement * time;
+        }
+    }
+
+    void CollisionWorld::addSweptPairs() {
+        for (size_t i = 0; i < m_sweptHits.size(); ++i) {
+            SweptHit const &hit = m_sweptHits[i];
+            uint32_t const  a   = hit.mover;
+            uint32_t const  b   = hit.target;
+
+            AABB const *box = nullptr;
+            switch (hit.set) {
+            case BodySet::Static:
+                box = &m_staticBoxes[b];
+                break;
+            case BodySet::Sleeping:
+                box = &m_sleepingBoxes[b];
+                break;
+            case BodySet::Awake:
+                box = &m_awakeBoxes[b];
+                break;
+            }
+            // Still overlapping after the rewind: the grids reported it.
+            if (m_awakeBoxes[a].overlaps(*box)) {
+                continue;
+            }
+
+            if (hit.set != BodySet::Awake) {
+                EntityList const &targets = hit.set == BodySet::Static
+                                                ? m_staticBodies
+                                                : m_sleepingBodies;
+                m_pairs.push_back({m_awakeBodies[a], targets[b], true});
+                if (hit.set == BodySet::Sleeping) {
+                    m_pendingWakes.push_back(targets[b]->id());
+                }
+                continue;
+            }
+
+            // Two fast movers that hit each other both record it.
+            bool const reported =
+                std::any_of(m_sweptHits.begin(), m_sweptHits.begin() + i,
+                            [&](SweptHit const &other) {
+                                return other.set == BodySet::Awake &&
+                                       other.mover == b && other.target == a;
+                            });
+            if (!reported) {
+                m_pairs.push_back({m_awakeBodies[std::min(a, b)],
+                                   m_awakeBodies[std::max(a, b)], true});
+            }
+        }
+    }
+
+    void CollisionWorld::setJobSystem(JobSystem *const jobSystem) {
+        m_jobSystem = jobSystem;
+    }
+
+    void CollisionWorld::runPairTask(size_t const   task,
+                                     uint32_t const cellTasks) {
+        PairTaskOutput &output = m_pairTasks[task];
+        output.pairs.clear();
+        output.wakes.clear();
+        output.tested = 0;
+
+        if (task < cellTasks) {
+            uint32_t const firstCell =
+                static_cast<uint32_t>(task) * CELLS_PER_TASK;
+            uint32_t const lastCell =
+                std::min(firstCell + CELLS_PER_TASK, m_awakeGrid.cellCount());
+            output.tested = m_awakeGrid.forEachPairInCells(
+                firstCell, lastCell, [&](uint32_t const a, uint32_t const b) {
+                    output.pairs.push_back(
+                        {m_awakeBodies[a], m_awakeBodies[b]});
+                });
+            return;
+        }
+
+        size_t const first = (task - cellTasks) * BODIES_PER_TASK;
+        size_t const last =
+            std::min(first + BODIES_PER_TASK, m_awakeBodies.size());
+        for (size_t i = first; i < last; ++i) {
+            AABB const &box = m_awakeBoxes[i];
+
+            output.tested +=
+                m_staticGrid.query(box, [&](uint32_t const index) {
+                    output.pairs.push_back(
+                        {m_awakeBodies[i], m_staticBodies[index]});
+                });
+
+            output.tested +=
+                m_sleepingGrid.query(box, [&](uint32_t const index) {
+                    output.pairs.push_back(
+                        {m_awakeBodies[i], m_sleepingBodies[index]});
+                    output.wakes.push_back(m_sleepingBodies[index]->id());
+                });
+        }
+    }
+
+    void CollisionWorld::generatePairs() {
+        auto const cellTasks = static_cast<uint32_t>(
+            (m_awakeGrid.cellCount() + CELLS_PER_TASK - 1) / CELLS_PER_TASK);
+        size_t const bodyTasks =
+            (m_awakeBodies.size() + BODIES_PER_TASK - 1) / BODIES_PER_TASK;
+        size_t const taskCount = cellTasks + bodyTasks;
+
+        if (m_pairTasks.size() < taskCount) {
+            m_pairTasks.resize(taskCount);
+        }
+
+        auto const task = [&](size_t const index) {
+            runPairTask(index, cellTasks);
+        };
+        if (m_jobSystem != nullptr) {
+            m_jobSystem->parallelFor(taskCount, task);
+        } else {
+            for (size_t index = 0; index < taskCount; ++index) {
+                task(index);
+            }
+        }
+
+        // Merge in task order so the pair list is the same for any number
+        // of threads. Wakes are deferred until every task has finished
+        // reading the sleeping set.
+        m_pairs.clear();
+        m_pendingWakes.clear();
+        m_pairsTested = 0;
+        for (size_t index = 0; index < taskCount; ++index) {
+            PairTaskOutput const &output = m_pairTasks[index];
+            m_pairsTested += output.tested;
+            m_pairs.insert(m_pairs.end(), output.pairs.begin(),
+                           output.pairs.end());
+            m_pendingWakes.insert(m_pendingWakes.end(), output.wakes.begin(),
+                                  output.wakes.end());
+        }
+        // Swept hits whose bodies no longer overlap after the rewind, e.g.
+        // a target that crossed a bullet's path during the tick.
+        addSweptPairs();
+
+        for (size_t const id : m_pendingWakes) {
+            wake(id);
+        }
+
+        static Counter &tested =
+            MetricsRegistry::global().counter("broadphase.pairs_tested");
+        static Counter &hit =
+            MetricsRegistry::global().counter("broadphase.pairs_hit");
+        tested.add(m_pairsTested);
+        hit.add(m_pairs.size());
+    }
+
+    bool CollisionWorld::isResting(ContactPair const &pair) const {
+        auto const isInactiveBody = [this](Entity const &entity) -> bool {
+            BodySlot const *slot = findSlot(entity.id());
+            if (!entity.isActive() || slot == nullptr) {
+                return false;
+            }
+            BodyState const state = slot->state;
+            return state == BodyState::Sleeping || state == BodyState::Static;
+        };
+        return isInactiveBody(*pair.entityA) && isInactiveBody(*pair.entityB);
+    }
+
+    void CollisionWorld::updateContacts() {
+        m_currentContacts.clear();
+        for (ContactPair const &pair : m_pairs) {
+            m_currentContacts.push_back({contactKey(pair), pair});
+        }
+        std::ranges::sort(m_currentContacts, {}, &CachedContact::key);
+
+        m_contactEvents.clear();
+        m_nextContacts.clear();
+
+        // Merge against last update's cache. Both lists are sorted by key,
+        // so every contact is classified in a single pass.
+        size_t previous = 0;
+        size_t current  = 0;
+        while (previous < m_contactCache.size() ||
+               current < m_currentContacts.size()) {
+            bool const hasPrevious = previous < m_contactCache.size();
+            bool const hasCurrent  = current < m_currentContacts.size();
+
+            if (hasPrevious &&
+                (!hasCurrent || m_contactCache[previous].key <
+                                    m_currentContacts[current].key)) {
+                CachedContact const &contact = m_contactCache[previous++];
+                if (isResting(contact.pair)) {
+                    m_contactEvents.push_back({ContactEventType::Stay,
+                                               contact.pair.entityA,
+                                               contact.pair.entityB});
+                    m_nextContacts.push_back(contact);
+                    continue;
+                }
+                m_contactEvents.push_back({ContactEventType::End,
+                                           contact.pair.entityA,
+                                           contact.pair.entityB});
+                continue;
+            }
+
+            CachedContact const &contact = m_currentContacts[current++];
+            ContactEventType     type    = ContactEventType::Begin;
+            if (hasPrevious && m_contactCache[previous].key == contact.key) {
+                type = ContactEventType::Stay;
+                previous += 1;
+            }
+            m_contactEvents.push_back({type, contact.pair.entityA,
+                                       contact.pair.entityB,
+                                       contact.pair.swept});
+            m_nextContacts.push_back(contact);
+        }
+
+        std::swap(m_contactCache, m_nextContacts);
+    }
+
+    void CollisionWorld::colorContacts() {
+        constexpr uint32_t OVERFLOW = MAX_COLORS; // run on its own, last
+
+        m_contactColors.assign(m_contactEvents.size(), OVERFLOW + 1);
+
+        // Null for static bodies, which never conflict.
+        auto const dynamicSlot = [this](Entity const &entity) -> BodySlot * {
+            BodySlot *const slot = findSlot(entity.id());
+            return slot != nullptr && slot->state != BodyState::Static
+                       ? slot
+                       : nullptr;
+        };
+
+        // Greedy colouring in event order: each contact takes the lowest
+        // colour not yet used by either of its dynamic bodies.
+        std::array<uint32_t, MAX_COLORS + 2> counts{};
+        for (size_t i = 0; i < m_contactEvents.size(); ++i) {
+            ContactEvent const &event = m_contactEvents[i];
+            if (event.type == ContactEventType::End) {
+                continue;
+            }
+
+            BodySlot *const slotA = dynamicSlot(*event.entityA);
+            BodySlot *const slotB = dynamicSlot(*event.entityB);
+            Uint64          used  = 0;
+            if (slotA != nullptr) {
+                used |= slotA->usedColors;
+            }
+            if (slotB != nullptr) {
+                used |= slotB->usedColors;
+            }
+
+            uint32_t color = OVERFLOW;
+            if (used != ~Uint64{0}) {
+                color = static_cast<uint32_t>(std::countr_one(used));
+                if (slotA != nullptr) {
+                    slotA->usedColors |= Uint64{1} << color;
+                }
+                if (slotB != nullptr) {
+                    slotB->usedColors |= Uint64{1} << color;
+                }
+            }
+            m_contactColors[i] = color;
+            counts[color + 1] += 1;
+        }
+
+        // Greedy colours are dense, so only the first `colorCount` buckets
+        // are used. Counting sort by colour; the overflow bucket, if any,
+        // becomes the last batch and is run one contact at a time.
+        uint32_t colorCount = 0;
+        while (colorCount < MAX_COLORS && counts[colorCount + 1] > 0) {
+            colorCount += 1;
+        }
+        m_hasOverflowBatch = counts[OVERFLOW + 1] > 0;
+        uint32_t const batchCount =
+            colorCount + (m_hasOverflowBatch ? 1 : 0);
+        auto const batchOf = [&](uint32_t const color) {
+            return color == OVERFLOW ? colorCount : color;
+        };
+
+        m_batchStart.assign(batchCount + 1, 0);
+        for (uint32_t color = 0; color <= OVERFLOW; ++color) {
+            if (counts[color + 1] > 0) {
+                m_batchStart[batchOf(color) + 1] = counts[color + 1];
+            }
+        }
+        for (uint32_t batch = 0; batch < batchCount; ++batch) {
+            m_batchStart[batch + 1] += m_batchStart[batch];
+        }
+        m_batchContacts.resize(m_batchStart.back());
+        std::array<uint32_t, MAX_COLORS + 1> cursor{};
+        std::copy(m_batchStart.begin(), m_batchStart.end() - 1,
+                  cursor.begin());
+        for (size_t i = 0; i < m_contactEvents.size(); ++i) {
+            uint32_t const color = m_contactColors[i];
+            if (color <= OVERFLOW) {
+                m_batchContacts[cursor[batchOf(color)]++] =
+                    static_cast<uint32_t>(i);
+            }
+        }
+
+        for (BodySlot &slot : m_slots) {
+            slot.usedColors = 0;
+        }
+    }
+
+    void CollisionWorld::resolveContacts(
+        FunctionRef<void(ContactEvent const &)> const resolve) {
+        size_t const batchCount = getContactBatchCount();
+        for (size_t batch = 0; batch < batchCount; ++batch) {
+            uint32_t const first = m_batchStart[batch];
+            uint32_t const last  = m_batchStart[batch + 1];
+            if (first == last) {
+                continue;
+            }
+
+            bool const isOverflow =
+                m_hasOverflowBatch && batch + 1 == batchCount;
+            if (m_jobSystem == nullptr || isOverflow) {
+                for (uint32_t i = first; i < last; ++i) {
+                    resolve(m_contactEvents[m_batchContacts[i]]);
+                }
+                continue;
+            }
+
+            size_t const taskCount =
+                (last - first + CONTACTS_PER_TASK - 1) / CONTACTS_PER_TASK;
+            m_jobSystem->parallelFor(taskCount, [&](size_t const task) {
+                uint32_t const taskFirst =
+                    first + static_cast<uint32_t>(task) * CONTACTS_PER_TASK;
+                uint32_t const taskLast =
+                    std::min(taskFirst + CONTACTS_PER_TASK, last);
+                for (uint32_t i = taskFirst; i < taskLast; ++i) {
+                    resolve(m_contactEvents[m_batchContacts[i]]);
+                }
+            });
+        }
+    }
+
+    void CollisionWorld::reserveContacts(size_t const contacts) {
+        m_pairs.reserve(contacts);
+        m_contactCache.reserve(contacts);
+        m_currentContacts.reserve(contacts);
+        m_nextContacts.reserve(contacts);
+        m_contactEvents.reserve(contacts);
+        m_contactColors.reserve(contacts);
+        m_batchContacts.reserve(contacts);
+        m_batchStart.reserve(MAX_COLORS + 2); // every colour and overflow
+    }
+
+    void CollisionWorld::update(EntityManager &entityManager) {
+        syncBodies(entityManager);
+        generatePairs();
+        updateContacts();
+        colorContacts();
+        m_updateCount += 1;
+    }
+
+    std::vector<ContactPair> const &CollisionWorld::getPairs() const {
+        return m_pairs;
+    }
+
+    std::vector<ContactEvent> const &CollisionWorld::getContactEvents() const {
+        return m_contactEvents;
+    }
+
+    size_t CollisionWorld::queryRect(AABB const        &area,
+                                     QueryFilter const &filter,
+                                     EntityList        &results) const {
+        size_t const before = results.size();
+        forEachBodyIn(area, [&](std::shared_ptr<Entity> const &entity,
+                                AABB const &) {
+            if (filter.accepts(*entity)) {
+                results.push_back(entity);
+            }
+        });
+        return results.size() - before;
+    }
+
+    bool CollisionWorld::anyBodyIn(AABB const        &area,
+                                   QueryFilter const &filter) const {
+        bool found = false;
+        forEachBodyIn(area, [&](std::shared_ptr<Entity> const &entity,
+                                AABB const &) {
+            found = found || filter.accepts(*entity);
+        });
+        return found;
+    }
+
+    size_t CollisionWorld::queryRadius(Vec2 const        &center,
+                                       float const        radius,
+                                       QueryFilter const &filter,
+                                       EntityList        &results) const {
+        size_t const before        = results.size();
+        float const  radiusSquared = radius * radius;
+        AABB const   area{center - Vec2{radius, radius},
+                        center + Vec2{radius, radius}};
+
+        forEachBodyIn(area, [&](std::shared_ptr<Entity> const &entity,
+                                AABB const                    &box) {
+            Vec2 const boxCenter = (box.min + box.max) / 2;
+            if (center.euclideanDistanceSquared(boxCenter) < radiusSquared &&
+                filter.accepts(*entity)) {
+                results.push_back(entity);
+            }
+        });
+        return results.size() - before;
+    }
+
+    size_t CollisionWorld::queryNearest(Vec2 const        &center,
+                                        size_t const       count,
+                                        QueryFilter const &filter,
+                                        EntityList        &results) const {
+        if (count == 0) {
+            return 0;
+        }
+
+        // Per thread, since systems that only read the world may query it
+        // concurrently; it stops allocating once it has grown.
+        thread_local std::vector<NearestCandidate> candidates;
+
+        float const maxRadius = m_bounds.euclideanDistance(Vec2{0, 0});
+        float       radius    = m_cellSize;
+
+        while (true) {
+            // Once the circle covers the whole grid, fall back to every
+            // body so ones outside the bounds are still found.
+            bool const  unbounded = radius >= maxRadius;
+            float const limit     = std::numeric_limits<float>::max();
+            AABB const  area =
+                unbounded ? AABB{Vec2{-limit, -limit}, Vec2{limit, limit}}
+                           : AABB{center - Vec2{radius, radius},
+                                 center + Vec2{radius, radius}};
+            float const radiusSquared = unbounded ? limit : radius * radius;
+
+            candidates.clear();
+            forEachBodyIn(area, [&](std::shared_ptr<Entity> const &entity,
+                                    AABB const                    &box) {
+                Vec2 const  boxCenter = (box.min + box.max) / 2;
+                float const distanceSquared =
+                    center.euclideanDistanceSquared(boxCenter);
+                if (distanceSquared < radiusSquared &&
+                    filter.accepts(*entity)) {
+                    candidates.push_back({distanceSquared, &entity});
+                }
+            });
+
+            if (candidates.size() >= count || unbounded) {
+                break;
+            }
+            radius *= 2.0f;
+        }
+
+        size_t const found = std::min(count, candidates.size());
+        std::partial_sort(
+            candidates.begin(), candidates.begin() + found, candidates.end(),
+            [](NearestCandidate const &a, NearestCandidate const &b) {
+                if (a.distanceSquared != b.distanceSquared) {
+                    return a.distanceSquared < b.distanceSquared;
+                }
+                return (*a.entity)->id() < (*b.entity)->id();
+            });
+
+        for (size_t i = 0; i < found; ++i) {
+            results.push_back(*candidates[i].entity);
+        }
+        return found;
+    }
+
+    bool CollisionWorld::isSleeping(size_t const entityId) const {
+        BodySlot const *slot = findSlot(entityId);
+        return slot != nullptr && slot->state == BodyState::Sleeping;
+    }
+
+    bool CollisionWorld::isStatic(size_t const entityId) const {
+        BodySlot const *slot = findSlot(entityId);
+        return slot != nullptr && slot->state == BodyState::Static;
+    }
+
+    void CollisionWorld::wake(size_t const entityId) {
+        BodySlot *const slot = findSlot(entityId);
+        if (slot == nullptr || slot->state != BodyState::Sleeping) {
+            return;
+        }
+
+        slot->state     = BodyState::Awake;
+        slot->idleTicks = 0;
+
+        moveSleepingBodyToAwake(entityId);
+    }
+
+} // namespace YerbEngine
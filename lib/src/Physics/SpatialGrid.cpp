@@ -0,0 +1,86 @@
+#include <Physics/SpatialGrid.hpp>
+
+#include <cmath>
+
+namespace YerbEngine {
+
+    SpatialGrid::SpatialGrid(float const cellSize) : m_cellSize(cellSize) {}
+
+    void SpatialGrid::setBounds(Vec2 const &size) {
+        m_columns = std::max<uint32_t>(
+            1, static_cast<uint32_t>(std::ceil(size.x() / m_cellSize)));
+        m_rows = std::max<uint32_t>(
+            1, static_cast<uint32_t>(std::ceil(size.y() / m_cellSize)));
+        clear();
+    }
+
+    void SpatialGrid::clear() {
+        m_boxes.clear();
+        m_cellItems.clear();
+        m_cellStart.assign(static_cast<size_t>(m_columns) * m_rows + 1, 0);
+    }
+
+    uint32_t SpatialGrid::cellX(float const x) const {
+        float const cell = std::floor(x / m_cellSize);
+        if (!(cell > 0.0f)) {
+            return 0;
+        }
+        return static_cast<uint32_t>(
+            std::min(cell, static_cast<float>(m_columns - 1)));
+    }
+
+    uint32_t SpatialGrid::cellY(float const y) const {
+        float const cell = std::floor(y / m_cellSize);
+        if (!(cell > 0.0f)) {
+            return 0;
+        }
+        return static_cast<uint32_t>(
+            std::min(cell, static_cast<float>(m_rows - 1)));
+    }
+
+    uint32_t SpatialGrid::cellOf(Vec2 const &point) const {
+        return cellY(point.y()) * m_columns + cellX(point.x());
+    }
+
+    void SpatialGrid::build(std::vector<AABB> const &boxes) {
+        m_boxes = boxes;
+
+        size_t const cellCount = static_cast<size_t>(m_columns) * m_rows;
+        m_cellStart.assign(cellCount + 1, 0);
+
+        // First pass: count how many cells each box touches per cell.
+        for (AABB const &box : m_boxes) {
+            uint32_t const x0 = cellX(box.min.x());
+            uint32_t const x1 = cellX(box.max.x());
+            uint32_t const y0 = cellY(box.min.y());
+            uint32_t const y1 = cellY(box.max.y());
+            for (uint32_t y = y0; y <= y1; ++y) {
+                for (uint32_t x = x0; x <= x1; ++x) {
+                    m_cellStart[y * m_columns + x + 1] += 1;
+                }
+            }
+        }
+
+        for (size_t cell = 0; cell < cellCount; ++cell) {
+            m_cellStart[cell + 1] += m_cellStart[cell];
+        }
+
+        // Second pass: scatter body indices into their cell runs.
+        m_cellItems.resize(m_cellStart[cellCount]);
+        m_cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+
+        for (uint32_t index = 0; index < m_boxes.size(); ++index) {
+            AABB const    &box = m_boxes[index];
+            uint32_t const x0  = cellX(box.min.x());
+            uint32_t const x1  = cellX(box.max.x());
+            uint32_t const y0  = cellY(box.min.y());
+            uint32_t const y1  = cellY(box.max.y());
+            for (uint32_t y = y0; y <= y1; ++y) {
+                for (uint32_t x = x0; x <= x1; ++x) {
+                    m_cellItems[m_cursor[y * m_columns + x]++] = index;
+                }
+            }
+        }
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,219 @@
+#include <Physics/SpawnPlacer.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace YerbEngine {
+
+    SpawnPlacer::SpawnPlacer(CollisionWorld const &world,
+                             float const           cellSize)
+        : m_world(world),
+          m_cellSize(cellSize) {}
+
+    void SpawnPlacer::dropStalePlacements() {
+        if (m_placedAtUpdate == m_world.getUpdateCount()) {
+            return;
+        }
+        m_placed.clear();
+        m_placedAtUpdate = m_world.getUpdateCount();
+    }
+
+    void SpawnPlacer::occupy(AABB const &box) {
+        dropStalePlacements();
+        m_placed.push_back(box);
+    }
+
+    bool SpawnPlacer::isFree(AABB const &box) const {
+        if (m_world.anyBodyIn(box)) {
+            return false;
+        }
+
+        // Placements from before the world's last update are in its grids
+        // now (or were destroyed), so only newer ones are checked here.
+        if (m_placedAtUpdate != m_world.getUpdateCount()) {
+            return true;
+        }
+        return std::ranges::none_of(m_placed, [&box](AABB const &placed) {
+            return placed.overlaps(box);
+        });
+    }
+
+    bool SpawnPlacer::isCandidateValid(
+        Vec2 const             &position,
+        Vec2 const             &size,
+        SpawnConstraints const &constraints) const {
+        Vec2 const center = position + size / 2;
+        float const avoidRadiusSquared =
+            constraints.avoidRadius * constraints.avoidRadius;
+        if (center.euclideanDistanceSquared(constraints.avoidCenter) <
+            avoidRadiusSquared) {
+            return false;
+        }
+        return isFree({position, position + size});
+    }
+
+    bool
+    SpawnPlacer::scanForFreeAnchor(std::mt19937           &randomGenerator,
+                                   Vec2 const             &size,
+                                   SpawnConstraints const &constraints,
+                                   Vec2                   &position) {
+        float const minX = constraints.margin;
+        float const minY = constraints.margin;
+        float const maxX = m_bounds.x() - size.x() - constraints.margin;
+        float const maxY = m_bounds.y() - size.y() - constraints.margin;
+
+        // Anchors sit on a lattice of cellSize steps starting at the
+        // margin, which bounds the scan while still finding any gap a step
+        // wider than the box. Each anchor appears once, so picking among
+        // the valid ones is uniform.
+        m_freeAnchors.clear();
+        for (uint32_t row = 0;; ++row) {
+            float const y = minY + static_cast<float>(row) * m_cellSize;
+            if (y > maxY) {
+                break;
+            }
+            for (uint32_t column = 0;; ++column) {
+                float const x = minX + static_cast<float>(column) * m_cellSize;
+                if (x > maxX) {
+                    break;
+                }
+                Vec2 const anchor{x, y};
+                if (isCandidateValid(anchor, size, constraints)) {
+                    m_freeAnchors.push_back(anchor);
+                }
+            }
+        }
+        if (m_freeAnchors.empty()) {
+            return false;
+        }
+
+        std::uniform_int_distribution<size_t> pick(0,
+                                                   m_freeAnchors.size() - 1);
+        position = m_freeAnchors[pick(randomGenerator)];
+        return true;
+    }
+
+    bool SpawnPlacer::sample(std::mt19937           &randomGenerator,
+                             Vec2 const             &size,
+                             SpawnConstraints const &constraints,
+                             Vec2                   &position) {
+        float const minX = constraints.margin;
+        float const minY = constraints.margin;
+        float const maxX = m_bounds.x() - size.x() - constraints.margin;
+        float const maxY = m_bounds.y() - size.y() - constraints.margin;
+        if (maxX < minX || maxY < minY) {
+            return false;
+        }
+
+        std::uniform_real_distribution<float> randomX(minX, maxX);
+        std::uniform_real_distribution<float> randomY(minY, maxY);
+
+        bool found = false;
+        for (int attempt = 0; attempt < RANDOM_ATTEMPTS; ++attempt) {
+            Vec2 const candidate{randomX(randomGenerator),
+                                 randomY(randomGenerator)};
+            if (isCandidateValid(candidate, size, constraints)) {
+                position = candidate;
+                found    = true;
+                break;
+            }
+        }
+
+        if (!found &&
+            !scanForFreeAnchor(randomGenerator, size, constraints, position)) {
+            return false;
+        }
+
+        occupy({position, position + size});
+        return true;
+    }
+
+    size_t SpawnPlacer::sampleBatch(std::mt19937           &randomGenerator,
+                                    Vec2 const             &size,
+                                    size_t const            count,
+                                    float const             minSpacing,
+                                    SpawnConstraints const &constraints,
+                                    std::vector<Vec2>      &positions) {
+        float const minX = constraints.margin;
+        float const minY = constraints.margin;
+        float const maxX = m_bounds.x() - size.x() - constraints.margin;
+        float const maxY = m_bounds.y() - size.y() - constraints.margin;
+        if (count == 0 || maxX < minX || maxY < minY) {
+            return 0;
+        }
+
+        // Background grid with cells small enough that each holds at most
+        // one accepted sample, so spacing is checked against a fixed 5x5
+        // neighbourhood.
+        bool const  spaced = minSpacing > 0.0f;
+        float const diskCellSize =
+            std::max(minSpacing / std::sqrt(2.0f), 1.0f);
+        auto const diskColumns = static_cast<int32_t>(
+            std::ceil(m_bounds.x() / diskCellSize) + 1);
+        auto const diskRows = static_cast<int32_t>(
+            std::ceil(m_bounds.y() / diskCellSize) + 1);
+        if (spaced) {
+            m_diskCells.assign(static_cast<size_t>(diskColumns) * diskRows,
+                               -1);
+        }
+
+        auto const diskCell = [&](float const   value,
+                                  int32_t const cells) {
+            auto const cell =
+                static_cast<int32_t>(std::max(value, 0.0f) / diskCellSize);
+            return std::min(cell, cells - 1);
+        };
+
+        auto const isTooClose = [&](Vec2 const   &center,
+                                    int32_t const cellX,
+                                    int32_t const cellY) {
+            int32_t const lastX = std::min(diskColumns - 1, cellX + 2);
+            int32_t const lastY = std::min(diskRows - 1, cellY + 2);
+            for (int32_t y = std::max(0, cellY - 2); y <= lastY; ++y) {
+                for (int32_t x = std::max(0, cellX - 2); x <= lastX; ++x) {
+                    int32_t const other = m_diskCells[y * diskColumns + x];
+                    if (other < 0) {
+                        continue;
+                    }
+                    Vec2 const otherCenter = positions[other] + size / 2;
+                    if (center.euclideanDistanceSquared(otherCenter) <
+                        minSpacing * minSpacing) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        std::uniform_real_distribution<float> randomX(minX, maxX);
+        std::uniform_real_distribution<float> randomY(minY, maxY);
+
+        size_t const first        = positions.size();
+        size_t       attemptsLeft = count * BATCH_ATTEMPTS;
+
+        while (positions.size() - first < count && attemptsLeft-- > 0) {
+            Vec2 const candidate{randomX(randomGenerator),
+                                 randomY(randomGenerator)};
+            if (!isCandidateValid(candidate, size, constraints)) {
+                continue;
+            }
+
+            if (spaced) {
+                Vec2 const    center = candidate + size / 2;
+                int32_t const cellX  = diskCell(center.x(), diskColumns);
+                int32_t const cellY  = diskCell(center.y(), diskRows);
+                if (isTooClose(center, cellX, cellY)) {
+                    continue;
+                }
+                m_diskCells[cellY * diskColumns + cellX] =
+                    static_cast<int32_t>(positions.size());
+            }
+
+            positions.push_back(candidate);
+            occupy({candidate, candidate + size});
+        }
+
+        return positions.size() - first;
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,64 @@
+#include <Physics/SweptAABB.hpp>
+
+#include <limits>
+
+namespace YerbEngine {
+
+    namespace {
+        // Entry and exit times along one axis. Returns false if the boxes
+        // are separated on this axis and never move towards each other.
+        bool sweepAxis(float const movingMin,
+                       float const movingMax,
+                       float const targetMin,
+                       float const targetMax,
+                       float const delta,
+                       float      &entry,
+                       float      &exit) {
+            if (delta == 0.0f) {
+                if (movingMax <= targetMin || movingMin >= targetMax) {
+                    return false;
+                }
+                entry = -std::numeric_limits<float>::infinity();
+                exit  = std::numeric_limits<float>::infinity();
+                return true;
+            }
+
+            if (delta > 0.0f) {
+                entry = (targetMin - movingMax) / delta;
+                exit  = (targetMax - movingMin) / delta;
+            } else {
+                entry = (targetMax - movingMin) / delta;
+                exit  = (targetMin - movingMax) / delta;
+            }
+            return true;
+        }
+    } // namespace
+
+    bool sweepAABB(AABB const &moving,
+                   Vec2 const &displacement,
+                   AABB const &target,
+                   float      &timeOfImpact) {
+        float entryX = 0.0f;
+        float exitX  = 0.0f;
+        float entryY = 0.0f;
+        float exitY  = 0.0f;
+
+        if (!sweepAxis(moving.min.x(), moving.max.x(), target.min.x(),
+                       target.max.x(), displacement.x(), entryX, exitX) ||
+            !sweepAxis(moving.min.y(), moving.max.y(), target.min.y(),
+                       target.max.y(), displacement.y(), entryY, exitY)) {
+            return false;
+        }
+
+        float const entry = std::max(entryX, entryY);
+        float const exit  = std::min(exitX, exitY);
+
+        if (entry >= exit || entry < 0.0f || entry > 1.0f) {
+            return false;
+        }
+
+        timeOfImpact = entry;
+        return true;
+    }
+
+} // namespace YerbEngine
@@ -0,0 +1,476 @@
+#include <Profiling/AllocationTracker.hpp>
+
+#include <Profiling/Metrics.hpp>
+#include <SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string_view>
+
+// Call sites need a stack walk and a symbol lookup.
+#if YERB_ALLOCATION_TRACKING && __has_include(<execinfo.h>) &&               \
+    __has_include(<dlfcn.h>) && !defined(__EMSCRIPTEN__)
+#define YERB_ALLOCATION_SITES 1
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#else
+#define YERB_ALLOCATION_SITES 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define YERB_CALLER() __builtin_return_address(0)
+#else
+#define YERB_CALLER() nullptr
+#endif
+
+namespace YerbEngine {
+
+    namespace {
+        // Everything here is constant-initialized, since operator new runs
+        // before main and while statics are destroyed.
+        constinit Counter g_allocations;
+        constinit Counter g_frees;
+        constinit Counter g_bytes;
+
+        thread_local constinit AllocationCounts   t_counts;
+        thread_local constinit NoAllocationScope *t_noAllocation = nullptr;
+        // Set while the tracker itself runs, so it cannot recurse.
+        thread_local constinit bool t_inTracker = false;
+
+        struct Site {
+            std::atomic<uint64_t> key{0}; // stack hash; 0 = free
+            std::atomic<bool>     ready{false};
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> bytes{0};
+            std::array<void *, AllocationTracker::MAX_FRAMES> frames{};
+            size_t                                            depth = 0;
+        };
+
+        // Open addressing; a stack probes this many slots before it is
+        // dropped.
+        constexpr size_t MAX_PROBES = 64;
+
+        constinit std::array<Site, AllocationTracker::MAX_SITES> g_sites{};
+        constinit std::atomic<bool>     g_siteTracking{false};
+        constinit std::atomic<uint64_t> g_droppedSites{0};
+
+        using Stack = std::array<void *, AllocationTracker::MAX_FRAMES>;
+
+        // Fills `out` with the stack from `caller` outwards.
+        size_t captureStack(void const *caller,
+                            Stack      &out) {
+#if YERB_ALLOCATION_SITES
+            // Room for the tracker's own frames, which are skipped.
+            std::array<void *, AllocationTracker::MAX_FRAMES + 8> raw;
+            int const depth =
+                backtrace(raw.data(), static_cast<int>(raw.size()));
+            int       first = 0;
+            for (int i = 0; i < depth; ++i) {
+                if (raw[i] == caller) {
+                    first = i;
+                    break;
+                }
+            }
+            size_t const count =
+                std::min(static_cast<size_t>(depth - first), out.size());
+            std::copy_n(raw.begin() + first, count, out.begin());
+            return count;
+#else
+            static_cast<void>(caller);
+            static_cast<void>(out);
+            return 0;
+#endif
+        }
+
+        std::string describeFrame(void *const address) {
+            std::ostringstream out;
+#if YERB_ALLOCATION_SITES
+            Dl_info info;
+            if (dladdr(address, &info) == 0) {
+                out << address;
+                return out.str();
+            }
+            if (info.dli_sname != nullptr) {
+                int   status    = 0;
+                char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr,
+                                                      nullptr, &status);
+                out << (status == 0 ? demangled : info.dli_sname) << "+0x"
+                    << std::hex
+                    << (static_cast<char *>(address) -
+                        static_cast<char *>(info.dli_saddr));
+                std::free(demangled);
+                return out.str();
+            }
+            if (info.dli_fname != nullptr) {
+                std::string_view module = info.dli_fname;
+                module = module.substr(module.find_last_of('/') + 1);
+                out << module << "+0x" << std::hex
+                    << (static_cast<char *>(address) -
+                        static_cast<char *>(info.dli_fbase));
+                return out.str();
+            }
+#endif
+            out << address;
+            return out.str();
+        }
+
+        std::vector<std::string> describeStack(Stack const &stack,
+                                               size_t const depth) {
+            std::vector<std::string> frames;
+            frames.reserve(depth);
+            for (size_t i = 0; i < depth; ++i) {
+                frames.push_back(describeFrame(stack[i]));
+            }
+            return frames;
+        }
+
+        void recordSite(size_t const      size,
+                        void const *const caller) {
+            Stack        stack;
+            size_t const depth = captureStack(caller, stack);
+            if (depth == 0) {
+                return;
+            }
+
+            // FNV-1a over the frame addresses; 0 marks a free slot.
+            uint64_t key = 14695981039346656037ull;
+            for (size_t i = 0; i < depth; ++i) {
+                key ^= reinterpret_cast<uintptr_t>(stack[i]);
+                key *= 1099511628211ull;
+            }
+            key = std::max<uint64_t>(key, 1);
+
+            for (size_t probe = 0; probe < MAX_PROBES; ++probe) {
+                Site &site = g_sites[(key + probe) % g_sites.size()];
+                uint64_t current = site.key.load(std::memory_order_acquire);
+                if (current == 0 &&
+                    site.key.compare_exchange_strong(
+                        current, key, std::memory_order_acq_rel)) {
+                    site.frames = stack;
+                    site.depth  = depth;
+                    site.ready.store(true, std::memory_order_release);
+                    current = key;
+                }
+                if (current == key) {
+                    site.allocations.fetch_add(1, std::memory_order_relaxed);
+                    site.bytes.fetch_add(size, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            g_droppedSites.fetch_add(1, std::memory_order_relaxed);
+        }
+    } // namespace
+
+    void noteSteadyStateAllocation(size_t const      size,
+                                   void const *const caller) {
+        NoAllocationScope *const scope = t_noAllocation;
+        if (scope == nullptr || scope->m_captured) {
+            return;
+        }
+        scope->m_captured   = true;
+        scope->m_firstSize  = size;
+        scope->m_firstDepth = captureStack(caller, scope->m_firstStack);
+    }
+
+#if YERB_ALLOCATION_TRACKING
+    namespace {
+        void noteAllocation(size_t const      size,
+                            void const *const caller) {
+            t_counts.allocations += 1;
+            t_counts.bytes       += size;
+            g_allocations.add();
+            g_bytes.add(size);
+
+            if (t_inTracker) {
+                return;
+            }
+            t_inTracker = true;
+            noteSteadyStateAllocation(size, caller);
+            if (g_siteTracking.load(std::memory_order_relaxed)) {
+                recordSite(size, caller);
+            }
+            t_inTracker = false;
+        }
+
+        void noteFree(void const *const pointer) {
+            if (pointer != nullptr) {
+                t_counts.frees += 1;
+                g_frees.add();
+            }
+        }
+    } // namespace
+#endif
+
+    bool AllocationTracker::canTrackSites() { return YERB_ALLOCATION_SITES; }
+
+    AllocationCounts AllocationTracker::getThreadCounts() { return t_counts; }
+
+    AllocationCounts AllocationTracker::getTotalCounts() {
+        return {.allocations = g_allocations.get(),
+                .frees       = g_frees.get(),
+                .bytes       = g_bytes.get()};
+    }
+
+    void AllocationTracker::setSiteTracking(bool const enabled) {
+        g_siteTracking.store(enabled && canTrackSites(),
+                             std::memory_order_relaxed);
+    }
+
+    bool AllocationTracker::isSiteTracking() {
+        return g_siteTracking.load(std::memory_order_relaxed);
+    }
+
+    std::vector<AllocationSite>
+    AllocationTracker::getTopSites(size_t const limit) {
+        std::vector<Site const *> sites;
+        for (Site const &site : g_sites) {
+            if (site.ready.load(std::memory_order_acquire)) {
+                sites.push_back(&site);
+            }
+        }
+        auto const allocations = [](Site const *site) {
+            return site->allocations.load(std::memory_order_relaxed);
+        };
+        size_t const count = std::min(limit, sites.size());
+        std::ranges::partial_sort(sites, sites.begin() + count,
+                                  std::ranges::greater{}, allocations);
+
+        std::vector<AllocationSite> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            Site const &site = *sites[i];
+            result.push_back(
+                {.frames      = describeStack(site.frames, site.depth),
+                 .allocations = allocations(&site),
+                 .bytes       = site.bytes.load(std::memory_order_relaxed)});
+        }
+        return result;
+    }
+
+    uint64_t AllocationTracker::getDroppedSiteCount() {
+        return g_droppedSites.load(std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::logTopSites(size_t const limit) {
+        for (AllocationSite const &site : getTopSites(limit)) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "%llu allocations, %llu bytes:",
+                        static_cast<unsigned long long>(site.allocations),
+                        static_cast<unsigned long long>(site.bytes));
+            for (std::string const &frame : site.frames) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "    at %s",
+                            frame.c_str());
+            }
+        }
+        if (uint64_t const dropped = getDroppedSiteCount(); dropped > 0) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                        "%llu allocations had no room in the site table.",
+                        static_cast<unsigned long long>(dropped));
+        }
+    }
+
+    AllocationScope::AllocationScope()
+        : m_start(t_counts) {}
+
+    AllocationCounts AllocationScope::getCounts() const {
+        return t_counts - m_start;
+    }
+
+    NoAllocationScope::NoAllocationScope(char const *const label)
+        : m_label(label),
+          m_previous(t_noAllocation) {
+        t_noAllocation = this;
+    }
+
+    NoAllocationScope::~NoAllocationScope() {
+        t_noAllocation = m_previous;
+        uint64_t const violations = getViolations();
+        if (violations == 0) {
+            return;
+        }
+
+        SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                     "%llu allocations during '%s'; the first was %zu "
+                     "bytes.",
+                     static_cast<unsigned long long>(violations), m_label,
+                     m_firstSize);
+        for (std::string const &frame : getFirstStack()) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "    at %s", frame.c_str());
+        }
+    }
+
+    std::vector<std::string> NoAllocationScope::getFirstStack() const {
+        return describeStack(m_firstStack, m_firstDepth);
+    }
+
+} // namespace YerbEngine
+
+#if YERB_ALLOCATION_TRACKING
+
+namespace {
+    void *allocate(std::size_t const size,
+                   std::size_t const alignment,
+                   void const *const caller) {
+        std::size_t const bytes = std::max<std::size_t>(size, 1);
+        for (;;) {
+            void *pointer = nullptr;
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                pointer = std::malloc(bytes);
+            } else {
+#if defined(_WIN32)
+                pointer = _aligned_malloc(bytes, alignment);
+#else
+                // aligned_alloc wants a multiple of the alignment.
+                pointer = std::aligned_alloc(
+                    alignment, (bytes + alignment - 1) / alignment * alignment);
+#endif
+            }
+            if (pointer != nullptr) {
+                YerbEngine::noteAllocation(size, caller);
+                return pointer;
+            }
+
+            std::new_handler const handler = std::get_new_handler();
+            if (handler == nullptr) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void deallocate(void *const       pointer,
+                    std::size_t const alignment) noexcept {
+        YerbEngine::noteFree(pointer);
+#if defined(_WIN32)
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            _aligned_free(pointer);
+            return;
+        }
+#else
+        static_cast<void>(alignment);
+#endif
+        std::free(pointer);
+    }
+
+    constexpr std::size_t DEFAULT_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+} // namespace
+
+void *operator new(std::size_t const size) {
+    return allocate(size, DEFAULT_ALIGNMENT, YERB_CALLER());
+}
+
+void *operator new[](std::size_t const size) {
+    return allocate(size, DEFAULT_ALIGNMENT, YERB_CALLER());
+}
+
+void *operator new(std::size_t const size,
+                   std::align_val_t const alignment) {
+    return allocate(size, static_cast<std::size_t>(alignment), YERB_CALLER());
+}
+
+void *operator new[](std::size_t const size,
+                     std::align_val_t const alignment) {
+    return allocate(size, static_cast<std::size_t>(alignment), YERB_CALLER());
+}
+
+void *operator new(std::size_t const size, std::nothrow_t const &) noexcept {
+    try {
+        return allocate(size, DEFAULT_ALIGNMENT, YERB_CALLER());
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t const size,
+                     std::nothrow_t const &) noexcept {
+    try {
+        return allocate(size, DEFAULT_ALIGNMENT, YERB_CALLER());
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void *operator new(std::size_t const size,
+                   std::align_val_t const alignment,
+                   std::nothrow_t const &) noexcept {
+    try {
+        return allocate(size, static_cast<std::size_t>(alignment),
+                        YERB_CALLER());
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t const size,
+                     std::align_val_t const alignment,
+                     std::nothrow_t const &) noexcept {
+    try {
+        return allocate(size, static_cast<std::size_t>(alignment),
+                        YERB_CALLER());
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *const pointer) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void *const pointer) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void *const pointer, std::size_t) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void *const pointer, std::size_t) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void *const pointer,
+                     std::align_val_t const alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *const pointer,
+                       std::align_val_t const alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *const pointer,
+                     std::size_t,
+                     std::align_val_t const alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *const pointer,
+                       std::size_t,
+                       std::align_val_t const alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *const pointer, std::nothrow_t const &) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void *const pointer, std::nothrow_t const &) noexcept {
+    deallocate(pointer, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void *const pointer,
+                     std::align_val_t const alignment,
+                     std::nothrow_t const &) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *const pointer,
+                       std::align_val_t const alignment,
+                       std::nothrow_t const &) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+#endif
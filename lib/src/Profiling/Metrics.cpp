@@ -0,0 +1,338 @@
+#include <Profiling/Metrics.hpp>
+
+#include <SDL.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace YerbEngine {
+
+    namespace Metrics {
+        size_t threadShard() {
+            static std::atomic<size_t> next{0};
+            thread_local size_t const shard =
+                next.fetch_add(1, std::memory_order_relaxed) %
+                Counter::SHARDS;
+            return shard;
+        }
+    } // namespace Metrics
+
+    namespace {
+        // Nearest-rank percentile over bucket counts totalling `count`.
+        uint64_t percentile(
+            std::array<uint64_t, Histogram::BUCKETS> const &buckets,
+            uint64_t const                                  count,
+            double const                                    fraction) {
+            auto const rank = std::max<uint64_t>(
+                1, static_cast<uint64_t>(
+                       std::ceil(fraction * static_cast<double>(count))));
+            uint64_t seen = 0;
+            for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+                seen += buckets[bucket];
+                if (seen >= rank) {
+                    return Histogram::bucketHighest(bucket);
+                }
+            }
+            return Histogram::MAX_VALUE;
+        }
+    } // namespace
+
+    uint64_t Counter::get() const {
+        uint64_t total = 0;
+        for (Shard const &shard : m_shards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    Histogram::Histogram(std::string unit)
+        : m_unit(std::move(unit)) {}
+
+    size_t Histogram::bucketOf(uint64_t value) {
+        value = std::min(value, MAX_VALUE);
+        if (value < 2 * SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        // value >> shift lands in [SUB_BUCKETS, 2 * SUB_BUCKETS).
+        auto const shift =
+            static_cast<unsigned>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKETS +
+                                   (value >> shift) - SUB_BUCKETS);
+    }
+
+    uint64_t Histogram::bucketHighest(size_t const bucket) {
+        if (bucket < 2 * SUB_BUCKETS) {
+            return bucket;
+        }
+        uint64_t const shift    = bucket / SUB_BUCKETS - 1;
+        uint64_t const mantissa = bucket % SUB_BUCKETS + SUB_BUCKETS;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    void Histogram::record(uint64_t const value) {
+        m_buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(
+                                  max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    HistogramStats
+    Histogram::stats(std::array<uint64_t, BUCKETS> const &buckets,
+                     uint64_t const                       sum,
+                     uint64_t const                       max) const {
+        HistogramStats result;
+        for (uint64_t const count : buckets) {
+            result.count += count;
+        }
+        if (result.count == 0) {
+            return result;
+        }
+
+        auto const clamp = [max](uint64_t const value) {
+            return static_cast<double>(std::min(value, max));
+        };
+        result.mean =
+            static_cast<double>(sum) / static_cast<double>(result.count);
+        result.p50 = clamp(percentile(buckets, result.count, 0.50));
+        result.p95 = clamp(percentile(buckets, result.count, 0.95));
+        result.p99 = clamp(percentile(buckets, result.count, 0.99));
+        result.max = static_cast<double>(max);
+        return result;
+    }
+
+    HistogramStats Histogram::getStats() const {
+        std::array<uint64_t, BUCKETS> buckets;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        }
+        return stats(buckets, m_sum.load(std::memory_order_relaxed),
+                     m_max.load(std::memory_order_relaxed));
+    }
+
+    HistogramStats Histogram::takeWindow() {
+        // Values recorded while this runs land in one window or the next.
+        std::array<uint64_t, BUCKETS> buckets;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            buckets[i] = m_buckets[i].exchange(0, std::memory_order_relaxed);
+        }
+        return stats(buckets, m_sum.exchange(0, std::memory_order_relaxed),
+                     m_max.exchange(0, std::memory_order_relaxed));
+    }
+
+    char const *toString(MetricKind const kind) {
+        switch (kind) {
+        case MetricKind::Counter:
+            return "counter";
+        case MetricKind::Gauge:
+            return "gauge";
+        case MetricKind::Histogram:
+            return "histogram";
+        }
+        return "unknown";
+    }
+
+    MetricsRegistry &MetricsRegistry::global() {
+        // Never destroyed: metrics may still be updated during exit.
+        static auto *instance = new MetricsRegistry;
+        return *instance;
+    }
+
+    void MetricsRegistry::checkUnused(std::string_view const name,
+                                      MetricKind const       kind) const {
+        bool const taken =
+            (kind != MetricKind::Counter && m_counters.contains(name)) ||
+            (kind != MetricKind::Gauge && m_gauges.contains(name)) ||
+            (kind != MetricKind::Histogram && m_histograms.contains(name));
+        if (taken) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Metric '%.*s' is already registered as another "
+                         "kind than %s.",
+                         static_cast<int>(name.size()), name.data(),
+                         toString(kind));
+            throw std::runtime_error("Metric kind mismatch: " +
+                                     std::string(name));
+        }
+    }
+
+    Counter &MetricsRegistry::counter(std::string_view const name) {
+        std::lock_guard lock(m_mutex);
+        if (auto const it = m_counters.find(name); it != m_counters.end()) {
+            return *it->second;
+        }
+        checkUnused(name, MetricKind::Counter);
+        return *m_counters.emplace(name, std::make_unique<Counter>())
+                    .first->second;
+    }
+
+    Gauge &MetricsRegistry::gauge(std::string_view const name) {
+        std::lock_guard lock(m_mutex);
+        if (auto const it = m_gauges.find(name); it != m_gauges.end()) {
+            return *it->second;
+        }
+        checkUnused(name, MetricKind::Gauge);
+        return *m_gauges.emplace(name, std::make_unique<Gauge>())
+                    .first->second;
+    }
+
+    Histogram &MetricsRegistry::histogram(std::string_view const name,
+                                          std::string_view const unit) {
+        std::lock_guard lock(m_mutex);
+        if (auto const it = m_histograms.find(name);
+            it != m_histograms.end()) {
+            return *it->second;
+        }
+        checkUnused(name, MetricKind::Histogram);
+        return *m_histograms
+                    .emplace(name,
+                             std::make_unique<Histogram>(std::string(unit)))
+                    .first->second;
+    }
+
+    Counter const *
+    MetricsRegistry::findCounter(std::string_view const name) const {
+        std::lock_guard lock(m_mutex);
+        auto const      it = m_counters.find(name);
+        return it == m_counters.end() ? nullptr : it->second.get();
+    }
+
+    Gauge const *MetricsRegistry::findGauge(std::string_view const name) const {
+        std::lock_guard lock(m_mutex);
+        auto const      it = m_gauges.find(name);
+        return it == m_gauges.end() ? nullptr : it->second.get();
+    }
+
+    Histogram const *
+    MetricsRegistry::findHistogram(std::string_view const name) const {
+        std::lock_guard lock(m_mutex);
+        auto const      it = m_histograms.find(name);
+        return it == m_histograms.end() ? nullptr : it->second.get();
+    }
+
+    MetricsWindow MetricsRegistry::closeWindow() {
+        std::lock_guard lock(m_mutex);
+        auto const      now     = Clock::now();
+        auto const      seconds = [this](Clock::time_point const time) {
+            return std::chrono::duration<double>(time - m_start).count();
+        };
+
+        MetricsWindow window{.index        = m_windows++,
+                             .startSeconds = seconds(m_windowStart),
+                             .endSeconds   = seconds(now)};
+        m_windowStart = now;
+        window.metrics.reserve(m_counters.size() + m_gauges.size() +
+                               m_histograms.size());
+
+        for (auto const &[name, counter] : m_counters) {
+            uint64_t const total = counter->get();
+            window.metrics.push_back(
+                {.name  = name,
+                 .kind  = MetricKind::Counter,
+                 .value = static_cast<double>(total),
+                 .delta = static_cast<double>(total - counter->m_windowStart)});
+            counter->m_windowStart = total;
+        }
+        for (auto const &[name, gauge] : m_gauges) {
+            window.metrics.push_back({.name  = name,
+                                      .kind  = MetricKind::Gauge,
+                                      .value = gauge->get()});
+        }
+        for (auto const &[name, histogram] : m_histograms) {
+            HistogramStats const stats = histogram->takeWindow();
+            window.metrics.push_back({.name  = name,
+                                      .kind  = MetricKind::Histogram,
+                                      .unit  = histogram->getUnit(),
+                                      .value = static_cast<double>(stats.count),
+                                      .stats = stats});
+        }
+
+        std::ranges::sort(window.metrics, {}, &MetricValue::name);
+        return window;
+    }
+
+    MetricsFile::MetricsFile(std::filesystem::path path)
+        : m_path(std::move(path)),
+          m_file(m_path, std::ios::trunc),
+          m_json(m_path.extension() == ".json") {
+        if (!m_file.is_open()) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Failed to create metrics file: %s",
+                         m_path.string().c_str());
+            throw std::runtime_error("Failed to create metrics file: " +
+                                     m_path.string());
+        }
+
+        if (m_json) {
+            m_file << "{\"windows\":[";
+        } else {
+            m_file << "window,start_s,end_s,name,kind,unit,value,delta,"
+                      "count,mean,p50,p95,p99,max\n";
+        }
+        m_file.flush();
+    }
+
+    MetricsFile::~MetricsFile() {
+        if (m_json && m_file.is_open()) {
+            m_file << "\n]}\n";
+        }
+    }
+
+    void MetricsFile::write(MetricsWindow const &window) {
+        if (m_json) {
+            nlohmann::json entry = {{"index", window.index},
+                                    {"start", window.startSeconds},
+                                    {"end", window.endSeconds}};
+            nlohmann::json &metrics = entry["metrics"];
+            metrics                 = nlohmann::json::object();
+            for (MetricValue const &metric : window.metrics) {
+                nlohmann::json value = {{"kind", toString(metric.kind)}};
+                switch (metric.kind) {
+                case MetricKind::Counter:
+                    value["total"] = metric.value;
+                    value["delta"] = metric.delta;
+                    break;
+                case MetricKind::Gauge:
+                    value["value"] = metric.value;
+                    break;
+                case MetricKind::Histogram:
+                    value["unit"]  = metric.unit;
+                    value["count"] = metric.stats.count;
+                    value["mean"]  = metric.stats.mean;
+                    value["p50"]   = metric.stats.p50;
+                    value["p95"]   = metric.stats.p95;
+                    value["p99"]   = metric.stats.p99;
+                    value["max"]   = metric.stats.max;
+                    break;
+                }
+                metrics[metric.name] = std::move(value);
+            }
+            m_file << (m_written == 0 ? "\n" : ",\n") << entry.dump();
+        } else {
+            for (MetricValue const &metric : window.metrics) {
+                HistogramStats const &stats = metric.stats;
+                m_file << window.index << ',' << window.startSeconds << ','
+                       << window.endSeconds << ',' << metric.name << ','
+                       << toString(metric.kind) << ',' << metric.unit << ','
+                       << metric.value << ',' << metric.delta << ','
+                       << stats.count << ',' << stats.mean << ','
+                       << stats.p50 << ',' << stats.p95 << ',' << stats.p99
+                       << ',' << stats.max << '\n';
+            }
+        }
+        m_file.flush();
+        m_written += 1;
+
+        if (!m_file) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Failed to write metrics file: %s",
+                         m_path.string().c_str());
+            throw std::runtime_error("Failed to write metrics file: " +
+                                     m_path.string());
+        }
+    }
+
+} // namespace YerbEngine
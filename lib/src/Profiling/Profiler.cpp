@@ -0,0 +1,345 @@
+#include <Profiling/Profiler.hpp>
+
+#include <SDL.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define YERB_PROFILER_TSC 1
+#else
+#define YERB_PROFILER_TSC 0
+#endif
+
+namespace YerbEngine {
+
+    std::atomic<bool> Profiler::s_capturing{false};
+
+    namespace {
+        using SteadyClock = std::chrono::steady_clock;
+
+        struct ZoneEvent {
+            char const *name;
+            uint64_t    start;
+            uint64_t    end;
+        };
+
+        // Bumped by each startCapture(). A buffer whose generation is
+        // behind holds an older capture and reads as empty; its owner
+        // clears it on its next zone, so no other thread writes count.
+        constinit std::atomic<uint64_t> g_generation{0};
+
+        struct ThreadBuffer {
+            std::array<ZoneEvent, Profiler::EVENTS_PER_THREAD> events;
+            // Only the owning thread advances count; readers acquire it.
+            std::atomic<size_t>   count{0};
+            std::atomic<size_t>   dropped{0};
+            std::atomic<uint64_t> generation{0};
+            size_t                tid = 0;
+            std::string           name;
+
+            size_t getCount(uint64_t const current) const {
+                return generation.load(std::memory_order_acquire) == current
+                           ? count.load(std::memory_order_acquire)
+                           : 0;
+            }
+
+            size_t getDropped(uint64_t const current) const {
+                return generation.load(std::memory_order_acquire) == current
+                           ? dropped.load(std::memory_order_relaxed)
+                           : 0;
+            }
+        };
+
+        // Pairs a profiler clock reading with the steady clock, so captures
+        // can be converted to microseconds whatever the clock ticks in.
+        struct ClockSample {
+            uint64_t                ticks = 0;
+            SteadyClock::time_point steady;
+
+            static ClockSample take() {
+                return {Profiler::now(), SteadyClock::now()};
+            }
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            // Buffers outlive their threads so a capture can still be
+            // written after a worker pool shuts down.
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            // Buffers of exited threads, handed to the next new thread
+            // once they no longer hold the current capture.
+            std::vector<ThreadBuffer *> released;
+            // A deque never moves its elements, so views into it stay valid.
+            std::deque<std::string>              names;
+            std::unordered_set<std::string_view> interned;
+            ClockSample                          captureStart;
+            ClockSample                          captureEnd;
+        };
+
+        Registry &registry() {
+            // Never destroyed: threads may still record during exit.
+            static auto *instance = new Registry;
+            return *instance;
+        }
+
+        thread_local ThreadBuffer *t_buffer   = nullptr;
+        thread_local bool          t_released = false;
+        thread_local std::string   t_name;
+
+        // Returns the thread's buffer to the registry when the thread
+        // exits.
+        struct BufferRelease {
+            ~BufferRelease() {
+                if (t_buffer == nullptr) {
+                    return;
+                }
+                Registry       &reg = registry();
+                std::lock_guard lock(reg.mutex);
+                reg.released.push_back(t_buffer);
+                t_buffer   = nullptr;
+                t_released = true;
+            }
+        };
+
+        // Null once the thread's buffer was released, for zones in other
+        // thread_local destructors that run after it.
+        ThreadBuffer *acquireBuffer() {
+            if (t_released) {
+                return nullptr;
+            }
+
+            Registry       &reg = registry();
+            std::lock_guard lock(reg.mutex);
+            uint64_t const  current  = g_generation.load();
+            auto const      reusable = std::ranges::find_if(
+                reg.released, [current](ThreadBuffer const *buffer) {
+                    return buffer->getCount(current) == 0 &&
+                           buffer->getDropped(current) == 0;
+                });
+            if (reusable != reg.released.end()) {
+                t_buffer = *reusable;
+                reg.released.erase(reusable);
+            } else {
+                auto buffer = std::make_unique<ThreadBuffer>();
+                buffer->tid = reg.buffers.size() + 1;
+                t_buffer    = buffer.get();
+                reg.buffers.push_back(std::move(buffer));
+            }
+            t_buffer->name = t_name;
+            if (t_buffer->name.empty()) {
+                t_buffer->name = "Thread " + std::to_string(t_buffer->tid);
+            }
+
+            // Constructed on the thread's first zone rather than beside
+            // t_buffer, so zones read a plain pointer.
+            thread_local BufferRelease const release;
+            return t_buffer;
+        }
+
+        void writeEscaped(std::ostream &out, std::string_view const text) {
+            out << '"';
+            for (char const c : text) {
+                switch (c) {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out << "\\u" << std::hex << std::setw(4)
+                            << std::setfill('0') << static_cast<int>(c)
+                            << std::dec << std::setfill(' ');
+                    } else {
+                        out << c;
+                    }
+                }
+            }
+            out << '"';
+        }
+    } // namespace
+
+    uint64_t Profiler::now() {
+#if YERB_PROFILER_TSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                SteadyClock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    void Profiler::record(char const    *name,
+                          uint64_t const start,
+                          uint64_t const end) {
+        ThreadBuffer *const buffer =
+            t_buffer != nullptr ? t_buffer : acquireBuffer();
+        if (buffer == nullptr) {
+            return;
+        }
+
+        uint64_t const current = g_generation.load(std::memory_order_relaxed);
+        if (buffer->generation.load(std::memory_order_relaxed) != current) {
+            // First zone of a new capture on this thread.
+            buffer->count.store(0, std::memory_order_relaxed);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+            buffer->generation.store(current, std::memory_order_release);
+        }
+
+        size_t const index = buffer->count.load(std::memory_order_relaxed);
+        if (index >= EVENTS_PER_THREAD) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer->events[index] = {name, start, end};
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+    void Profiler::startCapture() {
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        // Buffers are cleared by their own threads, not here, as a thread
+        // may be mid-zone.
+        g_generation.fetch_add(1);
+        reg.captureStart = ClockSample::take();
+        reg.captureEnd   = reg.captureStart;
+        s_capturing.store(true, std::memory_order_relaxed);
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Profiler capture started.");
+    }
+
+    void Profiler::stopCapture() {
+        if (!s_capturing.exchange(false, std::memory_order_relaxed)) {
+            return;
+        }
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        reg.captureEnd = ClockSample::take();
+    }
+
+    void Profiler::writeChromeTrace(std::filesystem::path const &path) {
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+
+        ClockSample const end =
+            isCapturing() ? ClockSample::take() : reg.captureEnd;
+        double const elapsedUs =
+            std::chrono::duration<double, std::micro>(
+                end.steady - reg.captureStart.steady)
+                .count();
+        double const ticksPerUs =
+            elapsedUs > 0.0 && end.ticks > reg.captureStart.ticks
+                ? static_cast<double>(end.ticks - reg.captureStart.ticks) /
+                      elapsedUs
+                : 1.0;
+        auto const toUs = [&](uint64_t const ticks) {
+            return (static_cast<double>(ticks) -
+                    static_cast<double>(reg.captureStart.ticks)) /
+                   ticksPerUs;
+        };
+
+        std::ofstream file(path, std::ios::trunc);
+        file << std::fixed << std::setprecision(3)
+             << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        char const *separator = "\n";
+        size_t      written   = 0;
+        size_t      dropped   = 0;
+        uint64_t const current = g_generation.load();
+        for (auto const &buffer : reg.buffers) {
+            file << separator
+                 << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,"
+                    "\"tid\":"
+                 << buffer->tid << ",\"args\":{\"name\":";
+            writeEscaped(file, buffer->name);
+            file << "}}";
+            separator = ",\n";
+
+            size_t const count = buffer->getCount(current);
+            for (size_t i = 0; i < count; ++i) {
+                ZoneEvent const &event = buffer->events[i];
+                file << separator << "{\"ph\":\"X\",\"name\":";
+                writeEscaped(file, event.name);
+                file << ",\"pid\":1,\"tid\":" << buffer->tid
+                     << ",\"ts\":" << toUs(event.start)
+                     << ",\"dur\":" << toUs(event.end) - toUs(event.start)
+                     << "}";
+            }
+            written += count;
+            dropped += buffer->getDropped(current);
+        }
+        file << "\n]}\n";
+
+        if (!file) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                         "Failed to write profiler trace: %s",
+                         path.string().c_str());
+            throw std::runtime_error("Failed to write profiler trace: " +
+                                     path.string());
+        }
+
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Wrote %zu zones (%zu dropped) to %s.", written,
+                    dropped, path.string().c_str());
+    }
+
+    char const *Profiler::intern(std::string_view const name) {
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+
+        if (auto const it = reg.interned.find(name);
+            it != reg.interned.end()) {
+            return it->data();
+        }
+        reg.names.emplace_back(name);
+        reg.interned.emplace(reg.names.back());
+        return reg.names.back().c_str();
+    }
+
+    void Profiler::setThreadName(std::string_view const name) {
+        t_name = name;
+        if (t_buffer != nullptr) {
+            Registry       &reg = registry();
+            std::lock_guard lock(reg.mutex);
+            t_buffer->name = t_name;
+        }
+    }
+
+    size_t Profiler::getRecordedCount() {
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        uint64_t const  current = g_generation.load();
+        size_t          total   = 0;
+        for (auto const &buffer : reg.buffers) {
+            total += buffer->getCount(current);
+        }
+        return total;
+    }
+
+    size_t Profiler::getDroppedCount() {
+        Registry       &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        uint64_t const  current = g_generation.load();
+        size_t          total   = 0;
+        for (auto const &buffer : reg.buffers) {
+            total += buffer->getDropped(current);
+        }
+        return total;
+    }
+
+} // namespace YerbEngine
@@ -1,12 +1,22 @@
 #include <SystemManagement/AudioManager.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace YerbEngine {
 
     AudioManager::AudioManager(AudioInitOptions options)
         : m_frequency(options.frequency),
           m_format(options.format),
           m_channels(options.channels),
-          m_chunksize(options.chunksize) {
+          m_chunksize(options.chunksize),
+          m_nullDevice(options.nullDevice) {
+        if (m_nullDevice) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+                        "Audio disabled: using a null audio device.");
+            return;
+        }
+
         if (SDL_Init(SDL_INIT_AUDIO) != 0) {
             throw std::runtime_error("SDL_Init failed");
         }
@@ -181,6 +191,10 @@ namespace YerbEngine {
             }
         }
 
+        if (m_nullDevice) {
+            return;
+        }
+
         Mix_CloseAudio();
         Mix_Quit();
 
@@ -246,6 +260,52 @@ namespace YerbEngine {
         m_samplesMuted = false;
     }
 
+    void AudioManager::duck(float const factor) {
+        if (m_nullDevice) {
+            return;
+        }
+        if (!m_ducked) {
+            m_unduckedTrackVolume = getTrackVolume();
+            m_ducked              = true;
+        }
+
+        float const clamped = std::clamp(factor, 0.0f, 1.0f);
+        Mix_VolumeMusic(static_cast<int>(
+            std::lround(static_cast<float>(m_unduckedTrackVolume) * clamped)));
+        // Channel volume multiplies with each chunk's own volume, so the
+        // per-sample volumes (and their mute state) are left alone.
+        Mix_Volume(-1, static_cast<int>(std::lround(MIX_MAX_VOLUME * clamped)));
+    }
+
+    void AudioManager::unduck() {
+        if (!m_ducked) {
+            return;
+        }
+        m_ducked = false;
+        Mix_VolumeMusic(m_unduckedTrackVolume);
+        Mix_Volume(-1, MIX_MAX_VOLUME);
+    }
+
+    void AudioManager::pauseAll() {
+        if (m_nullDevice || m_allPaused) {
+            return;
+        }
+        m_allPaused = true;
+        Mix_Pause(-1);
+        Mix_PauseMusic();
+    }
+
+    void AudioManager::resumeAll() {
+        if (!m_allPaused) {
+            return;
+        }
+        m_allPaused = false;
+        Mix_Resume(-1);
+        if (!m_audioTrackPaused) {
+            Mix_ResumeMusic();
+        }
+    }
+
     void AudioManager::muteAll() {
         muteTracks();
         muteSamples();
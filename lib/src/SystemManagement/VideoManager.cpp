@@ -1,6 +1,9 @@
 #include <Configuration/ConfigAdapter.hpp>
+#include <Profiling/Metrics.hpp>
+#include <Profiling/Profiler.hpp>
 #include <SDL.h>
 #include <SystemManagement/VideoManager.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 #ifdef __EMSCRIPTEN__
@@ -11,7 +14,22 @@ namespace YerbEngine {
 
     using Path = std::filesystem::path;
 
-    VideoManager::VideoManager(ConfigAdapter &config) : m_config(config) {
+    namespace {
+        Counter &drawCallCounter() {
+            static Counter &drawCalls =
+                MetricsRegistry::global().counter("render.draw_calls");
+            return drawCalls;
+        }
+    } // namespace
+
+    VideoManager::VideoManager(ConfigAdapter &config, bool const headless)
+        : m_config(config) {
+        if (headless) {
+            m_renderer = createOffscreenRenderer();
+            setupRenderer();
+            return;
+        }
+
         initializeVideoSystem();
         m_window   = createWindow();
         m_renderer = createRenderer();
@@ -68,7 +86,41 @@ namespace YerbEngine {
         return window;
     }
 
+    SDL_Renderer *VideoManager::createOffscreenRenderer() {
+        Vec2 const  windowSize = m_config.getGameConfig().windowSize;
+        int const   width      = std::max(1, static_cast<int>(windowSize.x()));
+        int const   height     = std::max(1, static_cast<int>(windowSize.y()));
+
+        m_surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32,
+                                                   SDL_PIXELFORMAT_RGBA8888);
+        if (m_surface == nullptr) {
+            SDL_LogError(SDL_LOG_CATEGORY_VIDEO,
+                         "Offscreen surface could not be created: %s",
+                         SDL_GetError());
+            throw std::runtime_error("Offscreen surface could not be created");
+        }
+
+        SDL_Renderer *renderer = SDL_CreateSoftwareRenderer(m_surface);
+        if (renderer == nullptr) {
+            SDL_LogError(SDL_LOG_CATEGORY_VIDEO,
+                         "Offscreen renderer could not be created: %s",
+                         SDL_GetError());
+            throw std::runtime_error("Offscreen renderer could not be created");
+        }
+
+        m_currentWindowSize = Vec2{static_cast<float>(width),
+                                   static_cast<float>(height)};
+
+        SDL_LogInfo(SDL_LOG_CATEGORY_VIDEO,
+                    "Headless: rendering offscreen at %dx%d.", width, height);
+        return renderer;
+    }
+
     void VideoManager::updateWindowSize() {
+        if (m_window == nullptr) {
+            return; // the offscreen surface never changes size
+        }
+
         int currentWindowWidth, currentWindowHeight;
         int drawableWidth, drawableHeight;
 
@@ -85,8 +137,13 @@ namespace YerbEngine {
             throw std::runtime_error("Window is not initialized");
         }
 
+        Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+        if (m_config.getGameConfig().vsync) {
+            rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+        }
+
         SDL_Renderer *renderer =
-            SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED);
+            SDL_CreateRenderer(m_window, -1, rendererFlags);
         if (renderer == nullptr) {
             SDL_LogError(SDL_LOG_CATEGORY_VIDEO,
                          "Renderer could not be created: %s", SDL_GetError());
@@ -117,6 +174,48 @@ namespace YerbEngine {
 
     SDL_Window *VideoManager::getWindow() const { return m_window; }
 
+    void VideoManager::present() {
+        YERB_ZONE("Present");
+        auto const start = std::chrono::steady_clock::now();
+        SDL_RenderPresent(m_renderer);
+        m_lastPresentTime     = std::chrono::steady_clock::now();
+        m_lastPresentDuration = m_lastPresentTime - start;
+        m_presentCount += 1;
+
+        static Histogram &perFrame = MetricsRegistry::global().histogram(
+            "render.draw_calls_per_frame", "calls");
+        uint64_t const drawCalls = drawCallCounter().get();
+        perFrame.record(drawCalls - m_drawCallsAtPresent);
+        m_drawCallsAtPresent = drawCalls;
+    }
+
+    void VideoManager::countDrawCalls(uint64_t const count) {
+        drawCallCounter().add(count);
+    }
+
+    bool VideoManager::isVsyncEnabled() const {
+        SDL_RendererInfo info;
+        if (m_renderer == nullptr ||
+            SDL_GetRendererInfo(m_renderer, &info) != 0) {
+            return false;
+        }
+        return (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+    }
+
+    int VideoManager::getRefreshRate() const {
+        if (m_window == nullptr) {
+            return 0;
+        }
+
+        SDL_DisplayMode mode;
+        int const       displayIndex = SDL_GetWindowDisplayIndex(m_window);
+        if (displayIndex < 0 ||
+            SDL_GetCurrentDisplayMode(displayIndex, &mode) != 0) {
+            return 0;
+        }
+        return mode.refresh_rate;
+    }
+
     void VideoManager::cleanup() {
         if (m_renderer != nullptr) {
             SDL_DestroyRenderer(m_renderer);
@@ -132,6 +231,11 @@ namespace YerbEngine {
                         "Window destroyed successfully!");
         }
 
+        if (m_surface != nullptr) {
+            SDL_FreeSurface(m_surface);
+            m_surface = nullptr;
+        }
+
         SDL_QuitSubSystem(SDL_INIT_VIDEO);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                     "VideoManager cleaned up successfully!");
@@ -0,0 +1,368 @@
+#include <Profiling/AllocationTracker.hpp>
+#include <Profiling/Profiler.hpp>
+#include <Threading/ChaseLevDeque.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace YerbEngine {
+
+    struct Job {
+        using Function = void (*)(Job &);
+
+        Function          function = nullptr;
+        JobCounter       *counter  = nullptr;
+        void const       *owner    = nullptr;
+        std::atomic<bool> busy{false};
+        bool              onHeap = false;
+
+        alignas(std::max_align_t) std::byte payload[48];
+    };
+
+    namespace {
+        constexpr size_t DEQUE_CAPACITY = 1024;
+        constexpr size_t JOB_SLOTS      = 1024;
+
+        struct FunctionPayload {
+            std::function<void()> task;
+
+            static void run(Job &job) {
+                auto *payload = std::launder(
+                    reinterpret_cast<FunctionPayload *>(job.payload));
+                payload->task();
+                payload->~FunctionPayload();
+            }
+        };
+        static_assert(sizeof(FunctionPayload) <= sizeof(Job::payload));
+
+        struct RangePayload {
+            JobSystem                *system;
+            FunctionRef<void(size_t)> task;
+            size_t                    begin;
+            size_t                    end;
+            size_t                    grain;
+        };
+        static_assert(sizeof(RangePayload) <= sizeof(Job::payload));
+
+        uint32_t nextRandom() {
+            thread_local uint32_t state = static_cast<uint32_t>(
+                std::hash<std::thread::id>{}(std::this_thread::get_id()) |
+                1u);
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+    } // namespace
+
+    struct JobSystem::Worker {
+        ChaseLevDeque<Job, DEQUE_CAPACITY> deque;
+
+        // Jobs are carved from a ring owned by the submitting thread. A
+        // slot is free again once whichever thread ran it clears `busy`.
+        std::array<Job, JOB_SLOTS> slots;
+        size_t                     cursor = 0;
+    };
+
+    namespace {
+        // The worker record of the current thread, or nullptr for threads
+        // the system did not start (and did not construct it).
+        thread_local JobSystem const *t_system = nullptr;
+        thread_local size_t           t_index  = 0;
+
+        // See JobSystem::setOwner().
+        thread_local void const *t_owner = nullptr;
+        thread_local ForeignWork t_foreignWork;
+    } // namespace
+
+    JobSystem::JobSystem(size_t threadCount) {
+#ifdef __EMSCRIPTEN__
+        threadCount = 1;
+#endif
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        m_workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+
+        t_system = this;
+        t_index  = 0;
+
+        m_threads.reserve(threadCount - 1);
+        for (size_t i = 1; i < threadCount; ++i) {
+            m_threads.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_stopping.store(true);
+        }
+        m_wake.notify_all();
+        for (std::thread &thread : m_threads) {
+            thread.join();
+        }
+
+        if (t_system == this) {
+            t_system = nullptr;
+        }
+    }
+
+    JobSystem::Worker *JobSystem::currentWorker() const {
+        return t_system == this ? m_workers[t_index].get() : nullptr;
+    }
+
+    Job *JobSystem::allocate(Worker *const worker) {
+        if (worker == nullptr) {
+            Job *job    = new Job;
+            job->onHeap = true;
+            return job;
+        }
+
+        for (size_t probe = 0; probe < JOB_SLOTS; ++probe) {
+            Job &job       = worker->slots[worker->cursor];
+            worker->cursor = (worker->cursor + 1) % JOB_SLOTS;
+            if (!job.busy.load(std::memory_order_acquire)) {
+                job.busy.store(true, std::memory_order_relaxed);
+                return &job;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::enqueue(Worker *const worker, Job *const job) {
+        job->counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+        m_queued.fetch_add(1);
+
+        bool queued = false;
+        if (worker != nullptr) {
+            queued = worker->deque.push(job);
+        } else {
+            std::lock_guard lock(m_injectMutex);
+            m_injected.push_back(job);
+            queued = true;
+        }
+
+        if (!queued) {
+            m_queued.fetch_sub(1);
+            execute(job);
+            return;
+        }
+
+        // Pairs with the sleeper count taken under m_sleepMutex: either the
+        // sleeper sees m_queued, or this sees the sleeper and wakes it.
+        if (m_sleepers.load() > 0) {
+            std::lock_guard lock(m_sleepMutex);
+            m_wake.notify_one();
+        }
+    }
+
+    Job *JobSystem::findJob(Worker *const worker) {
+        if (m_queued.load(std::memory_order_relaxed) == 0) {
+            return nullptr;
+        }
+
+        Job *job = worker != nullptr ? worker->deque.pop() : nullptr;
+
+        if (job == nullptr) {
+            std::lock_guard lock(m_injectMutex);
+            if (!m_injected.empty()) {
+                job = m_injected.front();
+                m_injected.pop_front();
+            }
+        }
+
+        if (job == nullptr) {
+            size_t const count = m_workers.size();
+            size_t const start = nextRandom() % count;
+            for (size_t i = 0; i < count && job == nullptr; ++i) {
+                Worker *victim = m_workers[(start + i) % count].get();
+                if (victim != worker) {
+                    job = victim->deque.steal();
+                }
+            }
+        }
+
+        if (job != nullptr) {
+            m_queued.fetch_sub(1);
+        }
+        return job;
+    }
+
+    void JobSystem::execute(Job *const job) {
+        using Clock = std::chrono::steady_clock;
+
+        JobCounter *const counter = job->counter;
+        void const *const owner   = t_owner;
+        if (job->owner == owner) {
+            YERB_ZONE("Job");
+            job->function(*job);
+        } else {
+            // Foreign work nested in this job is part of it, so the total
+            // is set from the outer measurement rather than added to twice.
+            ForeignWork const       before = t_foreignWork;
+            AllocationScope const   allocations;
+            Clock::time_point const start = Clock::now();
+            t_owner                       = job->owner;
+            {
+                YERB_ZONE("Job");
+                job->function(*job);
+            }
+            t_owner       = owner;
+            t_foreignWork = {.time = before.time + (Clock::now() - start),
+                             .allocations =
+                                 before.allocations +
+                                 allocations.getCounts().allocations};
+        }
+
+        if (job->onHeap) {
+            delete job;
+        } else {
+            job->busy.store(false, std::memory_order_release);
+        }
+        counter->m_pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::workerLoop(size_t const index) {
+        t_system       = this;
+        t_index        = index;
+        Worker *worker = m_workers[index].get();
+        Profiler::setThreadName("Worker " + std::to_string(index));
+
+        while (!m_stopping.load(std::memory_order_acquire)) {
+            if (Job *job = findJob(worker)) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock lock(m_sleepMutex);
+            m_sleepers.fetch_add(1);
+            m_wake.wait(lock, [&] {
+                return m_stopping.load() || m_queued.load() > 0;
+            });
+            m_sleepers.fetch_sub(1);
+        }
+    }
+
+    void JobSystem::submit(std::function<void()> task, JobCounter &counter) {
+        Worker *const worker = currentWorker();
+        Job *const    job    = allocate(worker);
+        if (job == nullptr) {
+            // Every slot is in flight; run it here rather than block.
+            task();
+            return;
+        }
+
+        job->function = &FunctionPayload::run;
+        job->counter  = &counter;
+        job->owner    = t_owner;
+        new (job->payload) FunctionPayload{std::move(task)};
+        enqueue(worker, job);
+    }
+
+    void const *JobSystem::setOwner(void const *const owner) {
+        return std::exchange(t_owner, owner);
+    }
+
+    ForeignWork JobSystem::getForeignWork() { return t_foreignWork; }
+
+    void JobSystem::wait(JobCounter const &counter, bool help) {
+        help = help || m_threads.empty();
+        Worker *const worker = currentWorker();
+
+        while (!counter.isDone()) {
+            if (help) {
+                if (Job *job = findJob(worker)) {
+                    execute(job);
+                    continue;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    bool JobSystem::spawnRange(FunctionRef<void(size_t)> const task,
+                               size_t const begin, size_t const end,
+                               size_t const grain, JobCounter &counter) {
+        Worker *const worker = currentWorker();
+        Job *const    job    = allocate(worker);
+        if (job == nullptr) {
+            return false;
+        }
+
+        job->function = [](Job &self) {
+            auto const &range = *std::launder(
+                reinterpret_cast<RangePayload *>(self.payload));
+            range.system->runRange(range.task, range.begin, range.end,
+                                   range.grain, *self.counter);
+        };
+        job->counter = &counter;
+        job->owner   = t_owner;
+        new (job->payload) RangePayload{this, task, begin, end, grain};
+        enqueue(worker, job);
+        return true;
+    }
+
+    void JobSystem::runRange(FunctionRef<void(size_t)> const task,
+                             size_t begin, size_t end, size_t const grain,
+                             JobCounter &counter) {
+        Worker *const worker = currentWorker();
+
+        while (begin < end) {
+            // Only split when nothing of ours is left for thieves, so a busy
+            // system keeps whole chunks and an idle one spreads out quickly.
+            bool const hungry = worker != nullptr
+                                    ? worker->deque.empty()
+                                    : m_queued.load() == 0;
+            if (end - begin > grain && hungry) {
+                size_t const middle = begin + (end - begin) / 2;
+                if (spawnRange(task, middle, end, grain, counter)) {
+                    end = middle;
+                    continue;
+                }
+            }
+
+            size_t const stop = std::min(end, begin + grain);
+            for (size_t index = begin; index < stop; ++index) {
+                task(index);
+            }
+            begin = stop;
+        }
+    }
+
+    void JobSystem::parallelFor(size_t const                    count,
+                                FunctionRef<void(size_t)> const task,
+                                size_t                          grain) {
+        if (count == 0) {
+            return;
+        }
+
+        if (m_threads.empty() || count == 1) {
+            for (size_t index = 0; index < count; ++index) {
+                task(index);
+            }
+            return;
+        }
+
+        if (grain == 0) {
+            grain = std::max<size_t>(
+                1, count / (getThreadCount() * CHUNKS_PER_THREAD));
+        }
+
+        // The caller keeps the low end of the range, so index 0 runs here.
+        JobCounter counter;
+        runRange(task, 0, count, grain, counter);
+        wait(counter);
+    }
+
+} // namespace YerbEngine
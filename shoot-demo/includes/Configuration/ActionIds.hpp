@@ -0,0 +1,21 @@
+#pragma once
+
+#include <GameEngine/Action.hpp>
+
+// Interned once at startup; scenes bind keys to these and compare them in
+// sDoAction instead of comparing names.
+namespace DemoActions {
+    using YerbEngine::ActionId;
+    using YerbEngine::ActionNames;
+
+    inline ActionId const FORWARD  = ActionNames::intern("FORWARD");
+    inline ActionId const BACKWARD = ActionNames::intern("BACKWARD");
+    inline ActionId const LEFT     = ActionNames::intern("LEFT");
+    inline ActionId const RIGHT    = ActionNames::intern("RIGHT");
+    inline ActionId const SHOOT    = ActionNames::intern("SHOOT");
+    inline ActionId const PAUSE    = ActionNames::intern("PAUSE");
+    inline ActionId const GO_BACK  = ActionNames::intern("GO_BACK");
+    inline ActionId const SELECT   = ActionNames::intern("SELECT");
+    inline ActionId const UP       = ActionNames::intern("UP");
+    inline ActionId const DOWN     = ActionNames::intern("DOWN");
+} // namespace DemoActions
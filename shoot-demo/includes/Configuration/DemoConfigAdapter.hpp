@@ -115,4 +115,19 @@ class DemoConfigAdapter {
                             m_demoStore, "bulletConfig.shape");
         return cfg;
     }
+    // Level 0 is full quality. Each level starts from the one below it and
+    // overrides whatever quality.levels.<n> sets.
+    QualityPolicy getQualityPolicy(size_t const level) {
+        QualityPolicy policy{};
+        for (size_t n = 1; n <= level; ++n) {
+            std::string const base = "quality.levels." + std::to_string(n);
+            policy.spawnScale      = YerbEngine::ConfigAdapter::floatOr(
+                policy.spawnScale, m_demoStore, base + ".spawnScale");
+            policy.fadeEffects = YerbEngine::ConfigAdapter::boolOr(
+                policy.fadeEffects, m_demoStore, base + ".fadeEffects");
+            policy.hudRefreshMs = YerbEngine::ConfigAdapter::u64Or(
+                policy.hudRefreshMs, m_demoStore, base + ".hudRefreshMs");
+        }
+        return policy;
+    }
 };
@@ -42,3 +42,8 @@ struct BulletConfig {
     float       speed{0};
     ShapeConfig shape;
 };
+struct QualityPolicy {
+    float  spawnScale{1.0f};  // scales every spawn percentage
+    bool   fadeEffects{true}; // fade short-lived entities out
+    Uint64 hudRefreshMs{0};   // 0 = HUD text follows every change
+};
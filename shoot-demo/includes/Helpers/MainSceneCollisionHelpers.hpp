@@ -11,6 +11,9 @@ namespace ShootDemo::CollisionHelpers::MainScene {
     struct CollisionPair {
         std::shared_ptr<Entity> const &entityA;
         std::shared_ptr<Entity> const &entityB;
+        ContactEventType const         type = ContactEventType::Begin;
+        // Found by sweeping a fast mover; the boxes no longer overlap.
+        bool const swept = false;
     };
 
     struct GameState {
@@ -21,6 +24,10 @@ namespace ShootDemo::CollisionHelpers::MainScene {
         std::function<void()> const     decrementLives;
         AudioSampleBuffer              &audioSampleManager;
         Vec2 const                      windowSize;
+        CollisionWorld const           &collisionWorld;
+        EntityList                     &queryResults;
+        TaskScheduler                  &tasks;
+        LifespanTracker                &lifespans;
     };
 
     void handleEntityBounds(std::shared_ptr<Entity> const &entity,
@@ -28,6 +35,21 @@ namespace ShootDemo::CollisionHelpers::MainScene {
     void handleEntityEntityCollision(CollisionPair const &collisionPair,
                                      GameState const     &args);
 
+    /**
+     * Pushes overlapping bodies apart. Only writes to the two entities of
+     * the pair (walls are read-only), so contacts in the same collision
+     * world batch can be resolved concurrently.
+     */
+    void resolveContactPhysics(CollisionPair const &collisionPair);
+
+    /**
+     * Removes `effect` from the entity once its duration has passed, unless
+     * it was already cleared or replaced by then.
+     */
+    Task expireEffect(TaskScheduler          &tasks,
+                      std::shared_ptr<Entity> entity,
+                      Components::Effect      effect);
+
 } // namespace ShootDemo::CollisionHelpers::MainScene
 
 namespace ShootDemo::CollisionHelpers::MainScene::Enforce {
@@ -23,5 +23,6 @@ namespace MovementHelpers {
                      float const                   &deltaTime);
 
     void moveItems(std::shared_ptr<Entity> const &entity,
-                   float const                   &deltaTime);
+                   float const                   &deltaTime,
+                   double                         sceneTimeMs);
 } // namespace MovementHelpers
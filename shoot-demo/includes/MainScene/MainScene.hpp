@@ -8,28 +8,104 @@ using namespace YerbEngine;
 
 class MainScene final : public Scene {
   private:
-    Uint64                  m_lastNonPlayerEntitySpawnTime = 0;
-    Uint64                  m_lastFrameTime                = 0;
+    // Short-lived entities fade out over this much of their lifespan.
+    static constexpr Uint64 FADE_WINDOW = 2000; // ms
+
     EntityManager           m_entities;
     float                   m_deltaTime = 0;
     bool                    m_paused    = false;
     int                     m_score     = 0;
     int                     m_lives     = 5;
     std::shared_ptr<Entity> m_player;
-    Uint64                  m_timeRemaining = 2.5 * 60 * 1000;
-    bool                    m_gameOver      = false;
-    std::random_device      m_rd;
-    std::mt19937            m_randomGenerator     = std::mt19937(m_rd());
-    Uint64                  m_lastBulletSpawnTime = 0;
+    double                  m_matchLength = 2.5 * 60 * 1000; // ms
+    bool                    m_gameOver    = false;
+    // Seeded by the engine, or by the batch for a batch world, so a replay
+    // draws the same numbers.
+    std::mt19937            m_randomGenerator;
+    bool                    m_bulletReady         = true;
     Uint64                  m_bulletSpawnCooldown = 90;
+    LifespanTracker         m_lifespans{FADE_WINDOW};
+    EntityList              m_expired; // reused by sLifespan
+    DemoConfigAdapter       m_config;
+    CollisionWorld          m_collisionWorld; // before m_spawner, which uses it
     MainSceneSpawner        m_spawner;
-    void                    renderText() const;
+    EntityList              m_queryResults; // reused by collision responses
+
+    // A batch world queues its sound effects into a buffer of its own that
+    // is never played, so worlds stepping in parallel never share one.
+    SimClock                           m_worldClock;
+    std::unique_ptr<AudioSampleBuffer> m_worldAudio;
+
+    // What the performance governor's current level sheds; see
+    // quality.levels in the demo config.
+    QualityPolicy           m_quality;
+    TextHelpers::CachedText m_scoreText;
+    TextHelpers::CachedText m_livesText;
+    TextHelpers::CachedText m_timeText;
+    TextHelpers::CachedText m_effectText;
+    Uint64                  m_hudRefreshedAt = 0; // SDL ticks
+
+    MainScene(GameEngine *gameEngine, uint64_t seed, bool batchWorld);
+
+    AudioSampleBuffer &audio();
+    void               renderText();
+    void               shoot(Vec2 const &target);
 
   public:
+    // Nearest enemies each observation describes.
+    static constexpr size_t OBSERVED_ENEMIES = 4;
+
+    /**
+     * Player x, y; score; lives; match time left; bullet ready; then x, y
+     * of the OBSERVED_ENEMIES nearest enemies relative to the player, or
+     * zeros past the last. Positions are divided by the window size and
+     * time by the match length.
+     */
+    static constexpr size_t OBSERVATION_SIZE = 6 + 2 * OBSERVED_ENEMIES;
+
+    /**
+     * Move x, move y (each below -0.5 or above 0.5 to move that way);
+     * shoot (above 0.5 to fire); aim x, y in window pixels.
+     */
+    static constexpr size_t CONTROL_SIZE = 5;
+
     explicit MainScene(GameEngine *gameEngine);
 
+    /**
+     * Seeds the random generator from `seed` instead of drawing a seed from
+     * the engine, so it can be built away from the main thread.
+     */
+    MainScene(GameEngine *gameEngine, uint64_t seed);
+
+    /**
+     * Starts building the next game in the background, unless one is
+     * already being built, so starting it later is instant.
+     */
+    static void prepareNext(GameEngine *gameEngine);
+
+    /**
+     * The game started by prepareNext(), or a new one if there is none.
+     */
+    static std::shared_ptr<Scene> takeNext(GameEngine *gameEngine);
+
+    /**
+     * Builds a world for a SceneBatch: its random generator is seeded from
+     * `seed` alone and its sound effects stay off the engine's audio.
+     */
+    static std::shared_ptr<MainScene> makeBatchWorld(GameEngine *gameEngine,
+                                                     uint64_t    seed);
+
+    size_t getObservationSize() const override;
+    void   observe(std::span<float> out) const override;
+    size_t getControlSize() const override;
+    void   applyControls(std::span<float const> controls) override;
+
     void onSceneWindowResize() override;
+    void onPrepared() override;
+    void onQualityLevelChanged(size_t level) override;
+    void publishMetrics(MetricsRegistry &metrics) override;
 
+    void fixedUpdate(float tickSeconds) override;
     void update() override;
     void onEnd() override;
     void sRender() override;
@@ -38,10 +114,13 @@ class MainScene final : public Scene {
 
     void sCollision();
     void sMovement();
-    void sSpawner();
     void sLifespan();
-    void sEffects() const;
-    void sTimer();
+
+    // Timed behaviour, run as tasks on the scene's scheduler.
+    Task runMatchClock();
+    Task runSpawner();
+    Task cooldownBullets();
+    void spawnWave();
 
     int  getScore() const;
     void setScore(int score);
@@ -4,29 +4,58 @@
 using namespace YerbEngine;
 #include <random>
 
+// Which entities one spawn round adds.
+struct SpawnWave {
+    bool enemy          = false;
+    bool speedBoost     = false;
+    bool slownessDebuff = false;
+    bool item           = false;
+};
+
 class MainSceneSpawner {
-    std::mt19937 &m_randomGenerator;
+    std::mt19937     &m_randomGenerator;
+    SpawnPlacer       m_spawnPlacer;
+    EntityList        m_waveEntities;
+    std::vector<Vec2> m_wavePositions;
+
+    // Create an entity with its position left for spawnWave to fill in.
+    std::shared_ptr<Entity> createEnemy();
+    std::shared_ptr<Entity> createSpeedBoost();
+    std::shared_ptr<Entity> createSlownessDebuff();
+    std::shared_ptr<Entity> createItem();
 
   public:
     DemoConfigAdapter &m_config;
     VideoManager      &m_videoManager;
     TextureManager    &m_textureManager;
     EntityManager     &m_entityManager;
+    LifespanTracker   &m_lifespans;
 
   public:
-    MainSceneSpawner(std::mt19937      &randomGenerator,
-                     DemoConfigAdapter &config,
-                     TextureManager    &textureManager,
-                     EntityManager     &entityManager,
-                     VideoManager      &videoManager);
+    MainSceneSpawner(std::mt19937         &randomGenerator,
+                     DemoConfigAdapter    &config,
+                     TextureManager       &textureManager,
+                     EntityManager        &entityManager,
+                     LifespanTracker      &lifespans,
+                     VideoManager         &videoManager,
+                     CollisionWorld const &collisionWorld);
+
+    /**
+     * Loads the demo textures. Needs the renderer, so call it on the main
+     * thread; textures already loaded are skipped.
+     */
+    void registerTextures();
 
     std::shared_ptr<Entity> spawnPlayer();
 
-    void spawnEnemy(std::shared_ptr<Entity> const &player);
-    void spawnSpeedBoostEntity(std::shared_ptr<Entity> const &player);
-    void spawnSlownessEntity(std::shared_ptr<Entity> const &player);
+    /**
+     * Spawns the wave's entities at free positions away from the player,
+     * sampled together so they do not land on or next to each other.
+     */
+    void spawnWave(std::shared_ptr<Entity> const &player,
+                   SpawnWave const               &wave);
+
     void spawnWalls();
     void spawnBullets(std::shared_ptr<Entity> const &player,
                       Vec2 const                    &mousePosition);
-    void spawnItem(std::shared_ptr<Entity> const &player);
 };
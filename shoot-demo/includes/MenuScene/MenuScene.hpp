@@ -15,6 +15,8 @@ class MenuScene final : public Scene {
     explicit MenuScene(GameEngine *gameEngine);
     void update() override;
     void onEnd() override;
+    void onPrepared() override;
+    void onResume() override;
     void sRender() override;
     void sDoAction(Action &action) override;
     void sAudio() override;
@@ -15,6 +15,7 @@ class ScoreScene final : public Scene {
 
     void update() override;
     void onEnd() override;
+    void onPrepared() override;
     void sRender() override;
     void sDoAction(Action &action) override;
     void sAudio() override;
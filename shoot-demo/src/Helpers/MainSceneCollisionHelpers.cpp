@@ -255,11 +255,17 @@ namespace ShootDemo::CollisionHelpers::MainScene {
         std::function<void(int)> const setScore          = args.setScore;
         Vec2 const                    &windowSize        = args.windowSize;
 
+        // Sounds only play when a contact begins, not while it persists.
+        bool const isNewContact = collisionPair.type == ContactEventType::Begin;
+
         if (entity == otherEntity) {
             return;
         }
 
+        // A swept hit crossed the other body during the tick, so it counts
+        // even though the boxes no longer overlap.
         bool const entitiesCollided =
+            collisionPair.swept ||
             YerbEngine::CollisionHelpers::calculateCollisionBetweenEntities(
                 entity, otherEntity);
 
@@ -267,27 +273,11 @@ namespace ShootDemo::CollisionHelpers::MainScene {
             return;
         }
 
-        if (otherTag == EntityTags::Wall) {
-            Enforce::enforceCollisionWithWall(entity, otherEntity);
-        }
-
-        if (tag == EntityTags::Enemy && otherTag == EntityTags::Enemy) {
-            Enforce::enforceEntityEntityCollision(entity, otherEntity);
-        }
-
-        if (tag == EntityTags::Enemy && otherTag == EntityTags::SpeedBoost) {
-            Enforce::enforceEntityEntityCollision(entity, otherEntity);
-        }
-
-        if (tag == EntityTags::Enemy &&
-            otherTag == EntityTags::SlownessDebuff) {
-            Enforce::enforceEntityEntityCollision(entity, otherEntity);
-        }
-
         if (tag == EntityTags::Bullet && otherTag == EntityTags::Enemy) {
-            auto const nextSample = DemoAudio::SAMPLE_BULLET_HIT_02;
-            args.audioSampleManager.queueSample(nextSample,
-                                                PriorityLevel::STANDARD);
+            if (isNewContact) {
+                args.audioSampleManager.queueSample(
+                    DemoAudio::SAMPLE_BULLET_HIT_02, PriorityLevel::STANDARD);
+            }
 
             auto const &cBounceTracker =
                 entity->getComponent<Components::CBounceTracker>();
@@ -302,7 +292,8 @@ namespace ShootDemo::CollisionHelpers::MainScene {
             entity->destroy();
         }
 
-        if (tag == EntityTags::Bullet && otherTag == EntityTags::Wall) {
+        if (tag == EntityTags::Bullet && otherTag == EntityTags::Wall &&
+            isNewContact) {
             args.audioSampleManager.queueSample(DemoAudio::SAMPLE_BULLET_HIT_01,
                                                 PriorityLevel::BACKGROUND);
         }
@@ -323,8 +314,10 @@ namespace ShootDemo::CollisionHelpers::MainScene {
         }
 
         if (tag == EntityTags::Player && otherTag == EntityTags::Enemy) {
-            args.audioSampleManager.queueSample(
-                DemoAudio::SAMPLE_ENEMY_COLLISION, PriorityLevel::STANDARD);
+            if (isNewContact) {
+                args.audioSampleManager.queueSample(
+                    DemoAudio::SAMPLE_ENEMY_COLLISION, PriorityLevel::STANDARD);
+            }
             setScore(m_score > 10 ? m_score - 10 : 0);
             otherEntity->destroy();
             decrementLives();
@@ -335,15 +328,16 @@ namespace ShootDemo::CollisionHelpers::MainScene {
                 entity->getComponent<Components::CEffects>();
             cTransform->topLeftCornerPos =
                 Vec2{windowSize.x() / 2, windowSize.y() / 2};
+            cTransform->storePreviousPosition(); // teleport, don't smear
 
-            constexpr float  REMOVAL_RADIUS = 150.0f;
-            EntityList const entitiesToRemove =
-                EntityHelpers::getEntitiesInRadius(
-                    entity, m_entities.getEntities(EntityTags::Enemy),
-                    REMOVAL_RADIUS);
+            constexpr float REMOVAL_RADIUS = 150.0f;
+            args.queryResults.clear();
+            args.collisionWorld.queryRadius(
+                entity->getCenterPos(), REMOVAL_RADIUS,
+                QueryFilter::withTags({EntityTags::Enemy}), args.queryResults);
 
             for (std::shared_ptr<Entity> const &entityToRemove :
-                 entitiesToRemove) {
+                 args.queryResults) {
                 entityToRemove->destroy();
             }
 
@@ -352,35 +346,33 @@ namespace ShootDemo::CollisionHelpers::MainScene {
 
         if (tag == EntityTags::Player &&
             otherTag == EntityTags::SlownessDebuff) {
-            Uint64 const startTime = SDL_GetTicks64();
-            Uint64 const duration  = randomSlownessDuration(m_randomGenerator);
+            Components::Effect const effect = {
+                .startTime = static_cast<Uint64>(args.tasks.now()),
+                .duration  = randomSlownessDuration(m_randomGenerator),
+                .type      = Components::EffectTypes::Slowness};
 
             auto const &cEffects = entity->getComponent<Components::CEffects>();
-            cEffects->addEffect({.startTime = startTime,
-                                 .duration  = duration,
-                                 .type = Components::EffectTypes::Slowness});
+            if (cEffects->addEffect(effect)) {
+                args.tasks.spawn(expireEffect(args.tasks, entity, effect));
+            }
 
-            EntityList        effectsToCheck;
-            EntityList const &slownessDebuffs =
-                m_entities.getEntities(EntityTags::SlownessDebuff);
             EntityList const &speedBoosts =
                 m_entities.getEntities(EntityTags::SpeedBoost);
 
-            effectsToCheck.insert(effectsToCheck.end(), slownessDebuffs.begin(),
-                                  slownessDebuffs.end());
-            effectsToCheck.insert(effectsToCheck.end(), speedBoosts.begin(),
-                                  speedBoosts.end());
-
-            auto const nextSample = DemoAudio::SAMPLE_SLOWNESS_DEBUFF;
-            args.audioSampleManager.queueSample(nextSample,
-                                                PriorityLevel::STANDARD);
+            if (isNewContact) {
+                args.audioSampleManager.queueSample(
+                    DemoAudio::SAMPLE_SLOWNESS_DEBUFF, PriorityLevel::STANDARD);
+            }
 
-            constexpr float  REMOVAL_RADIUS = 150.0f;
-            EntityList const entitiesToRemove =
-                EntityHelpers::getEntitiesInRadius(entity, effectsToCheck,
-                                                   REMOVAL_RADIUS);
+            constexpr float REMOVAL_RADIUS = 150.0f;
+            args.queryResults.clear();
+            args.collisionWorld.queryRadius(
+                entity->getCenterPos(), REMOVAL_RADIUS,
+                QueryFilter::withTags(
+                    {EntityTags::SlownessDebuff, EntityTags::SpeedBoost}),
+                args.queryResults);
 
-            for (auto const &entityToRemove : entitiesToRemove) {
+            for (auto const &entityToRemove : args.queryResults) {
                 entityToRemove->destroy();
             }
 
@@ -390,29 +382,34 @@ namespace ShootDemo::CollisionHelpers::MainScene {
         }
 
         if (tag == EntityTags::Player && otherTag == EntityTags::SpeedBoost) {
-            Uint64 const startTime = SDL_GetTicks64();
-            Uint64 const duration = randomSpeedBoostDuration(m_randomGenerator);
-            auto const &cEffects = entity->getComponent<Components::CEffects>();
+            Components::Effect const effect = {
+                .startTime = static_cast<Uint64>(args.tasks.now()),
+                .duration  = randomSpeedBoostDuration(m_randomGenerator),
+                .type      = Components::EffectTypes::Speed};
 
-            cEffects->addEffect({.startTime = startTime,
-                                 .duration  = duration,
-                                 .type      = Components::EffectTypes::Speed});
+            auto const &cEffects = entity->getComponent<Components::CEffects>();
+            if (cEffects->addEffect(effect)) {
+                args.tasks.spawn(expireEffect(args.tasks, entity, effect));
+            }
 
-            auto const nextSample = DemoAudio::SAMPLE_SPEED_BOOST;
-            args.audioSampleManager.queueSample(nextSample,
-                                                PriorityLevel::STANDARD);
+            if (isNewContact) {
+                args.audioSampleManager.queueSample(
+                    DemoAudio::SAMPLE_SPEED_BOOST, PriorityLevel::STANDARD);
+            }
 
             EntityList const &slownessDebuffs =
                 m_entities.getEntities(EntityTags::SlownessDebuff);
             EntityList const &speedBoosts =
                 m_entities.getEntities(EntityTags::SpeedBoost);
 
-            constexpr float  REMOVAL_RADIUS = 150.0f;
-            EntityList const entitiesToRemove =
-                EntityHelpers::getEntitiesInRadius(entity, speedBoosts,
-                                                   REMOVAL_RADIUS);
+            constexpr float REMOVAL_RADIUS = 150.0f;
+            args.queryResults.clear();
+            args.collisionWorld.queryRadius(
+                entity->getCenterPos(), REMOVAL_RADIUS,
+                QueryFilter::withTags({EntityTags::SpeedBoost}),
+                args.queryResults);
 
-            for (auto const &entityToRemove : entitiesToRemove) {
+            for (auto const &entityToRemove : args.queryResults) {
                 entityToRemove->destroy();
             }
 
@@ -425,6 +422,7 @@ namespace ShootDemo::CollisionHelpers::MainScene {
 
                 lifespan = static_cast<Uint64>(
                     std::round(static_cast<float>(lifespan) * MULTIPLIER));
+                args.lifespans.retime(speedBoost);
             }
             for (auto const &slowDebuff : slownessDebuffs) {
                 slowDebuff->destroy();
@@ -432,23 +430,67 @@ namespace ShootDemo::CollisionHelpers::MainScene {
         }
 
         if (tag == EntityTags::Player && otherTag == EntityTags::Item) {
-            args.audioSampleManager.queueSample(DemoAudio::SAMPLE_ITEM_ACQUIRED,
-                                                PriorityLevel::STANDARD);
+            if (isNewContact) {
+                args.audioSampleManager.queueSample(
+                    DemoAudio::SAMPLE_ITEM_ACQUIRED, PriorityLevel::STANDARD);
+            }
             setScore(m_score + 90);
             otherEntity->destroy();
         }
+    }
 
-        if (tag == EntityTags::Item && otherTag == EntityTags::Enemy) {
-            Enforce::enforceEntityEntityCollision(entity, otherEntity);
+    void resolveContactPhysics(CollisionPair const &collisionPair) {
+        std::shared_ptr<Entity> const &entity      = collisionPair.entityA;
+        std::shared_ptr<Entity> const &otherEntity = collisionPair.entityB;
+
+        EntityTags const tag      = entity->tag();
+        EntityTags const otherTag = otherEntity->tag();
+
+        if (!entity->isActive() || !otherEntity->isActive()) {
+            return;
         }
 
-        if (tag == EntityTags::Item && otherTag == EntityTags::SpeedBoost) {
-            Enforce::enforceEntityEntityCollision(entity, otherEntity);
+        bool const entitiesCollided =
+            YerbEngine::CollisionHelpers::calculateCollisionBetweenEntities(
+                entity, otherEntity);
+
+        if (!entitiesCollided) {
+            return;
         }
 
-        if (tag == EntityTags::Item && otherTag == EntityTags::SlownessDebuff) {
+        if (otherTag == EntityTags::Wall) {
+            Enforce::enforceCollisionWithWall(entity, otherEntity);
+        }
+
+        bool const isPushable =
+            tag == EntityTags::Enemy || tag == EntityTags::Item;
+        bool const otherIsPushable = otherTag == EntityTags::Enemy ||
+                                     otherTag == EntityTags::SpeedBoost ||
+                                     otherTag == EntityTags::SlownessDebuff;
+
+        if (isPushable && otherIsPushable) {
             Enforce::enforceEntityEntityCollision(entity, otherEntity);
         }
     }
 
+    Task expireEffect(TaskScheduler                &tasks,
+                      std::shared_ptr<Entity> const entity,
+                      Components::Effect const      effect) {
+        co_await tasks.waitFor(static_cast<double>(effect.duration));
+
+        auto const &cEffects = entity->getComponent<Components::CEffects>();
+        if (cEffects == nullptr) {
+            co_return;
+        }
+
+        bool const stillActive = std::ranges::any_of(
+            cEffects->getEffects(), [&](Components::Effect const &active) {
+                return active.type == effect.type &&
+                       active.startTime == effect.startTime;
+            });
+        if (stillActive) {
+            cEffects->removeEffect(effect.type);
+        }
+    }
+
 } // namespace ShootDemo::CollisionHelpers::MainScene
@@ -1,3 +1,4 @@
+#include <Configuration/ActionIds.hpp>
 #include <Configuration/AudioIds.hpp>
 #include <HowToPlayScene/HowToPlayScene.hpp>
 #include <MenuScene/MenuScene.hpp>
@@ -6,8 +7,8 @@
 using namespace YerbEngine;
 
 HowToPlayScene::HowToPlayScene(GameEngine *gameEngine) : Scene(gameEngine) {
-    registerAction(SDLK_RETURN, "SELECT");
-    registerAction(SDLK_BACKSPACE, "GO_BACK");
+    registerAction(SDLK_RETURN, DemoActions::SELECT);
+    registerAction(SDLK_BACKSPACE, DemoActions::GO_BACK);
 }
 
 void HowToPlayScene::update() {
@@ -20,6 +21,10 @@ void HowToPlayScene::update() {
 }
 
 void HowToPlayScene::onEnd() {
+    if (m_gameEngine->getSceneCount() > 1) {
+        m_gameEngine->PopScene();
+        return;
+    }
     m_gameEngine->LoadScene("Menu", std::make_shared<MenuScene>(m_gameEngine));
 }
 
@@ -28,7 +33,7 @@ void HowToPlayScene::sRender() {
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
     renderText();
-    SDL_RenderPresent(renderer);
+    m_gameEngine->getVideoManager().present();
 }
 
 void HowToPlayScene::renderText() const {
@@ -147,13 +152,13 @@ void HowToPlayScene::sDoAction(Action &action) {
         return;
     }
 
-    if (action.getName() == "SELECT") {
+    if (action.getId() == DemoActions::SELECT) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
                                       PriorityLevel::BACKGROUND);
         m_endTriggered = true;
     }
 
-    if (action.getName() == "GO_BACK") {
+    if (action.getId() == DemoActions::GO_BACK) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
                                       PriorityLevel::BACKGROUND);
         m_endTriggered = true;
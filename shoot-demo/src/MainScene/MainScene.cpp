@@ -1,4 +1,8 @@
+#include <Configuration/ActionIds.hpp>
 #include <Configuration/AudioIds.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <filesystem>
 
 #ifdef __EMSCRIPTEN__
@@ -12,55 +16,141 @@
 #include <MenuScene/MenuScene.hpp>
 #include <ScoreScene/ScoreScene.hpp>
 
+namespace {
+    constexpr char const *PREPARED_SCENE_NAME = "Main";
+} // namespace
+
 MainScene::MainScene(GameEngine *gameEngine)
+    : MainScene(gameEngine, gameEngine->nextRandomSeed(), false) {}
+
+MainScene::MainScene(GameEngine *gameEngine, uint64_t const seed)
+    : MainScene(gameEngine, seed, false) {}
+
+void MainScene::prepareNext(GameEngine *gameEngine) {
+    if (gameEngine->hasPreparedScene(PREPARED_SCENE_NAME)) {
+        return;
+    }
+    // Drawn here, on the main thread, so the seed order stays replayable.
+    uint64_t const seed = gameEngine->nextRandomSeed();
+    gameEngine->PrepareScene(PREPARED_SCENE_NAME, [gameEngine, seed] {
+        return std::make_shared<MainScene>(gameEngine, seed);
+    });
+}
+
+std::shared_ptr<Scene> MainScene::takeNext(GameEngine *gameEngine) {
+    std::shared_ptr<Scene> scene =
+        gameEngine->TakePreparedScene(PREPARED_SCENE_NAME);
+    if (scene == nullptr) {
+        scene = std::make_shared<MainScene>(gameEngine);
+    }
+    return scene;
+}
+
+std::shared_ptr<MainScene> MainScene::makeBatchWorld(GameEngine *gameEngine,
+                                                     uint64_t const seed) {
+    // The constructor is private, so make_shared cannot reach it.
+    return std::shared_ptr<MainScene>(new MainScene(gameEngine, seed, true));
+}
+
+MainScene::MainScene(GameEngine *gameEngine,
+                     uint64_t const seed,
+                     bool const     batchWorld)
     : Scene(gameEngine),
       m_entities(EntityManager()),
+      m_randomGenerator(static_cast<uint32_t>(seed)),
+      m_config(gameEngine->GetConfig(), gameEngine->GetConfigStore("demo")),
       m_spawner(m_randomGenerator,
-                *([&]() -> DemoConfigAdapter * {
-                    static DemoConfigAdapter adapter(
-                        gameEngine->GetConfig(),
-                        gameEngine->GetConfigStore("demo"));
-                    return &adapter;
-                })(),
+                m_config,
                 gameEngine->getTextureManager(),
                 m_entities,
-                gameEngine->getVideoManager()) {
+                m_lifespans,
+                gameEngine->getVideoManager(),
+                m_collisionWorld) {
+    m_collisionWorld.setJobSystem(&gameEngine->getJobSystem());
+    if (batchWorld) {
+        m_worldAudio = std::make_unique<AudioSampleBuffer>(
+            gameEngine->getAudioManager(), m_worldClock);
+    }
+
+    // Collision changes the entity list and shared gameplay state, so it
+    // stays undeclared and runs alone. The rest declare what they touch;
+    // MainScene stands for the score/timer state, EntityManager for entity
+    // lifetimes and TaskScheduler for scene time. Spawning, the match clock
+    // and effect expiry are tasks, which run at the start of each tick.
+    //
+    // No two of these systems can share a wave: movement and collision
+    // both write transforms, lifespan is alone in its phase, and audio and
+    // render both need the main thread. The demo's systems therefore run
+    // one after another, and the parallel work is inside them, e.g. the
+    // collision world's pair search and contact batches.
+    using namespace Components;
+    m_systems
+        .add("movement", SystemPhase::Simulate,
+             SystemAccess()
+                 .reads<CInput, CEffects, CShape, CollisionWorld,
+                        TaskScheduler>()
+                 .writes<CTransform>(),
+             [this] { sMovement(); })
+        .add("collision", SystemPhase::Simulate, [this] { sCollision(); })
+        .add("lifespan", SystemPhase::Post,
+             SystemAccess()
+                 .reads<TaskScheduler>()
+                 .writes<CLifespan, CShape, EntityManager, LifespanTracker>(),
+             [this] { sLifespan(); })
+        .add("audio", SystemPhase::Render,
+             SystemAccess()
+                 .writes<AudioManager, AudioSampleBuffer>()
+                 .onMainThread(),
+             [this] { sAudio(); })
+        .add("render", SystemPhase::Render,
+             SystemAccess()
+                 .reads<CTransform, CSprite, CEffects, MainScene>()
+                 .writes<CShape>()
+                 .onMainThread(),
+             [this] { sRender(); });
+
     m_player = m_spawner.spawnPlayer();
     std::cout << "spawned the player" << std::endl;
     m_spawner.spawnWalls();
 
+    m_tasks.spawn(runMatchClock());
+    m_tasks.spawn(runSpawner());
+
     // WASD
-    registerAction(SDLK_w, "FORWARD");
-    registerAction(SDLK_s, "BACKWARD");
-    registerAction(SDLK_a, "LEFT");
-    registerAction(SDLK_d, "RIGHT");
+    registerAction(SDLK_w, DemoActions::FORWARD);
+    registerAction(SDLK_s, DemoActions::BACKWARD);
+    registerAction(SDLK_a, DemoActions::LEFT);
+    registerAction(SDLK_d, DemoActions::RIGHT);
 
     // Mouse click
-    registerAction(SDL_BUTTON_LEFT, "SHOOT");
+    registerAction(SDL_BUTTON_LEFT, DemoActions::SHOOT);
     // Pause
-    registerAction(SDLK_p, "PAUSE");
+    registerAction(SDLK_p, DemoActions::PAUSE);
 
     // Go to menu
-    registerAction(SDLK_BACKSPACE, "GO_BACK");
+    registerAction(SDLK_BACKSPACE, DemoActions::GO_BACK);
 }
 
-void MainScene::update() {
-    Uint64 const currentTime = SDL_GetTicks64();
-    m_deltaTime = static_cast<float>(currentTime - m_lastFrameTime) / 1000.0f;
+void MainScene::fixedUpdate(float const tickSeconds) {
+    m_deltaTime = tickSeconds;
+    m_worldClock.tick(tickSeconds);
 
-    if (!m_paused && !m_gameOver) {
-        sMovement();
-        sCollision();
-        sSpawner();
-        sLifespan();
-        sEffects();
-        sTimer();
+    // Done even while paused so rendering settles on the current position.
+    for (auto const &entity : m_entities.getEntities()) {
+        auto const &cTransform = entity->getComponent<Components::CTransform>();
+        if (cTransform != nullptr) {
+            cTransform->storePreviousPosition();
+        }
     }
 
-    sAudio();
-    sRender();
-    m_lastFrameTime = currentTime;
+    if (m_paused || m_gameOver || m_endTriggered) {
+        return;
+    }
+
+    Scene::fixedUpdate(tickSeconds);
+}
 
+void MainScene::update() {
     if (m_endTriggered) {
         onEnd();
     }
@@ -74,7 +164,7 @@ void MainScene::sDoAction(Action &action) {
     }
 
     ActionState const &actionState       = action.getState();
-    AudioSampleBuffer &audioSampleBuffer = m_gameEngine->getAudioSampleBuffer();
+    AudioSampleBuffer &audioSampleBuffer = audio();
 
     auto const &cInput = m_player->getComponent<Components::CInput>();
 
@@ -86,27 +176,27 @@ void MainScene::sDoAction(Action &action) {
 
     bool const actionStateStart = actionState == ActionState::START;
 
-    if (action.getName() == "FORWARD") {
+    // Input drives the player, so it cannot stay asleep once keys arrive.
+    m_collisionWorld.wake(m_player->id());
+
+    if (action.getId() == DemoActions::FORWARD) {
         cInput->directions[Components::CInput::Forward] = actionStateStart;
     }
-    if (action.getName() == "BACKWARD") {
+    if (action.getId() == DemoActions::BACKWARD) {
         cInput->directions[Components::CInput::Backward] = actionStateStart;
     }
-    if (action.getName() == "LEFT") {
+    if (action.getId() == DemoActions::LEFT) {
         cInput->directions[Components::CInput::Left] = actionStateStart;
     }
-    if (action.getName() == "RIGHT") {
+    if (action.getId() == DemoActions::RIGHT) {
         cInput->directions[Components::CInput::Right] = actionStateStart;
     }
 
     if (!actionStateStart) {
         return;
     }
-    if (action.getName() == "SHOOT") {
-        auto const currentTime = SDL_GetTicks64();
-        auto const spawnBullet =
-            currentTime - m_lastBulletSpawnTime > m_bulletSpawnCooldown;
-        if (!spawnBullet) {
+    if (action.getId() == DemoActions::SHOOT) {
+        if (!m_bulletReady) {
             return;
         }
 
@@ -116,73 +206,142 @@ void MainScene::sDoAction(Action &action) {
                          "A mouse event was called without a position.");
             return;
         }
-        Vec2 const mousePosition = *position;
-
-        audioSampleBuffer.queueSample(DemoAudio::SAMPLE_SHOOT,
-                                      PriorityLevel::STANDARD);
-        m_spawner.spawnBullets(m_player, mousePosition);
-        m_lastBulletSpawnTime = currentTime;
+        shoot(*position);
+    }
 
-        if (action.getName() == "PAUSE") {
-            audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
-                                          PriorityLevel::CRITICAL);
-            m_paused = !m_paused;
-        }
+    if (action.getId() == DemoActions::PAUSE) {
+        audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
+                                      PriorityLevel::CRITICAL);
+        m_paused = !m_paused;
     }
 
-    if (action.getName() == "GO_BACK") {
+    if (action.getId() == DemoActions::GO_BACK) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
                                       PriorityLevel::CRITICAL);
         m_endTriggered = true;
     }
 }
 
-void MainScene::renderText() const {
-    SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-    TTF_Font     *fontSm   = m_gameEngine->getFontManager().getFontSm();
-    TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
+void MainScene::shoot(Vec2 const &target) {
+    audio().queueSample(DemoAudio::SAMPLE_SHOOT, PriorityLevel::STANDARD);
+    m_spawner.spawnBullets(m_player, target);
+    m_tasks.spawn(cooldownBullets());
+}
 
-    constexpr SDL_Color plainTextColor = {255, 255, 255, 255};
+AudioSampleBuffer &MainScene::audio() {
+    return m_worldAudio != nullptr ? *m_worldAudio
+                                   : m_gameEngine->getAudioSampleBuffer();
+}
 
-    std::string const scoreText = "Score: " + std::to_string(m_score);
-    Vec2 constexpr scorePos{10, 10};
-    TextHelpers::renderLineOfText(renderer, fontMd, scoreText, plainTextColor,
-                                  scorePos);
+size_t MainScene::getObservationSize() const { return OBSERVATION_SIZE; }
 
-    std::string const livesText = "Lives: " + std::to_string(m_lives);
-    Vec2 constexpr livesPos{10, 40};
-    TextHelpers::renderLineOfText(renderer, fontMd, livesText, plainTextColor,
-                                  livesPos);
+void MainScene::observe(std::span<float> const out) const {
+    Vec2 const &windowSize = m_gameEngine->getVideoManager().getWindowSize();
+    Vec2 const  player     = m_player->getCenterPos();
+
+    out[0] = player.x() / windowSize.x();
+    out[1] = player.y() / windowSize.y();
+    out[2] = static_cast<float>(m_score);
+    out[3] = static_cast<float>(m_lives);
+    out[4] = static_cast<float>(
+        std::max(0.0, m_matchLength - m_tasks.now()) / m_matchLength);
+    out[5] = m_bulletReady ? 1.0f : 0.0f;
+
+    // Keep the nearest few, sorted by distance, without sorting them all.
+    std::array<std::pair<float, Vec2>, OBSERVED_ENEMIES> nearest;
+    size_t                                               found = 0;
+    for (auto const &enemy : m_entities.getEntities(EntityTags::Enemy)) {
+        if (!enemy->isActive()) {
+            continue;
+        }
+        Vec2 const  offset = enemy->getCenterPos() - player;
+        float const distance =
+            offset.x() * offset.x() + offset.y() * offset.y();
+        size_t slot = std::min(found, OBSERVED_ENEMIES);
+        while (slot > 0 && nearest[slot - 1].first > distance) {
+            if (slot < OBSERVED_ENEMIES) {
+                nearest[slot] = nearest[slot - 1];
+            }
+            slot -= 1;
+        }
+        if (slot < OBSERVED_ENEMIES) {
+            nearest[slot] = {distance, offset};
+            found         = std::min(found + 1, OBSERVED_ENEMIES);
+        }
+    }
 
-    Uint64 const timeRemaining = m_timeRemaining;
-    Uint64 const minutes       = timeRemaining / 60000;
-    Uint64 const seconds       = timeRemaining % 60000 / 1000;
+    for (size_t i = 0; i < OBSERVED_ENEMIES; ++i) {
+        bool const present = i < found;
+        out[6 + 2 * i] = present ? nearest[i].second.x() / windowSize.x() : 0;
+        out[7 + 2 * i] = present ? nearest[i].second.y() / windowSize.y() : 0;
+    }
+}
 
-    std::string const timeText = "Time: " + std::to_string(minutes) + ":" +
-                                 (seconds < 10 ? "0" : "") +
-                                 std::to_string(seconds);
-    Vec2 constexpr timePos{10, 70};
+size_t MainScene::getControlSize() const { return CONTROL_SIZE; }
 
-    TextHelpers::renderLineOfText(renderer, fontMd, timeText, plainTextColor,
-                                  timePos);
+void MainScene::applyControls(std::span<float const> const controls) {
+    auto const &cInput = m_player->getComponent<Components::CInput>();
+    if (cInput == nullptr) {
+        return;
+    }
 
-    auto const cEffects = m_player->getComponent<Components::CEffects>();
+    using Components::CInput;
+    cInput->directions[CInput::Left]     = controls[0] < -0.5f;
+    cInput->directions[CInput::Right]    = controls[0] > 0.5f;
+    cInput->directions[CInput::Forward]  = controls[1] < -0.5f;
+    cInput->directions[CInput::Backward] = controls[1] > 0.5f;
+    m_collisionWorld.wake(m_player->id());
 
-    if (cEffects->hasEffect(Components::EffectTypes::Speed)) {
-        SDL_Color constexpr speedBoostColor = {0, 255, 0, 255};
-        std::string const speedBoostText    = "Speed Boost Active!";
-        Vec2 constexpr speedBoostPos{10, 120};
-        TextHelpers::renderLineOfText(renderer, fontSm, speedBoostText,
-                                      speedBoostColor, speedBoostPos);
+    if (controls[2] > 0.5f && m_bulletReady && !m_paused && !m_gameOver) {
+        shoot(Vec2{controls[3], controls[4]});
     }
+}
+
+void MainScene::renderText() {
+    SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
+    TTF_Font     *fontSm   = m_gameEngine->getFontManager().getFontSm();
+    TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
 
-    if (cEffects->hasEffect(Components::EffectTypes::Slowness)) {
-        constexpr SDL_Color slownessColor = {255, 0, 0, 255};
-        std::string const   slownessText  = "Slowness Active!";
-        Vec2 constexpr slownessPos{10, 120};
-        TextHelpers::renderLineOfText(renderer, fontSm, slownessText,
-                                      slownessColor, slownessPos);
+    // Under load the HUD keeps its last textures for a while instead of
+    // following every change.
+    Uint64 const now = SDL_GetTicks64();
+    if (now - m_hudRefreshedAt >= m_quality.hudRefreshMs) {
+        m_hudRefreshedAt = now;
+
+        constexpr SDL_Color plainTextColor = {255, 255, 255, 255};
+
+        m_scoreText.set(renderer, fontMd, "Score: " + std::to_string(m_score),
+                        plainTextColor);
+        m_livesText.set(renderer, fontMd, "Lives: " + std::to_string(m_lives),
+                        plainTextColor);
+
+        double const remaining = std::max(0.0, m_matchLength - m_tasks.now());
+        auto const   timeRemaining = static_cast<Uint64>(remaining);
+        Uint64 const minutes       = timeRemaining / 60000;
+        Uint64 const seconds       = timeRemaining % 60000 / 1000;
+        m_timeText.set(renderer, fontMd,
+                       "Time: " + std::to_string(minutes) + ":" +
+                           (seconds < 10 ? "0" : "") + std::to_string(seconds),
+                       plainTextColor);
+
+        auto const cEffects = m_player->getComponent<Components::CEffects>();
+        if (cEffects->hasEffect(Components::EffectTypes::Slowness)) {
+            constexpr SDL_Color slownessColor = {255, 0, 0, 255};
+            m_effectText.set(renderer, fontSm, "Slowness Active!",
+                             slownessColor);
+        } else if (cEffects->hasEffect(Components::EffectTypes::Speed)) {
+            SDL_Color constexpr speedBoostColor = {0, 255, 0, 255};
+            m_effectText.set(renderer, fontSm, "Speed Boost Active!",
+                             speedBoostColor);
+        } else {
+            m_effectText.set(renderer, fontSm, "", {});
+        }
     }
+
+    m_scoreText.draw(renderer, Vec2{10, 10});
+    m_livesText.draw(renderer, Vec2{10, 40});
+    m_timeText.draw(renderer, Vec2{10, 70});
+    m_effectText.draw(renderer, Vec2{10, 120});
 }
 
 void MainScene::sRender() {
@@ -194,6 +353,7 @@ void MainScene::sRender() {
         std::cout << "no entities\n";
     }
 
+    uint64_t drawCalls = 0;
     for (auto const &entity : m_entities.getEntities()) {
         auto const &cShape     = entity->getComponent<Components::CShape>();
         auto const &cTransform = entity->getComponent<Components::CTransform>();
@@ -202,8 +362,9 @@ void MainScene::sRender() {
             continue;
         }
 
-        SDL_Rect   &rect = cShape->rect;
-        Vec2 const &pos  = cTransform->topLeftCornerPos;
+        SDL_Rect  &rect = cShape->rect;
+        Vec2 const pos =
+            cTransform->interpolatedPosition(m_interpolationAlpha);
 
         rect.x = static_cast<int>(pos.x());
         rect.y = static_cast<int>(pos.y());
@@ -213,6 +374,7 @@ void MainScene::sRender() {
             SDL_SetRenderDrawColor(renderer, cShape->color.r, cShape->color.g,
                                    cShape->color.b, cShape->color.a);
             SDL_RenderFillRect(renderer, &rect);
+            drawCalls += 1;
             continue; // continue on, render the next entity
         }
 
@@ -220,19 +382,20 @@ void MainScene::sRender() {
         SDL_Texture *texture = m_gameEngine->getTextureManager().getTexture(
             cSprite->getTextureId());
         SDL_RenderCopy(renderer, texture, nullptr, &rect);
+        drawCalls += 1;
     }
+    VideoManager::countDrawCalls(drawCalls);
 
     renderText();
     // Update the screen
-    SDL_RenderPresent(renderer);
+    m_gameEngine->getVideoManager().present();
 }
 
 void MainScene::sCollision() {
     using namespace ShootDemo::CollisionHelpers::MainScene;
     Vec2 const &windowSize = m_gameEngine->getVideoManager().getWindowSize();
 
-    AudioSampleBuffer &audioSampleManager =
-        m_gameEngine->getAudioSampleBuffer();
+    AudioSampleBuffer &audioSampleManager = audio();
     GameState const gameState = {
         .entityManager   = m_entities,
         .randomGenerator = m_randomGenerator,
@@ -241,17 +404,46 @@ void MainScene::sCollision() {
         .decrementLives  = [this]() -> void { decrementLives(); },
         .audioSampleManager = audioSampleManager,
         .windowSize         = windowSize,
+        .collisionWorld     = m_collisionWorld,
+        .queryResults       = m_queryResults,
+        .tasks              = m_tasks,
+        .lifespans          = m_lifespans,
     };
 
     for (auto &entity : m_entities.getEntities()) {
         handleEntityBounds(entity, windowSize);
-        for (auto &otherEntity : m_entities.getEntities()) {
-            CollisionPair const collisionPair = {.entityA = entity,
-                                                 .entityB = otherEntity};
-            handleEntityEntityCollision(collisionPair, gameState);
-        }
     }
 
+    m_collisionWorld.setBounds(windowSize);
+    m_collisionWorld.update(m_entities);
+
+    // Responses are tag-directional, so each contact is handled from both
+    // sides. Ended contacts need no response. Gameplay responses touch
+    // shared state (score, audio, other entities) and run serially first;
+    // the physical push-apart then runs in conflict-free parallel batches.
+    for (ContactEvent const &contact : m_collisionWorld.getContactEvents()) {
+        if (contact.type == ContactEventType::End) {
+            continue;
+        }
+        handleEntityEntityCollision({.entityA = contact.entityA,
+                                     .entityB = contact.entityB,
+                                     .type    = contact.type,
+                                     .swept   = contact.swept},
+                                    gameState);
+        handleEntityEntityCollision({.entityA = contact.entityB,
+                                     .entityB = contact.entityA,
+                                     .type    = contact.type,
+                                     .swept   = contact.swept},
+                                    gameState);
+    }
+
+    m_collisionWorld.resolveContacts([](ContactEvent const &contact) {
+        resolveContactPhysics(
+            {.entityA = contact.entityA, .entityB = contact.entityB});
+        resolveContactPhysics(
+            {.entityA = contact.entityB, .entityB = contact.entityA});
+    });
+
     m_entities.update();
 }
 
@@ -264,6 +456,10 @@ void MainScene::sMovement() {
         m_spawner.m_config.getSpeedEffectConfig();
 
     for (std::shared_ptr<Entity> const &entity : m_entities.getEntities()) {
+        if (m_collisionWorld.isSleeping(entity->id())) {
+            continue;
+        }
+
         MovementHelpers::moveSpeedBoosts(entity, speedBoostEffectConfig,
                                          m_deltaTime);
         MovementHelpers::moveEnemies(entity, enemyConfig, m_deltaTime);
@@ -271,21 +467,19 @@ void MainScene::sMovement() {
         MovementHelpers::moveSlownessDebuffs(entity, slownessEffectConfig,
                                              m_deltaTime);
         MovementHelpers::moveBullets(entity, m_deltaTime);
-        MovementHelpers::moveItems(entity, m_deltaTime);
+        MovementHelpers::moveItems(entity, m_deltaTime, m_tasks.now());
     }
 }
 
-void MainScene::sSpawner() {
-    Uint64 const ticks = SDL_GetTicks64();
-    Uint64 const SPAWN_INTERVAL =
-        m_spawner.m_config.getGameConfig().spawnInterval;
-
-    if (ticks - m_lastNonPlayerEntitySpawnTime < SPAWN_INTERVAL) {
-        return;
+Task MainScene::runSpawner() {
+    while (true) {
+        co_await m_tasks.waitFor(static_cast<double>(
+            m_spawner.m_config.getGameConfig().spawnInterval));
+        spawnWave();
     }
+}
 
-    m_lastNonPlayerEntitySpawnTime = ticks;
-
+void MainScene::spawnWave() {
     std::mt19937 &randomGenerator = m_randomGenerator;
 
     EnemyConfig const       &enemyCfg = m_spawner.m_config.getEnemyConfig();
@@ -302,126 +496,67 @@ void MainScene::sSpawner() {
 
     std::uniform_int_distribution<unsigned int> distribution(0, 100);
 
-    auto shouldSpawn = [&randomGenerator,
-                        &distribution](unsigned int const chance) -> bool {
-        return distribution(randomGenerator) < chance;
+    // The draw happens whatever the scale, so the sequence of numbers does
+    // not depend on the quality level.
+    float const spawnScale = m_quality.spawnScale;
+    auto shouldSpawn = [&randomGenerator, &distribution,
+                        spawnScale](unsigned int const chance) -> bool {
+        return distribution(randomGenerator) <
+               static_cast<unsigned int>(std::lround(chance * spawnScale));
     };
 
-    bool const spawnEnemy = shouldSpawn(enemyCfg.spawnPercentage);
-    bool const spawnSpeedBoost =
+    SpawnWave wave;
+    wave.enemy = shouldSpawn(enemyCfg.spawnPercentage);
+    wave.speedBoost =
         !hasSpeedBasedEffect && shouldSpawn(speedEffectCfg.spawnPercentage);
-    bool const spawnSlowDebuff =
+    wave.slownessDebuff =
         !hasSpeedBasedEffect && shouldSpawn(slowEffectCfg.spawnPercentage);
-    bool const spawnItem = shouldSpawn(itemCfg.spawnPercentage);
+    wave.item = shouldSpawn(itemCfg.spawnPercentage);
 
-    if (spawnEnemy) {
-        m_spawner.spawnEnemy(m_player);
-    }
-
-    if (spawnSpeedBoost) {
-        m_spawner.spawnSpeedBoostEntity(m_player);
-    }
-
-    if (spawnSlowDebuff) {
-        m_spawner.spawnSlownessEntity(m_player);
-    }
-
-    if (spawnItem) {
-        m_spawner.spawnItem(m_player);
-    }
+    m_spawner.spawnWave(m_player, wave);
 }
 
-void MainScene::sEffects() const {
-    auto const &cEffects = m_player->getComponent<Components::CEffects>();
-    std::vector<Components::Effect> const effects = cEffects->getEffects();
-    if (effects.empty()) {
-        return;
-    }
-
-    Uint64 const currentTime = SDL_GetTicks64();
-    for (auto const &[startTime, duration, type] : effects) {
-        bool const effectExpired = currentTime - startTime > duration;
-        if (!effectExpired) {
-            return;
-        }
-
-        cEffects->removeEffect(type);
-    }
+Task MainScene::runMatchClock() {
+    // Counts simulated time, so pauses and dropped ticks don't eat into it.
+    co_await m_tasks.waitFor(m_matchLength);
+    setGameOver();
 }
 
-void MainScene::sTimer() {
-    Uint64 const currentTime = SDL_GetTicks64();
+Task MainScene::cooldownBullets() {
+    m_bulletReady = false;
+    co_await m_tasks.waitFor(static_cast<double>(m_bulletSpawnCooldown));
+    m_bulletReady = true;
+}
 
-    // Check if the timer was recently operated by comparing the current time
-    // with the last frame time and the scene's start time.
-    bool const wasTimerRecentlyOperated =
-        currentTime - m_lastFrameTime < m_SceneStartTime;
-    Uint64 const elapsedTime =
-        !wasTimerRecentlyOperated ? 0 : currentTime - m_lastFrameTime;
+void MainScene::sLifespan() {
+    // Lifespans run on scene time, so they stop while the game is paused.
+    m_lifespans.advance(static_cast<Uint64>(m_tasks.now()), m_expired);
+    for (std::shared_ptr<Entity> const &entity : m_expired) {
+        entity->destroy();
+    }
+    m_expired.clear();
 
-    if (m_timeRemaining < elapsedTime) {
-        m_timeRemaining = 0;
-        setGameOver();
+    if (!m_quality.fadeEffects) {
         return;
     }
 
-    m_timeRemaining -= elapsedTime;
-}
-
-void MainScene::sLifespan() {
-    for (auto const &entity : m_entities.getEntities()) {
-        auto const tag = entity->tag();
-        if (tag == EntityTags::Player) {
-            continue;
-        }
-        if (tag == EntityTags::Wall) {
-            continue;
-        }
-
+    // Only entities in their final window need a new alpha.
+    for (std::shared_ptr<Entity> const &entity : m_lifespans.getFading()) {
         auto const &cLifespan = entity->getComponent<Components::CLifespan>();
-
-        auto const &cShape = entity->getComponent<Components::CShape>();
-        if (cLifespan == nullptr) {
-            SDL_LogError(
-                SDL_LOG_CATEGORY_ERROR,
-                "Entity with ID %zu and tag %d lacks a lifespan component.",
-                entity->id(), tag);
-            continue;
-        }
-
+        auto const &cShape    = entity->getComponent<Components::CShape>();
         if (cShape == nullptr) {
             SDL_LogError(
                 SDL_LOG_CATEGORY_ERROR,
                 "Entity with ID %zu and tag %d lacks a shape component.",
-                entity->id(), tag);
+                entity->id(), entity->tag());
             continue;
         }
 
-        Uint64 const currentTime = SDL_GetTicks();
-        Uint64 const elapsedTime = currentTime - cLifespan->birthTime;
-        // Calculate the lifespan percentage, ensuring it's clamped between 0
-        // and 1
-        float const lifespanPercentage =
-            std::min(1.0f, static_cast<float>(elapsedTime) /
-                               static_cast<float>(cLifespan->lifespan));
+        float const progress = m_lifespans.getFadeProgress(*cLifespan);
+        auto const  alpha    = static_cast<Uint8>(255.0f * (1.0f - progress));
 
-        bool const entityExpired = elapsedTime > cLifespan->lifespan;
-        if (!entityExpired && entity->tag() == EntityTags::Enemy) {
-            continue;
-        }
-        if (!entityExpired) {
-            constexpr float MAX_COLOR_VALUE = 255.0f;
-            Uint8 const     alpha           = static_cast<Uint8>(std::max(
-                0.0f, std::min(MAX_COLOR_VALUE,
-                                             MAX_COLOR_VALUE * (1.0f - lifespanPercentage))));
-
-            SDL_Color &color = cShape->color;
-            color = {.r = color.r, .g = color.g, .b = color.b, .a = alpha};
-
-            continue;
-        }
-
-        entity->destroy();
+        SDL_Color &color = cShape->color;
+        color = {.r = color.r, .g = color.g, .b = color.b, .a = alpha};
     }
 }
 
@@ -453,14 +588,30 @@ void MainScene::decrementLives() {
 
 void MainScene::onEnd() {
     if (!m_gameOver) {
-        m_gameEngine->LoadScene("Menu",
-                                std::make_shared<MenuScene>(m_gameEngine));
+        // Back to the menu this game was pushed over, if there is one.
+        if (m_gameEngine->getSceneCount() > 1) {
+            m_gameEngine->PopScene();
+        } else {
+            m_gameEngine->LoadScene("Menu",
+                                    std::make_shared<MenuScene>(m_gameEngine));
+        }
         return;
     }
-    m_gameEngine->LoadScene(
+    m_gameEngine->ReplaceScene(
         "ScoreScene", std::make_shared<ScoreScene>(m_gameEngine, m_score));
 }
 
+void MainScene::onPrepared() { m_spawner.registerTextures(); }
+
+void MainScene::publishMetrics(MetricsRegistry &metrics) {
+    Scene::publishMetrics(metrics);
+    m_entities.setMetrics(&metrics);
+}
+
+void MainScene::onQualityLevelChanged(size_t const level) {
+    m_quality = m_config.getQualityPolicy(level);
+}
+
 void MainScene::sAudio() {
     AudioManager      &audioManager      = m_gameEngine->getAudioManager();
     AudioSampleBuffer &audioSampleBuffer = m_gameEngine->getAudioSampleBuffer();
@@ -10,35 +10,113 @@ namespace {
     constexpr std::string_view SPEED_BOOST_TEXTURE_ID = "speed_boost";
 
     void registerDemoTextures(TextureManager &textureManager) {
-        auto const registerIfMissing = [&](std::string_view id,
-                                           std::string_view path) {
-            if (!textureManager.hasTexture(id)) {
-                textureManager.registerTexture(id, path);
-            }
-        };
-
-        registerIfMissing(PLAYER_TEXTURE_ID, "assets/images/player.png");
-        registerIfMissing(ENEMY_TEXTURE_ID, "assets/images/enemy.png");
-        registerIfMissing(WALL_TEXTURE_ID, "assets/images/wall.png");
-        registerIfMissing(COIN_TEXTURE_ID, "assets/images/coin.png");
-        registerIfMissing("speed_boost", "assets/images/speedboost.png");
+        textureManager.registerTextures({
+            {std::string{PLAYER_TEXTURE_ID}, "assets/images/player.png"},
+            {std::string{ENEMY_TEXTURE_ID}, "assets/images/enemy.png"},
+            {std::string{WALL_TEXTURE_ID}, "assets/images/wall.png"},
+            {std::string{COIN_TEXTURE_ID}, "assets/images/coin.png"},
+            {std::string{SPEED_BOOST_TEXTURE_ID},
+             "assets/images/speedboost.png"},
+        });
     }
 } // namespace
 
-MainSceneSpawner::MainSceneSpawner(std::mt19937      &randomGenerator,
-                                   DemoConfigAdapter &config,
-                                   TextureManager    &textureManager,
-                                   EntityManager     &entityManager,
-                                   VideoManager      &videoManager)
+MainSceneSpawner::MainSceneSpawner(std::mt19937         &randomGenerator,
+                                   DemoConfigAdapter    &config,
+                                   TextureManager       &textureManager,
+                                   EntityManager        &entityManager,
+                                   LifespanTracker      &lifespans,
+                                   VideoManager         &videoManager,
+                                   CollisionWorld const &collisionWorld)
     : m_randomGenerator(randomGenerator),
+      m_spawnPlacer(collisionWorld),
       m_config(config),
       m_videoManager(videoManager),
       m_textureManager(textureManager),
-      m_entityManager(entityManager) {
+      m_entityManager(entityManager),
+      m_lifespans(lifespans) {
     std::cout << "spawner created\n";
+}
+
+void MainSceneSpawner::registerTextures() {
     registerDemoTextures(m_textureManager);
 }
 
+void MainSceneSpawner::spawnWave(std::shared_ptr<Entity> const &player,
+                                 SpawnWave const               &wave) {
+    if (!player) {
+        SDL_Log("Player missing, skipping spawn wave");
+        return;
+    }
+
+    m_waveEntities.clear();
+    if (wave.enemy) {
+        m_waveEntities.push_back(createEnemy());
+    }
+    if (wave.speedBoost) {
+        m_waveEntities.push_back(createSpeedBoost());
+    }
+    if (wave.slownessDebuff) {
+        m_waveEntities.push_back(createSlownessDebuff());
+    }
+    if (wave.item) {
+        m_waveEntities.push_back(createItem());
+    }
+    if (m_waveEntities.empty()) {
+        return;
+    }
+
+    // Keeps spawns off the player and clear of the window edges, which
+    // would otherwise destroy them on the next bounds check.
+    constexpr float MIN_DISTANCE_TO_PLAYER = 40.0f;
+    constexpr float BOUNDS_MARGIN          = 1.0f;
+
+    // The whole wave is placed in one batch, in slots sized for its largest
+    // member and a slot apart, so members neither overlap nor clump.
+    Vec2 slot{0, 0};
+    for (std::shared_ptr<Entity> const &entity : m_waveEntities) {
+        SDL_Rect const &rect = entity->getComponent<Components::CShape>()->rect;
+        slot = Vec2{std::max(slot.x(), static_cast<float>(rect.w)),
+                    std::max(slot.y(), static_cast<float>(rect.h))};
+    }
+    float const spacing = 2.0f * std::max(slot.x(), slot.y());
+
+    // Occupancy comes from the collision world's grids, which the scene
+    // keeps current, so only the area needs setting here.
+    m_spawnPlacer.setBounds(m_config.getGameConfig().windowSize);
+    SpawnConstraints const constraints{
+        .avoidCenter = player->getCenterPos(),
+        .avoidRadius = MIN_DISTANCE_TO_PLAYER,
+        .margin      = BOUNDS_MARGIN,
+    };
+    m_wavePositions.clear();
+    m_spawnPlacer.sampleBatch(m_randomGenerator, slot, m_waveEntities.size(),
+                              spacing, constraints, m_wavePositions);
+
+    for (size_t i = 0; i < m_waveEntities.size(); ++i) {
+        std::shared_ptr<Entity> const &entity = m_waveEntities[i];
+        auto const cTransform = entity->getComponent<Components::CTransform>();
+
+        // The batch only throws random darts; in a crowded field the rest
+        // fall back to sample(), which scans for any free spot.
+        bool placed = i < m_wavePositions.size();
+        if (placed) {
+            cTransform->topLeftCornerPos = m_wavePositions[i];
+        } else {
+            placed = m_spawnPlacer.sample(m_randomGenerator, slot, constraints,
+                                          cTransform->topLeftCornerPos);
+        }
+
+        if (!placed) {
+            entity->destroy();
+            continue;
+        }
+        cTransform->storePreviousPosition();
+    }
+
+    m_entityManager.update();
+}
+
 std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
     PlayerConfig const &playerConfig = m_config.getPlayerConfig();
     GameConfig const   &gameConfig   = m_config.getGameConfig();
@@ -71,6 +149,8 @@ std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
     auto const cEffects = std::make_shared<Components::CEffects>();
     auto const cSprite =
         std::make_shared<Components::CSprite>(PLAYER_TEXTURE_ID);
+    auto const cCollider = std::make_shared<Components::CCollider>(
+        Components::BodyType::Dynamic, true);
 
     std::shared_ptr<Entity> player =
         m_entityManager.addEntity(EntityTags::Player);
@@ -79,23 +159,18 @@ std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
     player->setComponent(cInput);
     player->setComponent(cEffects);
     player->setComponent(cSprite);
+    player->setComponent(cCollider);
 
     m_entityManager.update();
     return player;
 }
-void MainSceneSpawner::spawnEnemy(std::shared_ptr<Entity> const &player) {
-    constexpr int MAX_SPAWN_ATTEMPTS = 10;
-
-    GameConfig const  &gameConfig  = m_config.getGameConfig();
+std::shared_ptr<Entity> MainSceneSpawner::createEnemy() {
     EnemyConfig const &enemyConfig = m_config.getEnemyConfig();
-    Vec2 const        &windowSize  = gameConfig.windowSize;
 
+    // The position is filled in by spawnWave once the shape is known.
     Vec2 const velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-    Vec2 const position =
-        SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-
     auto const cTransform =
-        std::make_shared<Components::CTransform>(position, velocity);
+        std::make_shared<Components::CTransform>(Vec2{0, 0}, velocity);
     SDL_Rect enemyRect{
         .x = 0,
         .y = 0,
@@ -109,6 +184,7 @@ void MainSceneSpawner::spawnEnemy(std::shared_ptr<Entity> const &player) {
         std::make_shared<Components::CShape>(enemyRect, enemyColor);
     auto const cLifespan =
         std::make_shared<Components::CLifespan>(enemyConfig.lifespan);
+    cLifespan->fades = false;
 
     auto const cSprite =
         std::make_shared<Components::CSprite>(ENEMY_TEXTURE_ID);
@@ -118,49 +194,18 @@ void MainSceneSpawner::spawnEnemy(std::shared_ptr<Entity> const &player) {
     enemy->setComponent<Components::CTransform>(cTransform);
     enemy->setComponent<Components::CShape>(cShape);
     enemy->setComponent<Components::CLifespan>(cLifespan);
+    m_lifespans.track(enemy);
     enemy->setComponent<Components::CSprite>(cSprite);
 
-    if (!player) {
-        SDL_Log("Player missing, destroying enemy");
-        enemy->destroy();
-        return;
-    }
-
-    bool isValidSpawn = SpawnHelpers::validateSpawnPosition(
-        enemy, player, m_entityManager, windowSize);
-    int spawnAttempt = 1;
-
-    while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-        auto const newPosition =
-            SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-        enemy->getComponent<Components::CTransform>()->topLeftCornerPos =
-            newPosition;
-        isValidSpawn = SpawnHelpers::validateSpawnPosition(
-            enemy, player, m_entityManager, windowSize);
-        spawnAttempt += 1;
-    }
-
-    if (!isValidSpawn) {
-        enemy->destroy();
-    }
-
-    m_entityManager.update();
+    return enemy;
 }
-void MainSceneSpawner::spawnSpeedBoostEntity(
-    std::shared_ptr<Entity> const &player) {
-    constexpr int MAX_SPAWN_ATTEMPTS = 10;
-
-    GameConfig const        &gameConfig = m_config.getGameConfig();
+std::shared_ptr<Entity> MainSceneSpawner::createSpeedBoost() {
     SpeedEffectConfig const &speedEffectConfig =
         m_config.getSpeedEffectConfig();
-    Vec2 const &windowSize = gameConfig.windowSize;
 
     Vec2 const velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-    Vec2 const position =
-        SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-
     auto const cTransform =
-        std::make_shared<Components::CTransform>(position, velocity);
+        std::make_shared<Components::CTransform>(Vec2{0, 0}, velocity);
     // auto const cShape     = std::make_shared<Components::CShape>(
     //     m_renderer, static_cast<float>(speedEffectConfig.shape.height),
     //     static_cast<float>(speedEffectConfig.shape.width),
@@ -182,53 +227,20 @@ void MainSceneSpawner::spawnSpeedBoostEntity(
     speedBoost->setComponent<Components::CTransform>(cTransform);
     speedBoost->setComponent<Components::CShape>(cShape);
     speedBoost->setComponent<Components::CLifespan>(cLifespan);
+    m_lifespans.track(speedBoost);
     auto const cSprite =
         std::make_shared<Components::CSprite>(SPEED_BOOST_TEXTURE_ID);
     speedBoost->setComponent<Components::CSprite>(cSprite);
 
-    if (!player) {
-        SDL_Log("Player missing, destroying speed boost");
-        speedBoost->destroy();
-        return;
-    }
-
-    bool isValidSpawn = SpawnHelpers::validateSpawnPosition(
-        speedBoost, player, m_entityManager, windowSize);
-    int spawnAttempt = 1;
-
-    while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-        auto const newPosition =
-            SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-        speedBoost->getComponent<Components::CTransform>()->topLeftCornerPos =
-            newPosition;
-        isValidSpawn = SpawnHelpers::validateSpawnPosition(
-            speedBoost, player, m_entityManager, windowSize);
-        spawnAttempt += 1;
-    }
-
-    if (!isValidSpawn) {
-        speedBoost->destroy();
-    }
-
-    m_entityManager.update();
+    return speedBoost;
 }
-void MainSceneSpawner::spawnSlownessEntity(
-    std::shared_ptr<Entity> const &player) {
-    constexpr int MAX_SPAWN_ATTEMPTS = 10;
-
-    GameConfig const &gameConfig = m_config.getGameConfig();
-
-    auto const windowSize = gameConfig.windowSize;
-
+std::shared_ptr<Entity> MainSceneSpawner::createSlownessDebuff() {
     SlownessEffectConfig const &slownessEffectConfig =
         m_config.getSlownessEffectConfig();
 
     auto const velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-    auto const position =
-        SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-
     auto const cTransform =
-        std::make_shared<Components::CTransform>(position, velocity);
+        std::make_shared<Components::CTransform>(Vec2{0, 0}, velocity);
     // auto const cShape     = std::make_shared<Components::CShape>(
     //     m_renderer, static_cast<float>(slownessEffectConfig.shape.height),
     //     static_cast<float>(slownessEffectConfig.shape.width),
@@ -252,32 +264,9 @@ void MainSceneSpawner::spawnSlownessEntity(
     slownessEntity->setComponent<Components::CTransform>(cTransform);
     slownessEntity->setComponent<Components::CShape>(cShape);
     slownessEntity->setComponent<Components::CLifespan>(cLifespan);
+    m_lifespans.track(slownessEntity);
 
-    if (!player) {
-        SDL_Log("Player missing destroying slowness debuff");
-        slownessEntity->destroy();
-        return;
-    }
-
-    bool isValidSpawn = SpawnHelpers::validateSpawnPosition(
-        slownessEntity, player, m_entityManager, windowSize);
-    int spawnAttempt = 1;
-
-    while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-        auto const newPosition =
-            SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-        slownessEntity->getComponent<Components::CTransform>()
-            ->topLeftCornerPos = newPosition;
-        isValidSpawn           = SpawnHelpers::validateSpawnPosition(
-            slownessEntity, player, m_entityManager, windowSize);
-        spawnAttempt += 1;
-    }
-
-    if (!isValidSpawn) {
-        slownessEntity->destroy();
-    }
-
-    m_entityManager.update();
+    return slownessEntity;
 }
 
 void MainSceneSpawner::spawnWalls() {
@@ -359,15 +348,19 @@ void MainSceneSpawner::spawnWalls() {
                 (i == 1) ? innerStartX : innerStartX + innerWidth - wallWidth);
             topLeftCornerPos.setY(innerStartY + innerGapSize);
         }
+        transformComponent->storePreviousPosition();
 
         auto const cSprite =
             std::make_shared<Components::CSprite>(WALL_TEXTURE_ID);
+        auto const cCollider = std::make_shared<Components::CCollider>(
+            Components::BodyType::Static);
 
         std::shared_ptr<Entity> const wall =
             m_entityManager.addEntity(EntityTags::Wall);
         wall->setComponent(shapeComponent);
         wall->setComponent(transformComponent);
         wall->setComponent(cSprite);
+        wall->setComponent(cCollider);
     }
 
     m_entityManager.update();
@@ -433,7 +426,20 @@ void MainSceneSpawner::spawnBullets(std::shared_ptr<Entity> const &player,
     bullet->setComponent<Components::CShape>(cShape);
     bullet->setComponent<Components::CTransform>(cTransform);
     bullet->setComponent<Components::CLifespan>(cLifespan);
+    m_lifespans.track(bullet);
     bullet->setComponent<Components::CBounceTracker>(cBounceTracker);
+    // Bullets can cover more than an enemy's width in one frame, so they
+    // are swept instead of only tested at their end position. They only
+    // stop at bodies the collision handlers respond to, and pass through
+    // the player and other bullets.
+    auto const cCollider = std::make_shared<Components::CCollider>(
+        Components::BodyType::Dynamic, false, true);
+    cCollider->sweepTags =
+        QueryFilter::withTags({EntityTags::Wall, EntityTags::Enemy,
+                               EntityTags::SpeedBoost,
+                               EntityTags::SlownessDebuff, EntityTags::Item})
+            .tags;
+    bullet->setComponent<Components::CCollider>(cCollider);
 
     for (std::shared_ptr<Entity> const &wall : walls) {
         if (CollisionHelpers::calculateCollisionBetweenEntities(bullet, wall)) {
@@ -445,19 +451,13 @@ void MainSceneSpawner::spawnBullets(std::shared_ptr<Entity> const &player,
     m_entityManager.update();
 }
 
-void MainSceneSpawner::spawnItem(std::shared_ptr<Entity> const &player) {
-    constexpr int MAX_SPAWN_ATTEMPTS = 10;
-
-    GameConfig const &gameConfig = m_config.getGameConfig();
+std::shared_ptr<Entity> MainSceneSpawner::createItem() {
     auto const &[spawnPercentage, lifespan, speed, shape] =
         m_config.getItemConfig();
-    Vec2 const &windowSize = gameConfig.windowSize;
 
-    auto const position =
-        SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
     auto const velocity = Vec2(0, 0);
     auto const cTransform =
-        std::make_shared<Components::CTransform>(position, velocity);
+        std::make_shared<Components::CTransform>(Vec2{0, 0}, velocity);
     // auto const cShape     = std::make_shared<Components::CShape>(m_renderer,
     // shape.height,
     //                                                  shape.width,
@@ -474,37 +474,16 @@ void MainSceneSpawner::spawnItem(std::shared_ptr<Entity> const &player) {
         std::make_shared<Components::CShape>(itemRect, shape.color);
     auto const cLifespan = std::make_shared<Components::CLifespan>(lifespan);
     auto const cSprite = std::make_shared<Components::CSprite>(COIN_TEXTURE_ID);
+    auto const cCollider = std::make_shared<Components::CCollider>(
+        Components::BodyType::Dynamic, true);
 
     auto const &item = m_entityManager.addEntity(EntityTags::Item);
     item->setComponent<Components::CTransform>(cTransform);
     item->setComponent<Components::CShape>(cShape);
     item->setComponent<Components::CLifespan>(cLifespan);
+    m_lifespans.track(item);
     item->setComponent<Components::CSprite>(cSprite);
+    item->setComponent<Components::CCollider>(cCollider);
 
-    if (!player) {
-        SDL_Log("Player missing, destroying item entity");
-        item->destroy();
-        return;
-    }
-
-    bool isValidSpawn = SpawnHelpers::validateSpawnPosition(
-        item, player, m_entityManager, windowSize);
-    int spawnAttempt = 1;
-
-    while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-        auto const newPosition =
-            SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-        item->getComponent<Components::CTransform>()->topLeftCornerPos =
-            newPosition;
-
-        isValidSpawn = SpawnHelpers::validateSpawnPosition(
-            item, player, m_entityManager, windowSize);
-        spawnAttempt += 1;
-    }
-
-    if (!isValidSpawn) {
-        item->destroy();
-    }
-
-    m_entityManager.update();
+    return item;
 }
@@ -1,3 +1,4 @@
+#include <Configuration/ActionIds.hpp>
 #include <Configuration/AudioIds.hpp>
 #include <HowToPlayScene/HowToPlayScene.hpp>
 #include <MainScene/MainScene.hpp>
@@ -8,9 +9,9 @@
 
 MenuScene::MenuScene(GameEngine *gameEngine) : Scene(gameEngine) {
     m_selectedIndex = 0;
-    registerAction(SDLK_RETURN, "SELECT");
-    registerAction(SDLK_w, "UP");
-    registerAction(SDLK_s, "DOWN");
+    registerAction(SDLK_RETURN, DemoActions::SELECT);
+    registerAction(SDLK_w, DemoActions::UP);
+    registerAction(SDLK_s, DemoActions::DOWN);
 }
 
 void MenuScene::update() {
@@ -22,14 +23,20 @@ void MenuScene::update() {
     }
 }
 
+void MenuScene::onPrepared() { MainScene::prepareNext(m_gameEngine); }
+
+void MenuScene::onResume() {
+    m_endTriggered = false;
+    MainScene::prepareNext(m_gameEngine);
+}
+
 void MenuScene::onEnd() {
     switch (m_selectedIndex) {
     case 0:
-        m_gameEngine->LoadScene("Main",
-                                std::make_shared<MainScene>(m_gameEngine));
+        m_gameEngine->PushScene("Main", MainScene::takeNext(m_gameEngine));
         break;
     case 1:
-        m_gameEngine->LoadScene("HowToPlay",
+        m_gameEngine->PushScene("HowToPlay",
                                 std::make_shared<HowToPlayScene>(m_gameEngine));
         break;
     case 2:
@@ -44,7 +51,7 @@ void MenuScene::sRender() {
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
     renderText();
-    SDL_RenderPresent(renderer);
+    m_gameEngine->getVideoManager().present();
 }
 
 void MenuScene::renderText() const {
@@ -112,7 +119,7 @@ void MenuScene::sDoAction(Action &action) {
         return;
     }
 
-    if (action.getName() == "SELECT") {
+    if (action.getId() == DemoActions::SELECT) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
                                       PriorityLevel::BACKGROUND);
         m_endTriggered = true;
@@ -120,7 +127,7 @@ void MenuScene::sDoAction(Action &action) {
     }
 
     // UP takes precedence over DOWN if both are pressed
-    if (action.getName() == "UP") {
+    if (action.getId() == DemoActions::UP) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_MOVE,
                                       PriorityLevel::BACKGROUND);
         m_selectedIndex > 0 ? m_selectedIndex -= 1
@@ -128,7 +135,7 @@ void MenuScene::sDoAction(Action &action) {
         return;
     }
 
-    if (action.getName() == "DOWN") {
+    if (action.getId() == DemoActions::DOWN) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_MOVE,
                                       PriorityLevel::BACKGROUND);
         m_selectedIndex < MAX_MENU_ITEMS - 1 ? m_selectedIndex += 1
@@ -202,7 +202,8 @@ namespace MovementHelpers {
                                 BASE_MOVEMENT_MULTIPLIER);
     }
     void moveItems(std::shared_ptr<Entity> const &entity,
-                   float const                   &deltaTime) {
+                   float const                   &deltaTime,
+                   double const                   sceneTimeMs) {
         if (entity == nullptr) {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
             return;
@@ -228,7 +229,7 @@ namespace MovementHelpers {
 
         // Use deltaTime to maintain consistent movement speed
         constexpr float ITEM_MOVEMENT_MULTIPLIER = .9f;
-        float const     time = static_cast<float>(SDL_GetTicks64()) / 1000.0f;
+        float const     time = static_cast<float>(sceneTimeMs / 1000.0);
         // Entity id will be odd when the last bit is 1
         bool const ENTITY_ID_ODD = entity->id() & 1;
 
@@ -1,3 +1,4 @@
+#include <Configuration/ActionIds.hpp>
 #include <Configuration/AudioIds.hpp>
 #include <MainScene/MainScene.hpp>
 #include <MenuScene/MenuScene.hpp>
@@ -10,9 +11,9 @@ ScoreScene::ScoreScene(GameEngine *gameEngine,
     : Scene(gameEngine),
       m_score(score) {
 
-    registerAction(SDLK_RETURN, "SELECT");
-    registerAction(SDLK_w, "UP");
-    registerAction(SDLK_s, "DOWN");
+    registerAction(SDLK_RETURN, DemoActions::SELECT);
+    registerAction(SDLK_w, DemoActions::UP);
+    registerAction(SDLK_s, DemoActions::DOWN);
 }
 
 void ScoreScene::update() {
@@ -26,20 +27,25 @@ void ScoreScene::update() {
 
 void ScoreScene::onEnd() {
     if (m_selectedIndex == 0) {
-        m_gameEngine->LoadScene("Main",
-                                std::make_shared<MainScene>(m_gameEngine));
+        m_gameEngine->ReplaceScene("Main", MainScene::takeNext(m_gameEngine));
     } else if (m_selectedIndex == 1) {
-        m_gameEngine->LoadScene("Menu",
-                                std::make_shared<MenuScene>(m_gameEngine));
+        if (m_gameEngine->getSceneCount() > 1) {
+            m_gameEngine->PopScene();
+        } else {
+            m_gameEngine->LoadScene("Menu",
+                                    std::make_shared<MenuScene>(m_gameEngine));
+        }
     }
 }
 
+void ScoreScene::onPrepared() { MainScene::prepareNext(m_gameEngine); }
+
 void ScoreScene::sRender() {
     SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
     renderText();
-    SDL_RenderPresent(renderer);
+    m_gameEngine->getVideoManager().present();
 }
 
 void ScoreScene::renderText() const {
@@ -94,7 +100,7 @@ void ScoreScene::sDoAction(Action &action) {
         return;
     }
 
-    if (action.getName() == "SELECT") {
+    if (action.getId() == DemoActions::SELECT) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_SELECT,
                                       PriorityLevel::BACKGROUND);
         m_endTriggered = true;
@@ -102,14 +108,14 @@ void ScoreScene::sDoAction(Action &action) {
     }
 
     // UP takes precedence over DOWN if both are pressed
-    if (action.getName() == "UP") {
+    if (action.getId() == DemoActions::UP) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_MOVE,
                                       PriorityLevel::BACKGROUND);
         m_selectedIndex > 0 ? m_selectedIndex -= 1 : m_selectedIndex = 1;
         return;
     }
 
-    if (action.getName() == "DOWN") {
+    if (action.getId() == DemoActions::DOWN) {
         audioSampleBuffer.queueSample(DemoAudio::SAMPLE_MENU_MOVE,
                                       PriorityLevel::BACKGROUND);
         m_selectedIndex < 1 ? m_selectedIndex += 1 : m_selectedIndex = 0;
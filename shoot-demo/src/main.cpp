@@ -1,5 +1,6 @@
 #include <Configuration/ConfigStore.hpp>
 #include <Configuration/AudioConfig.hpp>
+#include <MainScene/MainScene.hpp>
 #include <MenuScene/MenuScene.hpp>
 #include <SDL_main.h>
 #include <YerbEngine.hpp>
@@ -8,7 +9,63 @@
 #include <emscripten.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * Steps `worlds` copies of the main scene for `ticks` fixed ticks under
+     * random controls and logs the throughput, resetting worlds as they end.
+     */
+    void runBatch(GameEngine &engine, int const worlds, int const ticks) {
+        SceneBatch batch(engine.getJobSystem(), static_cast<size_t>(worlds),
+                         engine.nextRandomSeed(),
+                         [&engine](size_t, uint64_t const seed) {
+                             return MainScene::makeBatchWorld(&engine, seed);
+                         });
+
+        int const tickRate =
+            std::max(1, engine.GetConfig().getGameConfig().simulationTickRate);
+        float const tickSeconds = 1.0f / static_cast<float>(tickRate);
+        Vec2 const &windowSize = engine.getVideoManager().getWindowSize();
+
+        std::vector<float> controls(batch.size() * batch.getControlSize());
+        std::vector<float> observations(batch.size() *
+                                        batch.getObservationSize());
+        std::mt19937       randomGenerator(
+            static_cast<uint32_t>(engine.nextRandomSeed()));
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        auto const start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            for (size_t i = 0; i < controls.size();
+                 i += MainScene::CONTROL_SIZE) {
+                controls[i]     = unit(randomGenerator);
+                controls[i + 1] = unit(randomGenerator);
+                controls[i + 2] = unit(randomGenerator);
+                controls[i + 3] =
+                    (unit(randomGenerator) + 1) / 2 * windowSize.x();
+                controls[i + 4] =
+                    (unit(randomGenerator) + 1) / 2 * windowSize.y();
+            }
+            batch.step(controls, tickSeconds);
+            batch.observe(observations);
+            batch.resetDone();
+        }
+        std::chrono::duration<double> const elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                    "Stepped %d worlds for %d ticks on %zu threads in %.2fs "
+                    "(%.0f world ticks/s).",
+                    worlds, ticks, engine.getJobSystem().getThreadCount(),
+                    elapsed.count(),
+                    static_cast<double>(worlds) * ticks / elapsed.count());
+    }
+} // namespace
 
 int main(int    argc,
          char **argv) {
@@ -27,8 +84,14 @@ int main(int    argc,
         std::make_unique<GameEngine>(assetsDir, configDir, audioOptions);
 
     std::filesystem::path const demoConfigPath = configDir / "config.json";
+    int                         batchWorlds    = 0;
+    int                         batchTicks     = 0;
     if (std::filesystem::exists(demoConfigPath)) {
         auto demoConfig = YerbEngine::ConfigStore::fromJsonFile(demoConfigPath);
+        batchWorlds =
+            YerbEngine::ConfigAdapter::intOr(0, *demoConfig, "batch.worlds");
+        batchTicks =
+            YerbEngine::ConfigAdapter::intOr(3600, *demoConfig, "batch.ticks");
         engine->AddConfig("demo", std::move(demoConfig));
     } else {
         SDL_LogWarn(
@@ -37,10 +100,21 @@ int main(int    argc,
             demoConfigPath.string().c_str());
     }
 
-    // Register demo scenes
-    std::shared_ptr<Scene> const menuScene =
-        std::make_shared<MenuScene>(engine.get());
-    engine->LoadScene("Menu", menuScene);
+    // A batch run steps many worlds side by side instead of playing one.
+    if (batchWorlds > 0) {
+        runBatch(*engine, batchWorlds, batchTicks);
+        return 0;
+    }
+
+    // Register demo scenes. A headless run has no one to click through the
+    // menu, so it starts straight in the game.
+    if (engine->isHeadless()) {
+        engine->LoadScene("Main", std::make_shared<MainScene>(engine.get()));
+    } else {
+        std::shared_ptr<Scene> const menuScene =
+            std::make_shared<MenuScene>(engine.get());
+        engine->LoadScene("Menu", menuScene);
+    }
 
     engine->getAudioSampleBuffer().setCooldowns(DemoAudio::sampleCooldowns());
 
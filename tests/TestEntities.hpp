@@ -0,0 +1,49 @@
+#pragma once
+
+#include <EntityManagement/EntityManager.hpp>
+
+#include <memory>
+
+// Entity fixtures shared by the test suites.
+
+/**
+ * Adds a `size` box of `tag` at `position`, moving at `velocity`. It takes
+ * part in collisions as a dynamic body until given a collider.
+ */
+inline std::shared_ptr<YerbEngine::Entity>
+addBox(YerbEngine::EntityManager &manager,
+       YerbEngine::EntityTags     tag,
+       YerbEngine::Vec2 const    &position,
+       YerbEngine::Vec2 const    &size,
+       YerbEngine::Vec2 const    &velocity = YerbEngine::Vec2{0, 0}) {
+    using namespace YerbEngine;
+    auto entity = manager.addEntity(tag);
+    entity->setComponent(
+        std::make_shared<Components::CTransform>(position, velocity));
+    entity->setComponent(std::make_shared<Components::CShape>(
+        SDL_Rect{0, 0, static_cast<int>(size.x()), static_cast<int>(size.y())},
+        SDL_Color{255, 255, 255, 255}));
+    return entity;
+}
+
+/**
+ * Adds a square box with sides of `size`.
+ */
+inline std::shared_ptr<YerbEngine::Entity>
+addBox(YerbEngine::EntityManager &manager,
+       YerbEngine::EntityTags     tag,
+       YerbEngine::Vec2 const    &position,
+       int const                  size,
+       YerbEngine::Vec2 const    &velocity = YerbEngine::Vec2{0, 0}) {
+    auto const side = static_cast<float>(size);
+    return addBox(manager, tag, position, YerbEngine::Vec2{side, side},
+                  velocity);
+}
+
+/**
+ * Pins `entity` in place as a static body.
+ */
+inline void makeStatic(std::shared_ptr<YerbEngine::Entity> const &entity) {
+    entity->setComponent(std::make_shared<YerbEngine::Components::CCollider>(
+        YerbEngine::Components::BodyType::Static));
+}
@@ -0,0 +1,62 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/ActionMap.hpp>
+
+#include <type_traits>
+
+using namespace YerbEngine;
+
+BOOST_AUTO_TEST_SUITE(ActionMapTests)
+
+BOOST_AUTO_TEST_CASE(test_names_intern_to_stable_ids) {
+    Timer          timer("Names intern to stable ids");
+    ActionId const jump   = ActionNames::intern("TEST_JUMP");
+    ActionId const crouch = ActionNames::intern("TEST_CROUCH");
+
+    BOOST_CHECK_NE(jump, crouch);
+    BOOST_CHECK_NE(jump, NO_ACTION);
+    BOOST_CHECK_EQUAL(ActionNames::intern("TEST_JUMP"), jump);
+    BOOST_CHECK_EQUAL(ActionNames::name(jump), "TEST_JUMP");
+    BOOST_CHECK(ActionNames::name(NO_ACTION).empty());
+
+    Action const action(crouch, ActionState::END, std::nullopt);
+    BOOST_CHECK_EQUAL(action.getName(), "TEST_CROUCH");
+    BOOST_CHECK(std::is_trivially_copyable_v<Action>);
+}
+
+BOOST_AUTO_TEST_CASE(test_bind_and_find) {
+    Timer     timer("Bind and find");
+    ActionMap map;
+
+    BOOST_CHECK_EQUAL(map.find('w'), NO_ACTION);
+
+    map.bind('w', 1);
+    map.bind(1 << 30 | 82, 2); // a scancode-based keycode
+    map.bind(1, 3);            // a mouse button
+    BOOST_CHECK_EQUAL(map.size(), 3);
+    BOOST_CHECK_EQUAL(map.find('w'), 1);
+    BOOST_CHECK_EQUAL(map.find(1 << 30 | 82), 2);
+    BOOST_CHECK_EQUAL(map.find(1), 3);
+    BOOST_CHECK(!map.contains('s'));
+
+    map.bind('w', 4);
+    BOOST_CHECK_EQUAL(map.size(), 3);
+    BOOST_CHECK_EQUAL(map.find('w'), 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_keeps_bindings_when_growing) {
+    Timer     timer("Keeps bindings when growing");
+    ActionMap map;
+
+    for (int32_t input = 0; input < 500; ++input) {
+        map.bind(input * 7, static_cast<ActionId>(input));
+    }
+    BOOST_CHECK_EQUAL(map.size(), 500);
+    for (int32_t input = 0; input < 500; ++input) {
+        BOOST_CHECK_EQUAL(map.find(input * 7), static_cast<ActionId>(input));
+    }
+    BOOST_CHECK_EQUAL(map.find(1), NO_ACTION);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
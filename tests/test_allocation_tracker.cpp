@@ -0,0 +1,251 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestEntities.hpp"
+#include "Timer.hpp"
+#include <EntityManagement/EntityManager.hpp>
+#include <GameScenes/SystemPipeline.hpp>
+#include <Physics/CollisionWorld.hpp>
+#include <Profiling/AllocationTracker.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    // Not inlined, so every call allocates from the same stack.
+    [[gnu::noinline]] std::unique_ptr<int> allocateInt(int const value) {
+        return std::make_unique<int>(value);
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(AllocationTrackerTests)
+
+BOOST_AUTO_TEST_CASE(test_thread_counts) {
+    Timer timer("Thread counts");
+    if (!AllocationTracker::isEnabled()) {
+        return;
+    }
+
+    AllocationScope scope;
+    {
+        auto value = std::make_unique<int>(1);
+        std::vector<double> values;
+        values.reserve(100);
+    }
+    AllocationCounts const counts = scope.getCounts();
+    BOOST_CHECK_EQUAL(counts.allocations, 2);
+    BOOST_CHECK_EQUAL(counts.frees, 2);
+    BOOST_CHECK_GE(counts.bytes, sizeof(int) + 100 * sizeof(double));
+
+    // Another thread's allocations count in the total, not in this thread's.
+    AllocationCounts const before = AllocationTracker::getTotalCounts();
+    uint64_t               workerAllocations = 0;
+    std::thread            worker([&workerAllocations] {
+        AllocationScope workerScope;
+        for (int i = 0; i < 10; ++i) {
+            static_cast<void>(allocateInt(i));
+        }
+        workerAllocations = workerScope.getCounts().allocations;
+    });
+    worker.join();
+    BOOST_CHECK_EQUAL(workerAllocations, 10);
+    BOOST_CHECK_GE((AllocationTracker::getTotalCounts() - before).allocations,
+                   10);
+}
+
+BOOST_AUTO_TEST_CASE(test_no_allocation_scope) {
+    Timer timer("No allocation scope");
+    if (!AllocationTracker::isEnabled()) {
+        return;
+    }
+
+    std::vector<int> values;
+    values.reserve(16);
+    {
+        NoAllocationScope scope("reserved push");
+        for (int i = 0; i < 16; ++i) {
+            values.push_back(i);
+        }
+        uint64_t const violations = scope.getViolations();
+        bool const     captured   = !scope.getFirstStack().empty();
+        BOOST_CHECK_EQUAL(violations, 0);
+        BOOST_CHECK(!captured);
+    }
+
+    NoAllocationScope scope("growing push");
+    values.push_back(16);
+    static_cast<void>(allocateInt(1));
+    BOOST_CHECK_EQUAL(scope.getViolations(), 2);
+    if (AllocationTracker::canTrackSites()) {
+        BOOST_CHECK(!scope.getFirstStack().empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_steady_state_pipeline) {
+    Timer timer("Steady-state pipeline");
+    if (!AllocationTracker::isEnabled()) {
+        return;
+    }
+
+    SystemPipeline   pipeline;
+    int              moves = 0;
+    std::vector<int> scratch;
+    pipeline.add("move", SystemPhase::Simulate, [&moves] { moves += 1; });
+    pipeline.add("grow", SystemPhase::Simulate, [&scratch] {
+        scratch.push_back(static_cast<int>(scratch.size()));
+    });
+    pipeline.add("idle", SystemPhase::Simulate, [] {});
+
+    // The first pass builds the schedule; later ones reuse it.
+    pipeline.run(SystemPhase::Simulate);
+    pipeline.setEnabled("grow", false);
+    {
+        NoAllocationScope scope("simulate tick");
+        for (int i = 0; i < 100; ++i) {
+            pipeline.run(SystemPhase::Simulate);
+        }
+        BOOST_CHECK_EQUAL(scope.getViolations(), 0);
+    }
+    BOOST_CHECK_EQUAL(moves, 101);
+
+    // Systems are charged with what they allocate.
+    pipeline.setEnabled("grow", true);
+    pipeline.resetStats();
+    pipeline.run(SystemPhase::Simulate);
+    BOOST_CHECK_GE(pipeline.getStats("grow").allocations, 1);
+    BOOST_CHECK_EQUAL(pipeline.getStats("move").allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_steady_state_collision_tick) {
+    Timer timer("Steady-state collision tick");
+    if (!AllocationTracker::isEnabled()) {
+        return;
+    }
+
+    // Boxes bouncing around a walled arena, moved by a parallel system and
+    // collided by a CollisionWorld on the same job system, as in a scene.
+    constexpr float WIDTH  = 800.0f;
+    constexpr float HEIGHT = 600.0f;
+    constexpr float STEP   = 1.0f / 60.0f;
+    EntityManager   entities;
+    CollisionWorld  world;
+    JobSystem       jobs(4);
+    SystemPipeline  pipeline;
+    world.setBounds(Vec2{WIDTH, HEIGHT});
+    world.setJobSystem(&jobs);
+    pipeline.setJobSystem(&jobs);
+
+    for (int i = 0; i < 300; ++i) {
+        addBox(entities, EntityTags::Enemy,
+               Vec2{static_cast<float>(20 + i * 37 % 740),
+                    static_cast<float>(20 + i * 53 % 540)},
+               12,
+               Vec2{static_cast<float>(i % 11) * 30 - 150,
+                    static_cast<float>(i % 7) * 40 - 120});
+    }
+    for (Vec2 const &wall : {Vec2{0, 0}, Vec2{WIDTH - 10, 0}}) {
+        makeStatic(addBox(entities, EntityTags::Wall, wall, 10));
+    }
+    entities.update();
+
+    size_t contacts     = 0;
+    size_t peakContacts = 0;
+    int    area         = 0;
+    pipeline
+        .add("movement", SystemPhase::Simulate,
+             SystemAccess()
+                 .reads<Components::CShape>()
+                 .writes<Components::CTransform>(),
+             [&] {
+                 EntityList const &all = entities.getEntities();
+                 jobs.parallelFor(all.size(), [&](size_t const index) {
+                     auto const transform =
+                         all[index]->getComponent<Components::CTransform>();
+                     Vec2 position = transform->topLeftCornerPos +
+                                     transform->velocity * STEP;
+                     Vec2 velocity = transform->velocity;
+                     if (position.x() < 0 || position.x() > WIDTH - 12) {
+                         velocity = Vec2{-velocity.x(), velocity.y()};
+                     }
+                     if (position.y() < 0 || position.y() > HEIGHT - 12) {
+                         velocity = Vec2{velocity.x(), -velocity.y()};
+                     }
+                     transform->storePreviousPosition();
+                     transform->topLeftCornerPos = position;
+                     transform->velocity         = velocity;
+                 });
+             })
+        .add("census", SystemPhase::Simulate,
+             SystemAccess().reads<Components::CShape>(),
+             [&] {
+                 for (auto const &entity : entities.getEntities()) {
+                     area += entity->getComponent<Components::CShape>()
+                                 ->rect.w;
+                 }
+             })
+        .add("collision", SystemPhase::Post, [&] {
+            world.update(entities);
+            contacts     += world.getContactEvents().size();
+            peakContacts  = std::max(peakContacts,
+                                     world.getContactEvents().size());
+        });
+
+    // Long enough for the grids and pair lists to reach their working
+    // size. Contact counts keep setting new highs now and then, so the
+    // contact buffers are then sized from the peak seen, with headroom.
+    for (int tick = 0; tick < 600; ++tick) {
+        pipeline.run(SystemPhase::Simulate);
+        pipeline.run(SystemPhase::Post);
+    }
+    world.reserveContacts(peakContacts * 2);
+
+    constexpr uint64_t TICKS = 120;
+    AllocationCounts const before     = AllocationTracker::getTotalCounts();
+    uint64_t               mainThread = 0;
+    {
+        NoAllocationScope scope("collision tick");
+        for (uint64_t tick = 0; tick < TICKS; ++tick) {
+            pipeline.run(SystemPhase::Simulate);
+            pipeline.run(SystemPhase::Post);
+        }
+        mainThread = scope.getViolations();
+    }
+    uint64_t const allThreads =
+        (AllocationTracker::getTotalCounts() - before).allocations;
+    BOOST_TEST_MESSAGE("Steady-state collision tick: "
+                       << mainThread << " allocations on the main thread, "
+                       << allThreads << " on all threads over " << TICKS
+                       << " ticks, " << contacts << " contact events");
+    BOOST_CHECK_GT(contacts, 0);
+    BOOST_CHECK_GT(area, 0);
+
+    BOOST_CHECK_EQUAL(mainThread, 0);
+    BOOST_CHECK_EQUAL(allThreads, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_call_sites) {
+    Timer timer("Call sites");
+    if (!AllocationTracker::canTrackSites()) {
+        return;
+    }
+
+    AllocationTracker::setSiteTracking(true);
+    for (int i = 0; i < 50; ++i) {
+        static_cast<void>(allocateInt(i));
+    }
+    AllocationTracker::setSiteTracking(false);
+    BOOST_CHECK(!AllocationTracker::isSiteTracking());
+
+    std::vector<AllocationSite> const sites =
+        AllocationTracker::getTopSites(1);
+    BOOST_REQUIRE_EQUAL(sites.size(), 1);
+    BOOST_CHECK_GE(sites[0].allocations, 50);
+    BOOST_CHECK_GE(sites[0].bytes, 50 * sizeof(int));
+    BOOST_CHECK(!sites[0].frames.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,40 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/BackgroundPolicy.hpp>
+
+using namespace YerbEngine;
+
+BOOST_AUTO_TEST_SUITE(BackgroundPolicyTests)
+
+BOOST_AUTO_TEST_CASE(test_select) {
+    Timer              timer("Select");
+    BackgroundSettings settings;
+    settings.unfocused = BackgroundPolicy::Simulate;
+    settings.hidden    = BackgroundPolicy::Pause;
+
+    BOOST_CHECK(settings.select(false, true) == BackgroundPolicy::Run);
+    BOOST_CHECK(settings.select(false, false) == BackgroundPolicy::Simulate);
+    // Hidden wins, whether or not the window kept focus.
+    BOOST_CHECK(settings.select(true, false) == BackgroundPolicy::Pause);
+    BOOST_CHECK(settings.select(true, true) == BackgroundPolicy::Pause);
+}
+
+BOOST_AUTO_TEST_CASE(test_parse) {
+    Timer timer("Parse");
+    BOOST_CHECK(parseBackgroundPolicy("run") == BackgroundPolicy::Run);
+    BOOST_CHECK(parseBackgroundPolicy("simulate") ==
+                BackgroundPolicy::Simulate);
+    BOOST_CHECK(parseBackgroundPolicy("pause") == BackgroundPolicy::Pause);
+    BOOST_CHECK(!parseBackgroundPolicy("Pause").has_value());
+    BOOST_CHECK(!parseBackgroundPolicy("").has_value());
+
+    BOOST_CHECK(parseBackgroundAudio("keep") == BackgroundAudio::Keep);
+    BOOST_CHECK(parseBackgroundAudio("duck") == BackgroundAudio::Duck);
+    BOOST_CHECK(parseBackgroundAudio("pause") == BackgroundAudio::Pause);
+    BOOST_CHECK(!parseBackgroundAudio("mute").has_value());
+
+    BOOST_CHECK_EQUAL(toString(BackgroundPolicy::Simulate), "simulate");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
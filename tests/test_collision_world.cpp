@@ -0,0 +1,747 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestEntities.hpp"
+#include "Timer.hpp"
+#include <EntityManagement/EntityManager.hpp>
+#include <Helpers/CollisionHelpers.hpp>
+#include <Physics/CollisionWorld.hpp>
+#include <Physics/SweptAABB.hpp>
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+using namespace YerbEngine;
+
+namespace {
+    void allowSleep(std::shared_ptr<Entity> const &entity) {
+        entity->setComponent(std::make_shared<Components::CCollider>(
+            Components::BodyType::Dynamic, true));
+    }
+
+    void makeFastMover(std::shared_ptr<Entity> const &entity) {
+        entity->setComponent(std::make_shared<Components::CCollider>(
+            Components::BodyType::Dynamic, false, true));
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CollisionWorldTests)
+
+BOOST_AUTO_TEST_CASE(test_dynamic_pairs_reported_once) {
+    Timer          timer("Dynamic pairs reported once");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    // Large boxes straddle several grid cells.
+    auto a = addBox(manager, EntityTags::Enemy, Vec2{100, 100}, 150);
+    auto b = addBox(manager, EntityTags::Enemy, Vec2{200, 200}, 150);
+    addBox(manager, EntityTags::Enemy, Vec2{600, 400}, 20);
+    manager.update();
+
+    world.update(manager);
+
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityA->id(), a->id());
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityB->id(), b->id());
+    // Every reported pair was tested first.
+    BOOST_CHECK_GE(world.getPairsTested(), world.getPairs().size());
+}
+
+BOOST_AUTO_TEST_CASE(test_touching_edges_do_not_collide) {
+    Timer          timer("Touching edges do not collide");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    addBox(manager, EntityTags::Enemy, Vec2{100, 100}, 50);
+    addBox(manager, EntityTags::Enemy, Vec2{150, 100}, 50);
+    manager.update();
+
+    world.update(manager);
+    BOOST_CHECK(world.getPairs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_static_static_pairs_skipped) {
+    Timer          timer("Static-static pairs skipped");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto wallA = addBox(manager, EntityTags::Wall, Vec2{0, 0}, 200);
+    auto wallB = addBox(manager, EntityTags::Wall, Vec2{100, 100}, 200);
+    makeStatic(wallA);
+    makeStatic(wallB);
+    auto enemy = addBox(manager, EntityTags::Enemy, Vec2{250, 250}, 30);
+    manager.update();
+
+    world.update(manager);
+
+    BOOST_CHECK(world.isStatic(wallA->id()));
+    BOOST_CHECK_EQUAL(world.getStaticBodyCount(), 2);
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityA->id(), enemy->id());
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityB->id(), wallB->id());
+}
+
+BOOST_AUTO_TEST_CASE(test_destroyed_static_body_removed) {
+    Timer          timer("Destroyed static body removed");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{0, 0}, 200);
+    makeStatic(wall);
+    addBox(manager, EntityTags::Enemy, Vec2{50, 50}, 30);
+    manager.update();
+
+    world.update(manager);
+    BOOST_CHECK_EQUAL(world.getPairs().size(), 1);
+
+    wall->destroy();
+    manager.update();
+    world.update(manager);
+
+    BOOST_CHECK_EQUAL(world.getStaticBodyCount(), 0);
+    BOOST_CHECK(world.getPairs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_idle_body_falls_asleep) {
+    Timer          timer("Idle body falls asleep");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 3);
+    world.setBounds(Vec2{800, 600});
+
+    auto idle   = addBox(manager, EntityTags::Item, Vec2{100, 100}, 20);
+    auto moving = addBox(manager, EntityTags::Enemy, Vec2{400, 400}, 20,
+                         Vec2{1, 0});
+    allowSleep(idle);
+    allowSleep(moving);
+    manager.update();
+
+    for (int tick = 0; tick < 5; ++tick) {
+        moving->getComponent<Components::CTransform>()->topLeftCornerPos +=
+            Vec2{1, 0};
+        world.update(manager);
+    }
+
+    BOOST_CHECK(world.isSleeping(idle->id()));
+    BOOST_CHECK(!world.isSleeping(moving->id()));
+    BOOST_CHECK_EQUAL(world.getSleepingBodyCount(), 1);
+    BOOST_CHECK_EQUAL(world.getAwakeBodyCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_sleeping_pairs_skipped_and_woken_on_contact) {
+    Timer          timer("Sleeping pairs skipped, woken on contact");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 1);
+    world.setBounds(Vec2{800, 600});
+
+    auto sleeperA = addBox(manager, EntityTags::Item, Vec2{100, 100}, 40);
+    auto sleeperB = addBox(manager, EntityTags::Item, Vec2{120, 120}, 40);
+    allowSleep(sleeperA);
+    allowSleep(sleeperB);
+    manager.update();
+
+    // First update records positions, second sees them idle.
+    world.update(manager);
+    world.update(manager);
+    BOOST_REQUIRE(world.isSleeping(sleeperA->id()));
+    BOOST_REQUIRE(world.isSleeping(sleeperB->id()));
+    BOOST_CHECK(world.getPairs().empty());
+
+    auto intruder = addBox(manager, EntityTags::Enemy, Vec2{90, 90}, 20,
+                           Vec2{1, 1});
+    manager.update();
+    world.update(manager);
+
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityA->id(), intruder->id());
+    BOOST_CHECK(!world.isSleeping(sleeperA->id()));
+    BOOST_CHECK(world.isSleeping(sleeperB->id()));
+}
+
+BOOST_AUTO_TEST_CASE(test_wake_restores_body) {
+    Timer          timer("Wake restores body");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 2);
+    world.setBounds(Vec2{800, 600});
+
+    auto player = addBox(manager, EntityTags::Player, Vec2{300, 300}, 50);
+    allowSleep(player);
+    manager.update();
+
+    for (int tick = 0; tick < 3; ++tick) {
+        world.update(manager);
+    }
+    BOOST_REQUIRE(world.isSleeping(player->id()));
+
+    world.wake(player->id());
+    BOOST_CHECK(!world.isSleeping(player->id()));
+    BOOST_CHECK_EQUAL(world.getSleepingBodyCount(), 0);
+
+    // The idle counter restarts, so one update keeps it awake.
+    world.update(manager);
+    BOOST_CHECK_EQUAL(world.getAwakeBodyCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_broadphase_many_bodies) {
+    Timer          timer("Broadphase 1000 bodies");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{1600, 900});
+
+    for (int i = 0; i < 1000; ++i) {
+        float const x = static_cast<float>((i * 37) % 1580);
+        float const y = static_cast<float>((i * 91) % 880);
+        addBox(manager, EntityTags::Enemy, Vec2{x, y}, 20);
+    }
+    manager.update();
+
+    world.update(manager);
+
+    // Compare against the brute-force pair count.
+    size_t      expected = 0;
+    auto const &entities = manager.getEntities();
+    for (size_t i = 0; i < entities.size(); ++i) {
+        for (size_t j = i + 1; j < entities.size(); ++j) {
+            if (CollisionHelpers::calculateCollisionBetweenEntities(
+                    entities[i], entities[j])) {
+                expected += 1;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(world.getPairs().size(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_contact_begin_stay_end) {
+    Timer          timer("Contact begin, stay and end");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto a = addBox(manager, EntityTags::Enemy, Vec2{100, 100}, 40);
+    auto b = addBox(manager, EntityTags::Enemy, Vec2{120, 120}, 40);
+    manager.update();
+
+    world.update(manager);
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::Begin);
+
+    world.update(manager);
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::Stay);
+
+    b->getComponent<Components::CTransform>()->topLeftCornerPos =
+        Vec2{400, 400};
+    world.update(manager);
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::End);
+    BOOST_CHECK_EQUAL(world.getContactEvents()[0].entityA->id(), a->id());
+
+    world.update(manager);
+    BOOST_CHECK(world.getContactEvents().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_destroyed_entity_ends_contact) {
+    Timer          timer("Destroyed entity ends contact");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{0, 0}, 200);
+    makeStatic(wall);
+    auto bullet = addBox(manager, EntityTags::Bullet, Vec2{50, 50}, 10);
+    manager.update();
+
+    world.update(manager);
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+
+    bullet->destroy();
+    manager.update();
+    world.update(manager);
+
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::End);
+    BOOST_CHECK_EQUAL(world.getContactEvents()[0].entityA->id(), bullet->id());
+}
+
+BOOST_AUTO_TEST_CASE(test_resting_contact_stays_while_asleep) {
+    Timer          timer("Resting contact stays while asleep");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 2);
+    world.setBounds(Vec2{800, 600});
+
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{0, 0}, 200);
+    makeStatic(wall);
+    auto item = addBox(manager, EntityTags::Item, Vec2{150, 150}, 100);
+    allowSleep(item);
+    manager.update();
+
+    for (int tick = 0; tick < 5; ++tick) {
+        world.update(manager);
+    }
+
+    BOOST_REQUIRE(world.isSleeping(item->id()));
+    BOOST_CHECK(world.getPairs().empty());
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::Stay);
+}
+
+BOOST_AUTO_TEST_CASE(test_swept_aabb_time_of_impact) {
+    Timer      timer("Swept AABB time of impact");
+    AABB const moving{Vec2{0, 0}, Vec2{10, 10}};
+    AABB const target{Vec2{50, 0}, Vec2{60, 10}};
+    float      timeOfImpact = 0.0f;
+
+    BOOST_REQUIRE(sweepAABB(moving, Vec2{80, 0}, target, timeOfImpact));
+    BOOST_CHECK_CLOSE(timeOfImpact, 0.5f, 0.001f);
+
+    // Too short, wrong direction, grazing and already overlapping.
+    BOOST_CHECK(!sweepAABB(moving, Vec2{30, 0}, target, timeOfImpact));
+    BOOST_CHECK(!sweepAABB(moving, Vec2{-80, 0}, target, timeOfImpact));
+    BOOST_CHECK(!sweepAABB(AABB{Vec2{0, 10}, Vec2{10, 20}}, Vec2{80, 0},
+                           target, timeOfImpact));
+    BOOST_CHECK(!sweepAABB(AABB{Vec2{45, 0}, Vec2{55, 10}}, Vec2{80, 0},
+                           target, timeOfImpact));
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_mover_does_not_tunnel) {
+    Timer          timer("Fast mover does not tunnel");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{200, 0}, 10);
+    wall->getComponent<Components::CShape>()->rect.h = 600;
+    makeStatic(wall);
+    auto bullet = addBox(manager, EntityTags::Bullet, Vec2{100, 100}, 5,
+                         Vec2{200, 0});
+    auto slow   = addBox(manager, EntityTags::Enemy, Vec2{100, 300}, 5,
+                         Vec2{200, 0});
+    makeFastMover(bullet);
+    manager.update();
+
+    world.update(manager);
+
+    // Both jump clean over the wall in a single tick.
+    bullet->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{200, 0};
+    slow->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{200, 0};
+    world.update(manager);
+
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityA->id(), bullet->id());
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityB->id(), wall->id());
+
+    // Moved back to impact (x = 195) plus the sweep skin.
+    Vec2 const &position =
+        bullet->getComponent<Components::CTransform>()->topLeftCornerPos;
+    BOOST_CHECK_CLOSE(position.x(), 196.0f, 0.01f);
+    BOOST_CHECK(CollisionHelpers::calculateCollisionBetweenEntities(bullet,
+                                                                    wall));
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_mover_hits_crossing_target) {
+    Timer          timer("Fast mover hits crossing target");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto bullet = addBox(manager, EntityTags::Bullet, Vec2{100, 100}, 5);
+    auto enemy  = addBox(manager, EntityTags::Enemy, Vec2{180, 60}, 20);
+    makeFastMover(bullet);
+    manager.update();
+
+    world.update(manager);
+
+    // The enemy crosses the bullet's path mid-tick (t = 0.375 to 0.5) and
+    // neither end-of-tick box overlaps the other.
+    bullet->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{200, 0};
+    enemy->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{0, 80};
+    world.update(manager);
+
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityA->id(), bullet->id());
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityB->id(), enemy->id());
+    BOOST_CHECK(world.getPairs()[0].swept);
+    BOOST_REQUIRE_EQUAL(world.getContactEvents().size(), 1);
+    BOOST_CHECK(world.getContactEvents()[0].type == ContactEventType::Begin);
+    BOOST_CHECK(world.getContactEvents()[0].swept);
+
+    // Stopped at the impact (x = 175) plus the sweep skin.
+    BOOST_CHECK_CLOSE(
+        bullet->getComponent<Components::CTransform>()->topLeftCornerPos.x(),
+        176.0f, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_mover_passes_bodies_outside_sweep_mask) {
+    Timer          timer("Fast mover passes bodies outside mask");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto bullet = addBox(manager, EntityTags::Bullet, Vec2{100, 100}, 5);
+    auto item   = addBox(manager, EntityTags::Item, Vec2{150, 98}, 10);
+    auto enemy  = addBox(manager, EntityTags::Enemy, Vec2{250, 98}, 10);
+    makeFastMover(bullet);
+    bullet->getComponent<Components::CCollider>()->sweepTags =
+        QueryFilter::withTags({EntityTags::Enemy}).tags;
+    manager.update();
+
+    world.update(manager);
+    bullet->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{300, 0};
+    world.update(manager);
+
+    // The item is in the way but not in the mask, so the bullet only
+    // stops at the enemy behind it.
+    BOOST_REQUIRE_EQUAL(world.getPairs().size(), 1);
+    BOOST_CHECK_EQUAL(world.getPairs()[0].entityB->id(), enemy->id());
+    BOOST_CHECK_CLOSE(
+        bullet->getComponent<Components::CTransform>()->topLeftCornerPos.x(),
+        246.0f, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_movers_in_formation_do_not_collide) {
+    Timer          timer("Fast movers in formation do not collide");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto lead   = addBox(manager, EntityTags::Bullet, Vec2{120, 100}, 5);
+    auto follow = addBox(manager, EntityTags::Bullet, Vec2{100, 100}, 5);
+    makeFastMover(lead);
+    makeFastMover(follow);
+    manager.update();
+
+    world.update(manager);
+    lead->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{100, 0};
+    follow->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{100, 0};
+    world.update(manager);
+
+    BOOST_CHECK(world.getPairs().empty());
+    BOOST_CHECK_CLOSE(
+        follow->getComponent<Components::CTransform>()->topLeftCornerPos.x(),
+        200.0f, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(test_query_radius_matches_brute_force) {
+    Timer          timer("Query radius matches brute force");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{1600, 900});
+
+    for (int i = 0; i < 500; ++i) {
+        float const x   = static_cast<float>((i * 37) % 1580);
+        float const y   = static_cast<float>((i * 91) % 880);
+        auto const  tag = i % 3 == 0 ? EntityTags::Enemy : EntityTags::Item;
+        addBox(manager, tag, Vec2{x, y}, 20);
+    }
+    manager.update();
+    world.update(manager);
+
+    Vec2 const   center{800, 450};
+    float const  radius = 150.0f;
+    EntityList   results;
+    size_t const found =
+        world.queryRadius(center, radius,
+                          QueryFilter::withTags({EntityTags::Enemy}), results);
+
+    size_t expected = 0;
+    for (auto const &entity : manager.getEntities(EntityTags::Enemy)) {
+        if (center.euclideanDistanceSquared(entity->getCenterPos()) <
+            radius * radius) {
+            expected += 1;
+        }
+    }
+    BOOST_CHECK_GT(expected, 0);
+    BOOST_CHECK_EQUAL(found, expected);
+    BOOST_CHECK_EQUAL(results.size(), expected);
+    for (auto const &entity : results) {
+        BOOST_CHECK(entity->tag() == EntityTags::Enemy);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_query_rect_and_layers) {
+    Timer          timer("Query rect and layers");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{100, 100}, 50);
+    makeStatic(wall);
+    auto enemy = addBox(manager, EntityTags::Enemy, Vec2{120, 120}, 20);
+    auto ghost = addBox(manager, EntityTags::Enemy, Vec2{130, 130}, 20);
+    auto ghostCollider = std::make_shared<Components::CCollider>();
+    ghostCollider->layers = 1u << 3;
+    ghost->setComponent(ghostCollider);
+    addBox(manager, EntityTags::Enemy, Vec2{500, 500}, 20);
+    manager.update();
+    world.update(manager);
+
+    AABB const area{Vec2{90, 90}, Vec2{200, 200}};
+    EntityList results;
+
+    BOOST_CHECK_EQUAL(world.queryRect(area, QueryFilter{}, results), 3);
+
+    results.clear();
+    QueryFilter const ghosts{.layers = 1u << 3};
+    BOOST_REQUIRE_EQUAL(world.queryRect(area, ghosts, results), 1);
+    BOOST_CHECK_EQUAL(results[0]->id(), ghost->id());
+
+    // Results are appended, so callers can batch several queries.
+    QueryFilter const defaultEnemies{
+        .tags   = QueryFilter::tagBit(EntityTags::Enemy),
+        .layers = Components::CCollider::DEFAULT_LAYER};
+    BOOST_REQUIRE_EQUAL(world.queryRect(area, defaultEnemies, results), 1);
+    BOOST_CHECK_EQUAL(results.size(), 2);
+    BOOST_CHECK_EQUAL(results[1]->id(), enemy->id());
+}
+
+BOOST_AUTO_TEST_CASE(test_query_nearest) {
+    Timer          timer("Query nearest");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    auto near   = addBox(manager, EntityTags::Enemy, Vec2{100, 100}, 10);
+    auto middle = addBox(manager, EntityTags::Enemy, Vec2{300, 100}, 10);
+    auto far    = addBox(manager, EntityTags::Enemy, Vec2{700, 500}, 10);
+    addBox(manager, EntityTags::Item, Vec2{90, 90}, 10);
+    manager.update();
+    world.update(manager);
+
+    EntityList        results;
+    QueryFilter const enemies = QueryFilter::withTags({EntityTags::Enemy});
+
+    BOOST_REQUIRE_EQUAL(
+        world.queryNearest(Vec2{80, 80}, 2, enemies, results), 2);
+    BOOST_CHECK_EQUAL(results[0]->id(), near->id());
+    BOOST_CHECK_EQUAL(results[1]->id(), middle->id());
+
+    // Asking for more than exist returns everything, still sorted.
+    results.clear();
+    BOOST_REQUIRE_EQUAL(
+        world.queryNearest(Vec2{80, 80}, 10, enemies, results), 3);
+    BOOST_CHECK_EQUAL(results[2]->id(), far->id());
+}
+
+BOOST_AUTO_TEST_CASE(test_query_nearest_from_several_threads) {
+    Timer          timer("Query nearest from several threads");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    for (int y = 0; y < 10; ++y) {
+        for (int x = 0; x < 10; ++x) {
+            addBox(manager, EntityTags::Enemy,
+                   Vec2{static_cast<float>(x * 70 + 20),
+                        static_cast<float>(y * 55 + 20)},
+                   10);
+        }
+    }
+    manager.update();
+    world.update(manager);
+
+    // Readers share the world, as systems in one pipeline wave do.
+    auto const nearestIds = [&world](Vec2 const &center) {
+        EntityList results;
+        world.queryNearest(center, 5, QueryFilter{}, results);
+        std::vector<size_t> ids;
+        for (auto const &entity : results) {
+            ids.push_back(entity->id());
+        }
+        return ids;
+    };
+
+    std::vector<Vec2> centers;
+    for (int i = 0; i < 4; ++i) {
+        centers.emplace_back(static_cast<float>(100 + i * 150),
+                             static_cast<float>(80 + i * 120));
+    }
+    std::vector<std::vector<size_t>> expected;
+    for (Vec2 const &center : centers) {
+        expected.push_back(nearestIds(center));
+    }
+
+    std::vector<int>         mismatches(centers.size(), 0);
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < centers.size(); ++i) {
+        readers.emplace_back([&, i] {
+            for (int run = 0; run < 200; ++run) {
+                if (nearestIds(centers[i]) != expected[i]) {
+                    mismatches[i] += 1;
+                }
+            }
+        });
+    }
+    for (std::thread &reader : readers) {
+        reader.join();
+    }
+    for (int const count : mismatches) {
+        BOOST_CHECK_EQUAL(count, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_query_after_wake) {
+    Timer          timer("Query after wake");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 1);
+    world.setBounds(Vec2{800, 600});
+
+    auto first  = addBox(manager, EntityTags::Item, Vec2{100, 100}, 10);
+    auto second = addBox(manager, EntityTags::Item, Vec2{400, 400}, 10);
+    allowSleep(first);
+    allowSleep(second);
+    manager.update();
+    world.update(manager);
+    world.update(manager);
+    BOOST_REQUIRE_EQUAL(world.getSleepingBodyCount(), 2);
+
+    // Waking reorders the sleeping set before its grid is rebuilt.
+    world.wake(first->id());
+
+    EntityList results;
+    BOOST_REQUIRE_EQUAL(
+        world.queryRadius(Vec2{405, 405}, 20.0f, QueryFilter{}, results), 1);
+    BOOST_CHECK_EQUAL(results[0]->id(), second->id());
+}
+
+BOOST_AUTO_TEST_CASE(test_woken_body_is_queryable_before_update) {
+    Timer          timer("Woken body is queryable before update");
+    EntityManager  manager;
+    CollisionWorld world(64.0f, 1);
+    world.setBounds(Vec2{800, 600});
+
+    auto sleeper = addBox(manager, EntityTags::Item, Vec2{100, 100}, 10);
+    allowSleep(sleeper);
+    manager.update();
+    world.update(manager);
+    world.update(manager);
+    BOOST_REQUIRE(world.isSleeping(sleeper->id()));
+
+    world.wake(sleeper->id());
+    BOOST_CHECK_EQUAL(world.getSleepingBodyCount(), 0);
+    BOOST_CHECK_EQUAL(world.getAwakeBodyCount(), 1);
+    BOOST_CHECK(world.anyBodyIn(AABB{Vec2{95, 95}, Vec2{105, 105}}));
+
+    // Destroyed bodies drop their slot on the next update.
+    sleeper->destroy();
+    world.update(manager);
+    BOOST_CHECK(!world.isSleeping(sleeper->id()));
+    BOOST_CHECK_EQUAL(world.getAwakeBodyCount(), 0);
+    BOOST_CHECK(!world.anyBodyIn(AABB{Vec2{95, 95}, Vec2{105, 105}}));
+}
+
+namespace {
+    // Crowded scene of pushable boxes around a static wall, resolved with a
+    // simple push-apart that writes to both bodies.
+    std::vector<Vec2> simulateCrowd(JobSystem *pool, size_t &batchCount) {
+        EntityManager  manager;
+        CollisionWorld world;
+        world.setJobSystem(pool);
+        world.setBounds(Vec2{800, 600});
+
+        auto wall = addBox(manager, EntityTags::Wall, Vec2{380, 0}, 40);
+        wall->getComponent<Components::CShape>()->rect.h = 600;
+        makeStatic(wall);
+        for (int i = 0; i < 600; ++i) {
+            float const x = static_cast<float>((i * 53) % 760);
+            float const y = static_cast<float>((i * 97) % 560);
+            addBox(manager, EntityTags::Enemy, Vec2{x, y}, 24);
+        }
+        manager.update();
+
+        for (int tick = 0; tick < 5; ++tick) {
+            world.update(manager);
+            world.resolveContacts([](ContactEvent const &contact) {
+                auto const a =
+                    contact.entityA->getComponent<Components::CTransform>();
+                auto const b =
+                    contact.entityB->getComponent<Components::CTransform>();
+                Vec2 const push =
+                    (a->topLeftCornerPos - b->topLeftCornerPos) * 0.25f;
+                a->topLeftCornerPos += push;
+                if (contact.entityB->tag() != EntityTags::Wall) {
+                    b->topLeftCornerPos -= push;
+                }
+            });
+        }
+        batchCount = world.getContactBatchCount();
+
+        std::vector<Vec2> positions;
+        for (auto const &entity : manager.getEntities()) {
+            positions.push_back(
+                entity->getComponent<Components::CTransform>()
+                    ->topLeftCornerPos);
+        }
+        return positions;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_parallel_resolve_is_deterministic) {
+    Timer      timer("Parallel resolve is deterministic");
+    JobSystem singleThread(1);
+    JobSystem manyThreads(8);
+
+    size_t     serialBatches   = 0;
+    size_t     parallelBatches = 0;
+    auto const serial          = simulateCrowd(nullptr, serialBatches);
+    auto const single          = simulateCrowd(&singleThread, serialBatches);
+    auto const parallel        = simulateCrowd(&manyThreads, parallelBatches);
+
+    BOOST_CHECK_EQUAL(serialBatches, parallelBatches);
+    BOOST_REQUIRE_EQUAL(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        BOOST_REQUIRE(serial[i] == single[i]);
+        BOOST_REQUIRE(serial[i] == parallel[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_contact_batches_are_conflict_free) {
+    Timer          timer("Contact batches are conflict free");
+    EntityManager  manager;
+    CollisionWorld world;
+    world.setBounds(Vec2{800, 600});
+
+    // A chain where every body touches its neighbours, plus a static wall
+    // touched by all of them.
+    auto wall = addBox(manager, EntityTags::Wall, Vec2{0, 100}, 800);
+    wall->getComponent<Components::CShape>()->rect.h = 20;
+    makeStatic(wall);
+    for (int i = 0; i < 20; ++i) {
+        addBox(manager, EntityTags::Enemy,
+               Vec2{static_cast<float>(i * 30), 90}, 40);
+    }
+    manager.update();
+    world.update(manager);
+
+    std::mutex                               mutex;
+    std::map<std::pair<size_t, size_t>, int> resolved;
+    world.resolveContacts([&](ContactEvent const &contact) {
+        std::lock_guard lock(mutex);
+        resolved[{contact.entityA->id(), contact.entityB->id()}]++;
+    });
+
+    size_t expected = 0;
+    for (auto const &event : world.getContactEvents()) {
+        expected += event.type != ContactEventType::End ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(resolved.size(), expected);
+    for (auto const &[key, count] : resolved) {
+        BOOST_CHECK_EQUAL(count, 1);
+    }
+
+    // Wall contacts all share the first colour since the wall is static;
+    // the chain then alternates between two more.
+    BOOST_CHECK_EQUAL(world.getContactBatchCount(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestEntities.hpp"
+#include "Timer.hpp"
+#include <Helpers/MainSceneCollisionHelpers.hpp>
+
+using namespace YerbEngine;
+using namespace ShootDemo::CollisionHelpers::MainScene;
+
+namespace {
+    // The demo's game state, with audio on a null device.
+    struct DemoWorld {
+        EntityManager     entities;
+        CollisionWorld    collisionWorld;
+        std::mt19937      randomGenerator{7};
+        AudioManager      audioManager{AudioInitOptions{.nullDevice = true}};
+        SimClock          clock;
+        AudioSampleBuffer audio{audioManager, clock};
+        EntityList        queryResults;
+        TaskScheduler     tasks;
+        LifespanTracker   lifespans{0};
+        int               score = 0;
+
+        std::function<void(int)> const setScore = [this](int const value) {
+            score = value;
+        };
+
+        // Same order as MainScene::sCollision.
+        void step() {
+            collisionWorld.update(entities);
+            GameState const state = {
+                .entityManager      = entities,
+                .randomGenerator    = randomGenerator,
+                .score              = score,
+                .setScore           = setScore,
+                .decrementLives     = [] {},
+                .audioSampleManager = audio,
+                .windowSize         = Vec2{800, 600},
+                .collisionWorld     = collisionWorld,
+                .queryResults       = queryResults,
+                .tasks              = tasks,
+                .lifespans          = lifespans,
+            };
+            for (ContactEvent const &contact :
+                 collisionWorld.getContactEvents()) {
+                if (contact.type == ContactEventType::End) {
+                    continue;
+                }
+                handleEntityEntityCollision({.entityA = contact.entityA,
+                                             .entityB = contact.entityB,
+                                             .type    = contact.type,
+                                             .swept   = contact.swept},
+                                            state);
+                handleEntityEntityCollision({.entityA = contact.entityB,
+                                             .entityB = contact.entityA,
+                                             .type    = contact.type,
+                                             .swept   = contact.swept},
+                                            state);
+            }
+            entities.update();
+        }
+    };
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(DemoCollisionTests)
+
+BOOST_AUTO_TEST_CASE(test_bullet_kills_enemy_crossing_its_path) {
+    Timer     timer("Bullet kills enemy crossing its path");
+    DemoWorld world;
+    world.collisionWorld.setBounds(Vec2{800, 600});
+
+    auto bullet =
+        addBox(world.entities, EntityTags::Bullet, Vec2{100, 100}, 5);
+    auto enemy =
+        addBox(world.entities, EntityTags::Enemy, Vec2{180, 60}, 20);
+    bullet->setComponent(std::make_shared<Components::CCollider>(
+        Components::BodyType::Dynamic, false, true));
+    bullet->setComponent(std::make_shared<Components::CBounceTracker>());
+    world.entities.update();
+    world.step();
+
+    // The enemy crosses the bullet's path mid-tick, and their boxes do not
+    // overlap at the end of it.
+    bullet->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{200, 0};
+    enemy->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{0, 80};
+    world.step();
+
+    BOOST_CHECK(!enemy->isActive());
+    BOOST_CHECK(!bullet->isActive());
+    BOOST_CHECK_EQUAL(world.score, 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_bullet_passes_player_without_stalling) {
+    Timer     timer("Bullet passes player without stalling");
+    DemoWorld world;
+    world.collisionWorld.setBounds(Vec2{800, 600});
+
+    auto bullet =
+        addBox(world.entities, EntityTags::Bullet, Vec2{100, 100}, 5);
+    addBox(world.entities, EntityTags::Player, Vec2{150, 95}, 20);
+    auto collider = std::make_shared<Components::CCollider>(
+        Components::BodyType::Dynamic, false, true);
+    collider->sweepTags = QueryFilter::withTags({EntityTags::Enemy}).tags;
+    bullet->setComponent(collider);
+    world.entities.update();
+    world.step();
+
+    bullet->getComponent<Components::CTransform>()->topLeftCornerPos +=
+        Vec2{200, 0};
+    world.step();
+
+    BOOST_CHECK(bullet->isActive());
+    BOOST_CHECK_CLOSE(
+        bullet->getComponent<Components::CTransform>()->topLeftCornerPos.x(),
+        300.0f, 0.01f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 #include "Timer.hpp"
 #include <EntityManagement/Entity.hpp>
 #include <EntityManagement/EntityManager.hpp>
+#include <Profiling/Metrics.hpp>
 
 using namespace YerbEngine;
 
@@ -362,4 +363,23 @@ BOOST_AUTO_TEST_CASE(test_entity_components_lifecycle) {
     BOOST_CHECK_EQUAL(manager.getEntities().size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(test_metrics_only_where_set) {
+    Timer           timer("Entity metrics only where set");
+    MetricsRegistry registry;
+    EntityManager   published;
+    EntityManager   quiet;
+
+    published.setMetrics(&registry);
+    published.addEntity(EntityTags::Enemy);
+    published.addEntity(EntityTags::Enemy);
+    published.update();
+    // A second manager, e.g. a prepared scene, leaves the gauges alone.
+    quiet.addEntity(EntityTags::Enemy);
+    quiet.update();
+
+    BOOST_REQUIRE(registry.findGauge("entities.Enemy") != nullptr);
+    BOOST_CHECK_EQUAL(registry.findGauge("entities.Enemy")->get(), 2.0);
+    BOOST_CHECK_EQUAL(registry.findGauge("entities.total")->get(), 2.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/FixedTimestep.hpp>
+
+using namespace YerbEngine;
+
+BOOST_AUTO_TEST_SUITE(FixedTimestepTests)
+
+BOOST_AUTO_TEST_CASE(test_accumulates_partial_frames) {
+    Timer         timer("Accumulates partial frames");
+    FixedTimestep timestep(100, 5);
+
+    BOOST_CHECK_EQUAL(timestep.advance(0.004), 0);
+    BOOST_CHECK_CLOSE(timestep.alpha(), 0.4f, 1e-3f);
+    BOOST_CHECK_EQUAL(timestep.advance(0.007), 1);
+    BOOST_CHECK_CLOSE(timestep.alpha(), 0.1f, 1e-2f);
+    BOOST_CHECK_EQUAL(timestep.advance(0.025), 2);
+    BOOST_CHECK_CLOSE(timestep.alpha(), 0.6f, 1e-2f);
+}
+
+BOOST_AUTO_TEST_CASE(test_total_ticks_match_elapsed_time) {
+    Timer         timer("Total ticks match elapsed time");
+    FixedTimestep timestep(60, 5);
+
+    // Ten seconds of uneven frames at roughly 144 Hz.
+    size_t ticks = 0;
+    for (int frame = 0; frame < 1440; ++frame) {
+        ticks += timestep.advance(frame % 2 == 0 ? 0.006 : 0.0079);
+    }
+    double const elapsed = 720 * 0.006 + 720 * 0.0079;
+    BOOST_CHECK_EQUAL(ticks, static_cast<size_t>(elapsed * 60));
+    BOOST_CHECK_EQUAL(timestep.getDroppedTicks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_long_frame_is_clamped) {
+    Timer         timer("Long frame is clamped");
+    FixedTimestep timestep(60, 4);
+
+    BOOST_CHECK_EQUAL(timestep.advance(1.0), 4);
+    BOOST_CHECK_EQUAL(timestep.getDroppedTicks(), 56);
+    BOOST_CHECK_LT(timestep.alpha(), 1.0f);
+
+    // The backlog is gone, so the next normal frame runs a normal amount.
+    BOOST_CHECK_LE(timestep.advance(1.0 / 60), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_background_frames_keep_up_with_wall_time) {
+    Timer         timer("Background frames keep up with wall time");
+    FixedTimestep throttled(60, 5);
+    FixedTimestep background(60, 5);
+    background.setFrameRate(10);
+    BOOST_CHECK_EQUAL(background.getStepLimit(), 10);
+
+    // Ten seconds of late and early frames from a 10 FPS background loop.
+    double const frames[] = {0.1, 0.11, 0.09, 0.104, 0.096};
+    double       elapsed  = 0.0;
+    size_t       ticks    = 0;
+    for (int frame = 0; frame < 100; ++frame) {
+        double const frameSeconds  = frames[frame % 5];
+        elapsed                   += frameSeconds;
+        ticks                     += background.advance(frameSeconds);
+        throttled.advance(frameSeconds);
+    }
+
+    double const simulated = static_cast<double>(ticks) / 60;
+    BOOST_CHECK_CLOSE(simulated, elapsed, 0.2);
+    BOOST_CHECK_EQUAL(background.getDroppedTicks(), 0);
+    // At one frame per tick's limit, a sixth of the time is dropped.
+    BOOST_CHECK_GT(throttled.getDroppedTicks(), 90);
+
+    background.setFrameRate(0);
+    BOOST_CHECK_EQUAL(background.getStepLimit(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_reset_and_invalid_input) {
+    Timer         timer("Reset and invalid input");
+    FixedTimestep timestep(0, 0); // falls back to defaults
+
+    BOOST_CHECK_CLOSE(timestep.getTickSeconds(), 1.0 / 60, 1e-6);
+    BOOST_CHECK_EQUAL(timestep.advance(-1.0), 0);
+    timestep.advance(0.01);
+    timestep.reset();
+    BOOST_CHECK_EQUAL(timestep.alpha(), 0.0f);
+    BOOST_CHECK_EQUAL(timestep.advance(0.05), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
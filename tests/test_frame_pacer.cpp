@@ -0,0 +1,71 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/FramePacer.hpp>
+
+#include <chrono>
+#include <thread>
+
+using namespace YerbEngine;
+
+namespace {
+    double elapsedMs(FramePacer::Clock::time_point const start) {
+        return std::chrono::duration<double, std::milli>(
+                   FramePacer::Clock::now() - start)
+            .count();
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FramePacerTests)
+
+BOOST_AUTO_TEST_CASE(test_limits_to_target_rate) {
+    Timer      timer("Limits to target rate");
+    FramePacer pacer;
+    pacer.setTargetFrameRate(200, true);
+
+    auto const start = FramePacer::Clock::now();
+    for (int frame = 0; frame <= 20; ++frame) {
+        pacer.endFrame();
+    }
+
+    // The first call only starts the schedule; 20 periods of 5 ms follow.
+    BOOST_CHECK_GE(elapsedMs(start), 99.0);
+    BOOST_CHECK_EQUAL(pacer.getStats().frames, 20);
+    BOOST_CHECK_GE(pacer.getStats().lastFrameMs, 4.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_unlimited_does_not_wait) {
+    Timer      timer("Unlimited does not wait");
+    FramePacer pacer;
+    pacer.setTargetFrameRate(0, true);
+    BOOST_CHECK(!pacer.isLimiting());
+
+    auto const start = FramePacer::Clock::now();
+    for (int frame = 0; frame < 1000; ++frame) {
+        pacer.endFrame();
+    }
+    BOOST_CHECK_LT(elapsedMs(start), 50.0);
+    BOOST_CHECK_EQUAL(pacer.getStats().frames, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_measure_only_reports_late_frames) {
+    Timer      timer("Measure only reports late frames");
+    FramePacer pacer;
+    pacer.setTargetFrameRate(1000, false);
+    BOOST_CHECK(!pacer.isLimiting());
+
+    pacer.endFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    pacer.endFrame();
+
+    FramePacingStats const &stats = pacer.getStats();
+    BOOST_CHECK_EQUAL(stats.frames, 1);
+    BOOST_CHECK_EQUAL(stats.missedDeadlines, 1);
+    BOOST_CHECK_GE(stats.lastErrorMs, 3.9);
+    BOOST_CHECK_GE(stats.maxErrorMs, stats.lastErrorMs);
+
+    pacer.resetStats();
+    BOOST_CHECK_EQUAL(pacer.getStats().frames, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/InputLatency.hpp>
+
+#include <chrono>
+
+using namespace YerbEngine;
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(InputLatencyTests)
+
+BOOST_AUTO_TEST_CASE(test_measures_from_oldest_input) {
+    Timer               timer("Measures from oldest input");
+    InputLatencyTracker tracker;
+    auto const          start = InputLatencyTracker::Clock::now();
+
+    tracker.noteInput(start + 5ms);
+    tracker.noteInput(start);
+    tracker.noteInput(start + 10ms);
+    BOOST_CHECK(tracker.hasPendingInput());
+
+    tracker.notePresent(start + 20ms);
+    BOOST_CHECK(!tracker.hasPendingInput());
+    BOOST_CHECK_EQUAL(tracker.getStats().frames, 1);
+    BOOST_CHECK_CLOSE(tracker.getStats().lastMs, 20.0, 0.01);
+}
+
+BOOST_AUTO_TEST_CASE(test_present_without_input_is_not_a_sample) {
+    Timer               timer("Present without input is not a sample");
+    InputLatencyTracker tracker;
+    auto const          start = InputLatencyTracker::Clock::now();
+
+    tracker.notePresent(start);
+    BOOST_CHECK_EQUAL(tracker.getStats().frames, 0);
+    BOOST_CHECK_EQUAL(tracker.getStats().p99Ms, 0.0);
+
+    tracker.noteInput(start);
+    tracker.notePresent(start + 3ms);
+    tracker.notePresent(start + 50ms);
+    BOOST_CHECK_EQUAL(tracker.getStats().frames, 1);
+    BOOST_CHECK_CLOSE(tracker.getStats().maxMs, 3.0, 0.01);
+}
+
+BOOST_AUTO_TEST_CASE(test_percentiles) {
+    Timer               timer("Percentiles");
+    InputLatencyTracker tracker;
+    auto const          start = InputLatencyTracker::Clock::now();
+
+    // 1..100 ms, presented out of order.
+    for (int ms = 100; ms >= 1; --ms) {
+        tracker.noteInput(start);
+        tracker.notePresent(start + std::chrono::milliseconds(ms));
+    }
+
+    InputLatencyStats const stats = tracker.getStats();
+    BOOST_CHECK_EQUAL(stats.frames, 100);
+    BOOST_CHECK_CLOSE(stats.p50Ms, 50.0, 0.01);
+    BOOST_CHECK_CLOSE(stats.p95Ms, 95.0, 0.01);
+    BOOST_CHECK_CLOSE(stats.p99Ms, 99.0, 0.01);
+    BOOST_CHECK_CLOSE(stats.maxMs, 100.0, 0.01);
+
+    tracker.resetStats();
+    BOOST_CHECK_EQUAL(tracker.getStats().frames, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_window_keeps_recent_frames) {
+    Timer               timer("Window keeps recent frames");
+    InputLatencyTracker tracker;
+    auto const          start = InputLatencyTracker::Clock::now();
+
+    // A slow start, then a full window of fast frames.
+    for (size_t frame = 0; frame < InputLatencyTracker::WINDOW; ++frame) {
+        tracker.noteInput(start);
+        tracker.notePresent(start + 40ms);
+    }
+    for (size_t frame = 0; frame < InputLatencyTracker::WINDOW; ++frame) {
+        tracker.noteInput(start);
+        tracker.notePresent(start + 4ms);
+    }
+
+    InputLatencyStats const stats = tracker.getStats();
+    BOOST_CHECK_EQUAL(stats.frames, 2 * InputLatencyTracker::WINDOW);
+    BOOST_CHECK_CLOSE(stats.p99Ms, 4.0, 0.01);
+    BOOST_CHECK_CLOSE(stats.maxMs, 40.0, 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
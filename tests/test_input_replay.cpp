@@ -0,0 +1,141 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <Configuration/ConfigDictionary.hpp>
+#include <GameEngine/InputReplay.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    std::filesystem::path tempReplayPath(char const *name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(InputReplayTests)
+
+BOOST_AUTO_TEST_CASE(test_frames_round_trip) {
+    Timer               timer("Frames round trip");
+    auto const          path = tempReplayPath("yerb_round_trip.replay");
+    InputRecorder       recorder;
+    ReplayHeader const  header{.seed         = 0xDEADBEEFCAFEF00Dull,
+                               .configHashes = {{"engine", 1}, {"demo", 2}}};
+
+    ActionId const forward = ActionNames::intern("FORWARD");
+    ActionId const shoot   = ActionNames::intern("SHOOT");
+
+    recorder.recordAction(Action(forward, ActionState::START, std::nullopt));
+    recorder.recordAction(Action(shoot, ActionState::START, Vec2{12.5f, -3}));
+    recorder.endFrame(1);
+    recorder.endFrame(0);
+    recorder.endFrame(300); // longer than one varint byte
+    recorder.recordAction(Action(forward, ActionState::END, std::nullopt));
+    recorder.endFrame(2);
+    recorder.save(path, header);
+    BOOST_CHECK_EQUAL(recorder.getFrameCount(), 4);
+
+    InputReplay replay(path);
+    BOOST_CHECK_EQUAL(replay.getHeader().seed, header.seed);
+    BOOST_CHECK((replay.getHeader().configHashes == header.configHashes));
+
+    size_t              ticks = 0;
+    std::vector<Action> actions;
+
+    BOOST_REQUIRE(replay.nextFrame(ticks, actions));
+    BOOST_CHECK_EQUAL(ticks, 1);
+    BOOST_REQUIRE_EQUAL(actions.size(), 2);
+    BOOST_CHECK_EQUAL(actions[0].getName(), "FORWARD");
+    BOOST_CHECK(!actions[0].getPos().has_value());
+    BOOST_CHECK_EQUAL(actions[1].getName(), "SHOOT");
+    BOOST_REQUIRE(actions[1].getPos().has_value());
+    BOOST_CHECK_EQUAL(actions[1].getPos()->x(), 12.5f);
+    BOOST_CHECK_EQUAL(actions[1].getPos()->y(), -3.0f);
+
+    BOOST_REQUIRE(replay.nextFrame(ticks, actions));
+    BOOST_CHECK_EQUAL(ticks, 0);
+    BOOST_CHECK(actions.empty());
+    BOOST_REQUIRE(replay.nextFrame(ticks, actions));
+    BOOST_CHECK_EQUAL(ticks, 300);
+
+    // Names seen before are stored by index.
+    BOOST_REQUIRE(replay.nextFrame(ticks, actions));
+    BOOST_CHECK_EQUAL(ticks, 2);
+    BOOST_REQUIRE_EQUAL(actions.size(), 1);
+    BOOST_CHECK_EQUAL(actions[0].getName(), "FORWARD");
+    BOOST_CHECK(actions[0].getState() == ActionState::END);
+
+    BOOST_CHECK(!replay.nextFrame(ticks, actions));
+    BOOST_CHECK(replay.isFinished());
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_idle_frames_are_one_byte) {
+    Timer         timer("Idle frames are one byte");
+    auto const    path = tempReplayPath("yerb_idle.replay");
+    InputRecorder recorder;
+
+    // An hour of idle play at 60 Hz.
+    for (int frame = 0; frame < 60 * 60 * 60; ++frame) {
+        recorder.endFrame(1);
+    }
+    recorder.save(path, ReplayHeader{});
+
+    BOOST_CHECK_LT(std::filesystem::file_size(path), 60 * 60 * 60 + 32);
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_bad_files_are_rejected) {
+    Timer      timer("Bad files are rejected");
+    auto const path = tempReplayPath("yerb_bad.replay");
+
+    BOOST_CHECK_THROW(InputReplay(tempReplayPath("yerb_missing.replay")),
+                      std::runtime_error);
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a replay";
+    }
+    BOOST_CHECK_THROW(InputReplay{path}, std::runtime_error);
+
+    // A valid header followed by a frame cut short.
+    InputRecorder recorder;
+    recorder.recordAction(
+        Action(ActionNames::intern("SHOOT"), ActionState::START, Vec2{1, 2}));
+    recorder.endFrame(1);
+    recorder.save(path, ReplayHeader{});
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+
+    InputReplay         replay(path);
+    size_t              ticks = 0;
+    std::vector<Action> actions;
+    BOOST_CHECK_THROW(replay.nextFrame(ticks, actions), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_config_hash_ignores_insertion_order) {
+    Timer            timer("Config hash ignores insertion order");
+    ConfigDictionary first;
+    ConfigDictionary second;
+
+    first.set<int>("engine.simulation.tickRate", 60);
+    first.set<std::string>("engine.window.title", "YerbEngine");
+    first.set<float>("engine.simulation.timeScale", 1.0f);
+    second.set<float>("engine.simulation.timeScale", 1.0f);
+    second.set<std::string>("engine.window.title", "YerbEngine");
+    second.set<int>("engine.simulation.tickRate", 60);
+    BOOST_CHECK_EQUAL(first.hash(), second.hash());
+
+    second.set<int>("engine.simulation.tickRate", 120);
+    BOOST_CHECK_NE(first.hash(), second.hash());
+
+    // Same value, different type.
+    second.set<float>("engine.simulation.tickRate", 60.0f);
+    BOOST_CHECK_NE(first.hash(), second.hash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,198 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <EntityManagement/Components.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    // Integrates every transform a few sub-steps, bouncing off a 800x600
+    // box, so each index costs enough for threads to matter.
+    void moveTransforms(std::vector<Components::CTransform> &transforms,
+                        JobSystem                           &jobs) {
+        constexpr int   SUB_STEPS = 16;
+        constexpr float STEP      = 1.0f / 60.0f / SUB_STEPS;
+
+        jobs.parallelFor(transforms.size(), [&](size_t const index) {
+            Components::CTransform &transform = transforms[index];
+            transform.storePreviousPosition();
+            for (int step = 0; step < SUB_STEPS; ++step) {
+                Vec2 position = transform.topLeftCornerPos +
+                                transform.velocity * STEP;
+                Vec2 velocity = transform.velocity;
+                if (position.x() < 0 || position.x() > 800) {
+                    velocity = Vec2{-velocity.x(), velocity.y()};
+                }
+                if (position.y() < 0 || position.y() > 600) {
+                    velocity = Vec2{velocity.x(), -velocity.y()};
+                }
+                transform.topLeftCornerPos = position;
+                transform.velocity         = velocity;
+            }
+        });
+    }
+
+    std::vector<Components::CTransform> makeTransforms(size_t const count) {
+        std::vector<Components::CTransform> transforms;
+        transforms.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            transforms.emplace_back(
+                Vec2{static_cast<float>(i % 800), static_cast<float>(i % 600)},
+                Vec2{static_cast<float>(i % 13) * 40 - 240,
+                     static_cast<float>(i % 7) * 60 - 180});
+        }
+        return transforms;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(JobSystemTests)
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_runs_every_index_once) {
+    Timer     timer("Parallel for runs every index once");
+    JobSystem jobs(4);
+    BOOST_CHECK_EQUAL(jobs.getThreadCount(), 4);
+
+    std::vector<std::atomic<int>> hits(10000);
+    jobs.parallelFor(hits.size(), [&](size_t const index) { hits[index]++; });
+
+    for (auto const &hit : hits) {
+        BOOST_REQUIRE_EQUAL(hit.load(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_reuses_threads) {
+    Timer     timer("Parallel for reuses threads");
+    JobSystem jobs(3);
+
+    std::vector<size_t> results(256, 0);
+    for (int round = 0; round < 200; ++round) {
+        jobs.parallelFor(results.size(),
+                         [&](size_t const index) { results[index] += index; });
+    }
+
+    for (size_t index = 0; index < results.size(); ++index) {
+        BOOST_REQUIRE_EQUAL(results[index], index * 200);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_single_thread_runs_inline) {
+    Timer     timer("Single thread runs inline");
+    JobSystem jobs(1);
+    BOOST_CHECK_EQUAL(jobs.getThreadCount(), 1);
+
+    std::vector<size_t> order;
+    jobs.parallelFor(5, [&](size_t const index) { order.push_back(index); });
+
+    std::vector<size_t> expected(5);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(),
+                                  expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_first_index_runs_on_caller) {
+    Timer     timer("First index runs on caller");
+    JobSystem jobs(4);
+
+    for (int round = 0; round < 50; ++round) {
+        std::thread::id firstThread;
+        jobs.parallelFor(64, [&](size_t const index) {
+            if (index == 0) {
+                firstThread = std::this_thread::get_id();
+            }
+        });
+        BOOST_REQUIRE(firstThread == std::this_thread::get_id());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_counter_orders_dependent_jobs) {
+    Timer     timer("Counter orders dependent jobs");
+    JobSystem jobs(4);
+
+    // Stage two may only start once every stage-one job has finished.
+    std::vector<int> values(100, 0);
+    JobCounter       stageOne;
+    for (size_t i = 0; i < values.size(); ++i) {
+        jobs.submit([&values, i] { values[i] = static_cast<int>(i); },
+                    stageOne);
+    }
+
+    JobCounter       stageTwo;
+    std::atomic<int> sum{0};
+    jobs.submit(
+        [&] {
+            jobs.wait(stageOne);
+            sum = std::accumulate(values.begin(), values.end(), 0);
+        },
+        stageTwo);
+
+    jobs.wait(stageTwo);
+    BOOST_CHECK(stageOne.isDone());
+    BOOST_CHECK_EQUAL(sum.load(), 4950);
+}
+
+BOOST_AUTO_TEST_CASE(test_nested_parallel_for) {
+    Timer     timer("Nested parallel for");
+    JobSystem jobs(4);
+
+    std::vector<std::atomic<int>> hits(64 * 64);
+    jobs.parallelFor(64, [&](size_t const outer) {
+        jobs.parallelFor(64, [&](size_t const inner) {
+            hits[outer * 64 + inner]++;
+        });
+    });
+
+    for (auto const &hit : hits) {
+        BOOST_REQUIRE_EQUAL(hit.load(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_submit_from_foreign_thread) {
+    Timer     timer("Submit from foreign thread");
+    JobSystem jobs(3);
+
+    std::atomic<int> ran{0};
+    std::thread      loader([&] {
+        JobCounter counter;
+        for (int i = 0; i < 32; ++i) {
+            jobs.submit([&] { ran++; }, counter);
+        }
+        jobs.wait(counter);
+    });
+    loader.join();
+
+    BOOST_CHECK_EQUAL(ran.load(), 32);
+}
+
+BOOST_AUTO_TEST_CASE(test_movement_pass_matches_across_thread_counts) {
+    // Timing and speedup live in benchmarks/bench_movement_pass.cpp; this
+    // only checks that splitting the pass does not change its results.
+    Timer            timer("Movement pass matches across threads");
+    constexpr size_t TRANSFORM_COUNT = 20000;
+    constexpr int    PASSES          = 2;
+
+    std::vector<Components::CTransform> reference;
+    for (size_t const threads : {1, 4}) {
+        auto      transforms = makeTransforms(TRANSFORM_COUNT);
+        JobSystem jobs(threads);
+        for (int pass = 0; pass < PASSES; ++pass) {
+            moveTransforms(transforms, jobs);
+        }
+
+        if (reference.empty()) {
+            reference = std::move(transforms);
+            continue;
+        }
+        for (size_t i = 0; i < TRANSFORM_COUNT; ++i) {
+            BOOST_REQUIRE(transforms[i].topLeftCornerPos ==
+                          reference[i].topLeftCornerPos);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,211 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <Profiling/Metrics.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    std::filesystem::path tempMetricsPath(char const *name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    MetricValue const &findValue(MetricsWindow const &window,
+                                 std::string const   &name) {
+        for (MetricValue const &metric : window.metrics) {
+            if (metric.name == name) {
+                return metric;
+            }
+        }
+        throw std::runtime_error("Missing metric: " + name);
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MetricsTests)
+
+BOOST_AUTO_TEST_CASE(test_counter_across_threads) {
+    Timer           timer("Counter across threads");
+    MetricsRegistry registry;
+    Counter        &counter = registry.counter("hits");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 10000; ++i) {
+                counter.add();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    counter.add(5);
+    BOOST_CHECK_EQUAL(counter.get(), 40005);
+}
+
+BOOST_AUTO_TEST_CASE(test_buckets) {
+    Timer timer("Buckets");
+    // Small values are exact.
+    for (uint64_t value = 0; value < 2 * Histogram::SUB_BUCKETS; ++value) {
+        BOOST_CHECK_EQUAL(Histogram::bucketOf(value), value);
+        BOOST_CHECK_EQUAL(Histogram::bucketHighest(value), value);
+    }
+    // Larger values land in a bucket whose range holds them, within the
+    // promised relative precision.
+    for (uint64_t value = 100; value < Histogram::MAX_VALUE;
+         value = value * 3 + 7) {
+        size_t const   bucket  = Histogram::bucketOf(value);
+        uint64_t const highest = Histogram::bucketHighest(bucket);
+        BOOST_CHECK_LT(bucket, Histogram::BUCKETS);
+        BOOST_CHECK_GE(highest, value);
+        BOOST_CHECK_LE(static_cast<double>(highest - value),
+                       static_cast<double>(value) / Histogram::SUB_BUCKETS);
+        if (bucket > 0) {
+            BOOST_CHECK_LT(Histogram::bucketHighest(bucket - 1), value);
+        }
+    }
+    BOOST_CHECK_EQUAL(Histogram::bucketOf(~uint64_t{0}),
+                      Histogram::BUCKETS - 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_histogram_percentiles) {
+    Timer     timer("Histogram percentiles");
+    Histogram histogram("us");
+    for (uint64_t value = 1; value <= 10000; ++value) {
+        histogram.record(value);
+    }
+
+    HistogramStats const stats = histogram.getStats();
+    BOOST_CHECK_EQUAL(stats.count, 10000);
+    BOOST_CHECK_CLOSE(stats.mean, 5000.5, 0.001);
+    BOOST_CHECK_CLOSE(stats.p50, 5000.0, 100.0 / Histogram::SUB_BUCKETS);
+    BOOST_CHECK_CLOSE(stats.p95, 9500.0, 100.0 / Histogram::SUB_BUCKETS);
+    BOOST_CHECK_CLOSE(stats.p99, 9900.0, 100.0 / Histogram::SUB_BUCKETS);
+    BOOST_CHECK_EQUAL(stats.max, 10000.0);
+
+    // A window resets the histogram.
+    HistogramStats const window = histogram.takeWindow();
+    BOOST_CHECK_EQUAL(window.count, 10000);
+    BOOST_CHECK_EQUAL(histogram.getStats().count, 0);
+
+    histogram.recordDuration(std::chrono::milliseconds(3));
+    BOOST_CHECK_EQUAL(histogram.getStats().max, 3000.0);
+    // Percentiles never report more than the largest value seen.
+    BOOST_CHECK_EQUAL(histogram.getStats().p99, 3000.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_registry) {
+    Timer           timer("Registry");
+    MetricsRegistry registry;
+
+    Counter &counter = registry.counter("draws");
+    BOOST_CHECK(&registry.counter("draws") == &counter);
+    BOOST_CHECK(registry.findCounter("draws") == &counter);
+    BOOST_CHECK(registry.findCounter("missing") == nullptr);
+    BOOST_CHECK(registry.findGauge("draws") == nullptr);
+    BOOST_CHECK_THROW(registry.gauge("draws"), std::runtime_error);
+    BOOST_CHECK_THROW(registry.histogram("draws"), std::runtime_error);
+
+    Gauge &gauge = registry.gauge("entities");
+    gauge.set(12);
+    gauge.add(-2);
+    BOOST_CHECK_EQUAL(registry.findGauge("entities")->get(), 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_windows) {
+    Timer           timer("Windows");
+    MetricsRegistry registry;
+    Counter        &counter   = registry.counter("b.count");
+    Histogram      &histogram = registry.histogram("a.time", "us");
+    registry.gauge("c.level").set(2);
+
+    counter.add(3);
+    histogram.record(10);
+    MetricsWindow const first = registry.closeWindow();
+    BOOST_CHECK_EQUAL(first.index, 0);
+    BOOST_REQUIRE_EQUAL(first.metrics.size(), 3);
+    // Sorted by name, whatever the kind.
+    BOOST_CHECK_EQUAL(first.metrics[0].name, "a.time");
+    BOOST_CHECK_EQUAL(first.metrics[2].name, "c.level");
+    BOOST_CHECK_EQUAL(findValue(first, "b.count").delta, 3.0);
+    BOOST_CHECK_EQUAL(findValue(first, "a.time").stats.count, 1);
+    BOOST_CHECK_EQUAL(findValue(first, "a.time").unit, "us");
+    BOOST_CHECK_EQUAL(findValue(first, "c.level").value, 2.0);
+
+    counter.add(2);
+    MetricsWindow const second = registry.closeWindow();
+    BOOST_CHECK_EQUAL(second.index, 1);
+    BOOST_CHECK_EQUAL(second.startSeconds, first.endSeconds);
+    BOOST_CHECK_EQUAL(findValue(second, "b.count").value, 5.0);
+    BOOST_CHECK_EQUAL(findValue(second, "b.count").delta, 2.0);
+    BOOST_CHECK_EQUAL(findValue(second, "a.time").stats.count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_json_file) {
+    Timer           timer("JSON file");
+    auto            path = tempMetricsPath("yerb_metrics.json");
+    MetricsRegistry registry;
+    registry.counter("frames").add(2);
+    registry.histogram("frame.time", "us").record(16000);
+
+    {
+        MetricsFile file(path);
+        file.write(registry.closeWindow());
+        registry.counter("frames").add(1);
+        file.write(registry.closeWindow());
+    }
+
+    std::ifstream        input(path);
+    nlohmann::json const json = nlohmann::json::parse(input);
+    input.close();
+    std::filesystem::remove(path);
+
+    auto const &windows = json.at("windows");
+    BOOST_REQUIRE_EQUAL(windows.size(), 2);
+    auto const &frames = windows[1].at("metrics").at("frames");
+    BOOST_CHECK_EQUAL(frames.at("total").get<double>(), 3.0);
+    BOOST_CHECK_EQUAL(frames.at("delta").get<double>(), 1.0);
+    auto const &frameTime = windows[0].at("metrics").at("frame.time");
+    BOOST_CHECK_EQUAL(frameTime.at("max").get<double>(), 16000.0);
+    BOOST_CHECK_EQUAL(frameTime.at("unit").get<std::string>(), "us");
+}
+
+BOOST_AUTO_TEST_CASE(test_csv_file) {
+    Timer           timer("CSV file");
+    auto            path = tempMetricsPath("yerb_metrics.csv");
+    MetricsRegistry registry;
+    registry.counter("frames").add(2);
+    registry.gauge("entities").set(7);
+
+    {
+        MetricsFile file(path);
+        file.write(registry.closeWindow());
+    }
+
+    std::ifstream            input(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(input, line);) {
+        lines.push_back(line);
+    }
+    input.close();
+    std::filesystem::remove(path);
+
+    BOOST_REQUIRE_EQUAL(lines.size(), 3);
+    BOOST_CHECK(lines[0].starts_with("window,start_s,end_s,name,kind"));
+    BOOST_CHECK_NE(lines[1].find(",entities,gauge,,7,"), std::string::npos);
+    BOOST_CHECK_NE(lines[2].find(",frames,counter,,2,2,"), std::string::npos);
+
+    BOOST_CHECK_THROW(MetricsFile(tempMetricsPath("missing/dir/m.csv")),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/PerformanceGovernor.hpp>
+
+using namespace YerbEngine;
+
+namespace {
+    GovernorSettings testSettings() {
+        return {.budgetMs     = 10.0,
+                .windowFrames = 10,
+                .degradeAbove = 1.1,
+                .recoverBelow = 0.7,
+                .holdFrames   = 20,
+                .maxLevel     = 2};
+    }
+
+    // Records `frames` frames of `frameMs`, returning the transitions.
+    std::vector<GovernorTransition> run(PerformanceGovernor &governor,
+                                        size_t const         frames,
+                                        double const         frameMs) {
+        std::vector<GovernorTransition> transitions;
+        for (size_t frame = 0; frame < frames; ++frame) {
+            if (auto const transition = governor.recordFrame(frameMs)) {
+                transitions.push_back(*transition);
+            }
+        }
+        return transitions;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PerformanceGovernorTests)
+
+BOOST_AUTO_TEST_CASE(test_disabled_without_budget_or_levels) {
+    Timer               timer("Disabled without budget or levels");
+    PerformanceGovernor unconfigured;
+    BOOST_CHECK(!unconfigured.isEnabled());
+    BOOST_CHECK(run(unconfigured, 100, 50.0).empty());
+
+    GovernorSettings settings = testSettings();
+    settings.maxLevel         = 0;
+    PerformanceGovernor noLevels(settings);
+    BOOST_CHECK(!noLevels.isEnabled());
+    BOOST_CHECK(run(noLevels, 100, 50.0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_steps_down_under_load) {
+    Timer               timer("Steps down under load");
+    PerformanceGovernor governor(testSettings());
+
+    // Waits for the hold, not just a full window.
+    BOOST_CHECK(run(governor, 19, 15.0).empty());
+    auto const first = run(governor, 1, 15.0);
+    BOOST_REQUIRE_EQUAL(first.size(), 1);
+    BOOST_CHECK_EQUAL(first[0].from, 0);
+    BOOST_CHECK_EQUAL(first[0].to, 1);
+    BOOST_CHECK_CLOSE(first[0].meanMs, 15.0, 0.01);
+    BOOST_CHECK_CLOSE(first[0].budgetMs, 10.0, 0.01);
+    BOOST_CHECK_EQUAL(first[0].frames, 20);
+
+    // One level per hold, never past the deepest.
+    BOOST_CHECK_EQUAL(run(governor, 100, 15.0).size(), 1);
+    BOOST_CHECK_EQUAL(governor.getLevel(), 2);
+    BOOST_CHECK_EQUAL(governor.getTransitionCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_holds_between_thresholds) {
+    Timer               timer("Holds between thresholds");
+    PerformanceGovernor governor(testSettings());
+
+    run(governor, 20, 15.0);
+    BOOST_CHECK_EQUAL(governor.getLevel(), 1);
+
+    // Under budget but above the recovery threshold: stays put.
+    BOOST_CHECK(run(governor, 200, 9.0).empty());
+    BOOST_CHECK_EQUAL(governor.getLevel(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_recovers_with_headroom) {
+    Timer               timer("Recovers with headroom");
+    PerformanceGovernor governor(testSettings());
+
+    run(governor, 40, 15.0);
+    BOOST_CHECK_EQUAL(governor.getLevel(), 2);
+
+    auto const transitions = run(governor, 40, 3.0);
+    BOOST_REQUIRE_EQUAL(transitions.size(), 2);
+    BOOST_CHECK_EQUAL(transitions[0].to, 1);
+    BOOST_CHECK_EQUAL(transitions[1].to, 0);
+    BOOST_CHECK(run(governor, 100, 3.0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_window_restarts_after_transition) {
+    Timer               timer("Window restarts after transition");
+    GovernorSettings    settings = testSettings();
+    settings.holdFrames          = 0;
+    PerformanceGovernor governor(settings);
+
+    run(governor, 10, 15.0);
+    BOOST_CHECK_EQUAL(governor.getLevel(), 1);
+
+    // Slow frames from before the transition do not count against the
+    // new level: nine fast frames are not a full window yet.
+    BOOST_CHECK(run(governor, 9, 3.0).empty());
+    BOOST_CHECK_EQUAL(run(governor, 1, 3.0).size(), 1);
+    BOOST_CHECK_EQUAL(governor.getLevel(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,200 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <Profiling/Profiler.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace YerbEngine;
+
+namespace {
+    std::filesystem::path tempTracePath(char const *name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    nlohmann::json readTrace(std::filesystem::path const &path) {
+        std::ifstream file(path);
+        return nlohmann::json::parse(file);
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ProfilerTests)
+
+BOOST_AUTO_TEST_CASE(test_zones_outside_capture) {
+    Timer timer("Zones outside capture");
+    Profiler::startCapture();
+    Profiler::stopCapture();
+    {
+        YERB_ZONE("ignored");
+    }
+    BOOST_CHECK(!Profiler::isCapturing());
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_chrome_trace) {
+    Timer timer("Chrome trace");
+    auto  path = tempTracePath("yerb_profiler.json");
+
+    Profiler::setThreadName("Main \"test\"");
+    Profiler::startCapture();
+    {
+        YERB_ZONE("outer");
+        {
+            YERB_ZONE("inner");
+        }
+        std::thread worker([] {
+            Profiler::setThreadName("Worker");
+            for (int i = 0; i < 3; ++i) {
+                YERB_ZONE("work");
+            }
+        });
+        worker.join();
+    }
+    Profiler::stopCapture();
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 5);
+    BOOST_CHECK_EQUAL(Profiler::getDroppedCount(), 0);
+
+    Profiler::writeChromeTrace(path);
+    nlohmann::json const trace = readTrace(path);
+    std::filesystem::remove(path);
+
+    std::map<std::string, int>            zones;
+    std::map<int, std::string>            threads;
+    std::map<std::string, nlohmann::json> byName;
+    for (auto const &event : trace.at("traceEvents")) {
+        if (event.at("ph") == "M") {
+            threads[event.at("tid").get<int>()] =
+                event.at("args").at("name").get<std::string>();
+            continue;
+        }
+        BOOST_CHECK(event.at("ph") == "X");
+        BOOST_CHECK_GE(event.at("dur").get<double>(), 0.0);
+        auto const name = event.at("name").get<std::string>();
+        zones[name] += 1;
+        byName[name] = event;
+    }
+
+    BOOST_CHECK_EQUAL(zones["outer"], 1);
+    BOOST_CHECK_EQUAL(zones["inner"], 1);
+    BOOST_CHECK_EQUAL(zones["work"], 3);
+    BOOST_CHECK_EQUAL(zones.count("ignored"), 0);
+
+    // The worker has its own track, and names survive escaping.
+    auto const mainTid   = byName["outer"].at("tid").get<int>();
+    auto const workerTid = byName["work"].at("tid").get<int>();
+    BOOST_CHECK_NE(mainTid, workerTid);
+    BOOST_CHECK_EQUAL(threads[mainTid], "Main \"test\"");
+    BOOST_CHECK_EQUAL(threads[workerTid], "Worker");
+
+    // Nested zones nest in time.
+    double const outerStart = byName["outer"].at("ts").get<double>();
+    double const innerStart = byName["inner"].at("ts").get<double>();
+    BOOST_CHECK_LE(outerStart, innerStart);
+    BOOST_CHECK_LE(innerStart + byName["inner"].at("dur").get<double>(),
+                   outerStart + byName["outer"].at("dur").get<double>() +
+                       0.001);
+}
+
+BOOST_AUTO_TEST_CASE(test_full_buffer_drops) {
+    Timer timer("Full buffer drops");
+    Profiler::startCapture();
+    for (size_t i = 0; i < Profiler::EVENTS_PER_THREAD + 10; ++i) {
+        YERB_ZONE("tick");
+    }
+    Profiler::stopCapture();
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(),
+                      Profiler::EVENTS_PER_THREAD);
+    BOOST_CHECK_EQUAL(Profiler::getDroppedCount(), 10);
+
+    // A new capture starts empty.
+    Profiler::startCapture();
+    Profiler::stopCapture();
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 0);
+    BOOST_CHECK_EQUAL(Profiler::getDroppedCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_restart_clears_live_threads) {
+    Timer            timer("Restart clears live threads");
+    std::atomic<int> stage{0};
+    auto const       waitFor = [&](int const value) {
+        while (stage.load() != value) {
+            std::this_thread::yield();
+        }
+    };
+
+    Profiler::startCapture();
+    std::thread worker([&] {
+        for (int i = 0; i < 3; ++i) {
+            YERB_ZONE("before");
+        }
+        stage = 1;
+        waitFor(2);
+        for (int i = 0; i < 2; ++i) {
+            YERB_ZONE("after");
+        }
+    });
+    waitFor(1);
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 3);
+
+    // The worker is still alive, so its buffer is cleared by its own zones.
+    Profiler::startCapture();
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 0);
+    stage = 2;
+    worker.join();
+    Profiler::stopCapture();
+    BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_exited_threads_buffers_are_reused) {
+    Timer      timer("Exited threads' buffers are reused");
+    auto const path        = tempTracePath("yerb_profiler_reuse.json");
+    auto const threadCount = [&] {
+        Profiler::writeChromeTrace(path);
+        nlohmann::json const trace  = readTrace(path);
+        size_t               tracks = 0;
+        for (auto const &event : trace.at("traceEvents")) {
+            tracks += event.at("ph") == "M" ? 1 : 0;
+        }
+        std::filesystem::remove(path);
+        return tracks;
+    };
+
+    size_t const before = threadCount();
+    for (int round = 0; round < 8; ++round) {
+        Profiler::startCapture();
+        std::thread([] { YERB_ZONE("short-lived"); }).join();
+        Profiler::stopCapture();
+        BOOST_CHECK_EQUAL(Profiler::getRecordedCount(), 1);
+    }
+    // At most the first round's thread needed a new buffer.
+    BOOST_CHECK_LE(threadCount(), before + 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_intern) {
+    Timer timer("Intern");
+    std::string name = "System ";
+    name += "movement";
+
+    char const *first = Profiler::intern(name);
+    name.assign("overwritten");
+    BOOST_CHECK_EQUAL(std::string(first), "System movement");
+    // Same pointer, not just the same text.
+    BOOST_CHECK(Profiler::intern("System movement") == first);
+    BOOST_CHECK(Profiler::intern("System render") != first);
+}
+
+BOOST_AUTO_TEST_CASE(test_write_failure) {
+    Timer timer("Write failure");
+    BOOST_CHECK_THROW(
+        Profiler::writeChromeTrace(tempTracePath("missing/dir/trace.json")),
+        std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameScenes/SceneBatch.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    // Counts ticks, adding its control to a running total each tick, and
+    // ends itself once the total passes a limit.
+    class CounterScene final : public Scene {
+        uint64_t m_seed;
+        float    m_speed = 0;
+        float    m_total = 0;
+        int      m_ticks = 0;
+
+      public:
+        static constexpr float LIMIT = 10;
+
+        explicit CounterScene(uint64_t const seed)
+            : Scene(nullptr),
+              m_seed(seed) {}
+
+        void update() override {}
+        void onEnd() override {}
+        void sRender() override {}
+        void sDoAction(Action &) override {}
+        void sAudio() override {}
+        void onSceneWindowResize() override {}
+
+        void fixedUpdate(float const tickSeconds) override {
+            Scene::fixedUpdate(tickSeconds);
+            m_ticks += 1;
+            m_total += m_speed;
+            if (m_total > LIMIT) {
+                m_endTriggered = true;
+            }
+        }
+
+        size_t getObservationSize() const override { return 3; }
+        void   observe(std::span<float> const out) const override {
+            out[0] = static_cast<float>(m_ticks);
+            out[1] = m_total;
+            out[2] = static_cast<float>(m_seed % 1000);
+        }
+
+        size_t getControlSize() const override { return 1; }
+        void   applyControls(std::span<float const> const controls) override {
+            m_speed = controls[0];
+        }
+
+        uint64_t getSeed() const { return m_seed; }
+    };
+
+    SceneFactory counterFactory() {
+        return [](size_t, uint64_t const seed) {
+            return std::make_shared<CounterScene>(seed);
+        };
+    }
+
+    uint64_t seedOf(SceneBatch const &batch, size_t const index) {
+        return static_cast<CounterScene const &>(batch.getWorld(index))
+            .getSeed();
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SceneBatchTests)
+
+BOOST_AUTO_TEST_CASE(test_worlds_get_distinct_repeatable_seeds) {
+    Timer      timer("Worlds get distinct, repeatable seeds");
+    JobSystem  jobs(4);
+    SceneBatch first(jobs, 64, 7, counterFactory());
+    SceneBatch second(jobs, 64, 7, counterFactory());
+    SceneBatch other(jobs, 64, 8, counterFactory());
+
+    std::set<uint64_t> seeds;
+    for (size_t i = 0; i < first.size(); ++i) {
+        seeds.insert(seedOf(first, i));
+        BOOST_CHECK_EQUAL(seedOf(first, i), seedOf(second, i));
+        BOOST_CHECK_NE(seedOf(first, i), seedOf(other, i));
+    }
+    BOOST_CHECK_EQUAL(seeds.size(), 64);
+    BOOST_CHECK_EQUAL(first.getObservationSize(), 3);
+    BOOST_CHECK_EQUAL(first.getControlSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_step_and_observe_per_world) {
+    Timer      timer("Step and observe per world");
+    JobSystem  jobs(4);
+    SceneBatch batch(jobs, 100, 1, counterFactory());
+
+    std::vector<float> controls(batch.size());
+    for (size_t i = 0; i < controls.size(); ++i) {
+        controls[i] = static_cast<float>(i % 3) * 0.25f;
+    }
+    batch.step(controls, 1.0f / 60.0f, 4);
+
+    std::vector<float> observations(batch.size() * 3);
+    batch.observe(observations);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        BOOST_CHECK_EQUAL(observations[i * 3], 4.0f);
+        BOOST_CHECK_CLOSE(observations[i * 3 + 1], controls[i] * 4, 1e-4);
+        BOOST_CHECK_EQUAL(observations[i * 3 + 2],
+                          static_cast<float>(seedOf(batch, i) % 1000));
+        BOOST_CHECK_EQUAL(batch.getDone()[i], 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_ended_worlds_stop_and_reset) {
+    Timer      timer("Ended worlds stop and reset");
+    JobSystem  jobs(2);
+    SceneBatch batch(jobs, 4, 3, counterFactory());
+
+    // Worlds 1 and 3 pass the limit on their third tick.
+    std::vector<float> const controls{0, 4, 0, 4};
+    batch.step(controls, 1.0f / 60.0f, 10);
+
+    std::vector<float> observations(batch.size() * 3);
+    batch.observe(observations);
+    BOOST_CHECK_EQUAL(observations[0 * 3], 10.0f);
+    BOOST_CHECK_EQUAL(observations[1 * 3], 3.0f);
+    BOOST_CHECK_EQUAL(batch.getDone()[0], 0);
+    BOOST_CHECK_EQUAL(batch.getDone()[1], 1);
+    BOOST_CHECK_EQUAL(batch.getDone()[3], 1);
+
+    uint64_t const oldSeed = seedOf(batch, 1);
+    BOOST_CHECK_EQUAL(batch.resetDone(), 2);
+    BOOST_CHECK_NE(seedOf(batch, 1), oldSeed);
+    BOOST_CHECK_EQUAL(batch.getDone()[1], 0);
+
+    batch.observe(observations);
+    BOOST_CHECK_EQUAL(observations[1 * 3], 0.0f);
+    BOOST_CHECK_EQUAL(observations[0 * 3], 10.0f);
+}
+
+BOOST_AUTO_TEST_CASE(test_rejects_wrong_buffer_sizes) {
+    Timer      timer("Rejects wrong buffer sizes");
+    JobSystem  jobs(1);
+    SceneBatch batch(jobs, 3, 0, counterFactory());
+
+    std::vector<float> controls(2);
+    BOOST_CHECK_THROW(batch.step(controls, 1.0f / 60.0f), std::runtime_error);
+
+    std::vector<float> observations(10);
+    BOOST_CHECK_THROW(batch.observe(observations), std::runtime_error);
+
+    BOOST_CHECK_THROW(SceneBatch(jobs, 2, 0,
+                                 [](size_t, uint64_t) {
+                                     return std::shared_ptr<Scene>();
+                                 }),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
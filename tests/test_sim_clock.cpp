@@ -0,0 +1,100 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <GameEngine/FixedTimestep.hpp>
+#include <GameEngine/SimClock.hpp>
+
+#include <limits>
+
+using namespace YerbEngine;
+
+namespace {
+    // Steps `clock` the way GameEngine::Update does and returns the ticks
+    // run.
+    size_t runFrames(SimClock      &clock,
+                     FixedTimestep &timestep,
+                     int const      frames,
+                     double const   frameSeconds) {
+        size_t total = 0;
+        for (int frame = 0; frame < frames; ++frame) {
+            size_t const steps =
+                clock.isUnthrottled()
+                    ? clock.getUnthrottledTicks()
+                    : timestep.advance(clock.scale(frameSeconds));
+            for (size_t step = 0; step < steps; ++step) {
+                clock.tick(timestep.getTickSeconds());
+            }
+            total += steps;
+        }
+        return total;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SimClockTests)
+
+BOOST_AUTO_TEST_CASE(test_time_scale_changes_tick_count) {
+    Timer         timer("Time scale changes tick count");
+    SimClock      clock;
+    FixedTimestep timestep(100, 10);
+
+    // One real second at normal speed, then at half and double speed.
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 100, 0.01), 100);
+    BOOST_CHECK_EQUAL(clock.now(), 1000);
+
+    clock.setTimeScale(0.5);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 100, 0.01), 50);
+    clock.setTimeScale(2.0);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 100, 0.01), 200);
+
+    BOOST_CHECK_EQUAL(clock.now(), 3500);
+    BOOST_CHECK_EQUAL(clock.getTickCount(), 350);
+    BOOST_CHECK_EQUAL(timestep.getDroppedTicks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_paused_clock_runs_no_ticks) {
+    Timer         timer("Paused clock runs no ticks");
+    SimClock      clock;
+    FixedTimestep timestep(60, 5);
+
+    clock.setPaused(true);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 120, 1.0 / 60), 0);
+    BOOST_CHECK_EQUAL(clock.now(), 0);
+
+    clock.setUnthrottled(true, 100);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 10, 1.0 / 60), 0);
+
+    clock.setPaused(false);
+    clock.setUnthrottled(false);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 60, 1.0 / 60), 60);
+}
+
+BOOST_AUTO_TEST_CASE(test_unthrottled_ignores_real_time) {
+    Timer         timer("Unthrottled ignores real time");
+    SimClock      clock;
+    FixedTimestep timestep(60, 5);
+
+    // An hour of simulated play in 360 frames, however long they take.
+    clock.setUnthrottled(true, 600);
+    BOOST_CHECK_EQUAL(runFrames(clock, timestep, 360, 0.0), 216000);
+    BOOST_CHECK_EQUAL(clock.now(), 3600 * 1000);
+    BOOST_CHECK_EQUAL(clock.scale(1.0), 0.0);
+
+    clock.setUnthrottled(true, 0); // at least one tick per frame
+    BOOST_CHECK_EQUAL(clock.getUnthrottledTicks(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_time_scale_is_rejected) {
+    Timer    timer("Invalid time scale is rejected");
+    SimClock clock;
+
+    clock.setTimeScale(4.0);
+    clock.setTimeScale(-1.0);
+    clock.setTimeScale(std::numeric_limits<double>::quiet_NaN());
+    BOOST_CHECK_EQUAL(clock.getTimeScale(), 4.0);
+
+    clock.setTimeScale(0.0); // frozen, but not paused
+    BOOST_CHECK_EQUAL(clock.scale(1.0), 0.0);
+    BOOST_CHECK(!clock.isPaused());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,237 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestEntities.hpp"
+#include "Timer.hpp"
+#include <EntityManagement/EntityManager.hpp>
+#include <Physics/CollisionWorld.hpp>
+#include <Physics/SpawnPlacer.hpp>
+
+#include <map>
+
+using namespace YerbEngine;
+
+namespace {
+    void updateWorld(CollisionWorld &world,
+                     EntityManager  &manager,
+                     Vec2 const     &bounds) {
+        manager.update();
+        world.setBounds(bounds);
+        world.update(manager);
+    }
+
+    bool overlaps(Vec2 const &a,
+                  Vec2 const &b,
+                  Vec2 const &size) {
+        return AABB{a, a + size}.overlaps(AABB{b, b + size});
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SpawnPlacerTests)
+
+BOOST_AUTO_TEST_CASE(test_sample_avoids_entities_and_constraints) {
+    Timer          timer("Sample avoids entities and constraints");
+    EntityManager  manager;
+    CollisionWorld world;
+    std::mt19937   randomGenerator(42);
+    SpawnPlacer    placer(world);
+
+    // Left half of the window is blocked.
+    addBox(manager, EntityTags::Wall, Vec2{0, 0}, Vec2{400, 600});
+    updateWorld(world, manager, Vec2{800, 600});
+    placer.setBounds(Vec2{800, 600});
+
+    SpawnConstraints const constraints{
+        .avoidCenter = Vec2{600, 300}, .avoidRadius = 100, .margin = 5};
+    Vec2 const size{20, 20};
+
+    for (int i = 0; i < 200; ++i) {
+        Vec2 position;
+        BOOST_REQUIRE(
+            placer.sample(randomGenerator, size, constraints, position));
+        Vec2 const center = position + size / 2;
+        BOOST_CHECK_GE(position.x(), 400.0f);
+        BOOST_CHECK_GE(position.y(), 5.0f);
+        BOOST_CHECK_LE(position.x() + size.x(), 795.0f);
+        BOOST_CHECK_LE(position.y() + size.y(), 595.0f);
+        BOOST_CHECK_GE(center.euclideanDistance(constraints.avoidCenter),
+                       100.0f);
+        // Placements are only held until the world's next update, and
+        // none of them became entities, so the window does not fill up.
+        updateWorld(world, manager, Vec2{800, 600});
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sampled_positions_do_not_overlap) {
+    Timer          timer("Sampled positions do not overlap");
+    CollisionWorld world;
+    std::mt19937   randomGenerator(7);
+    SpawnPlacer    placer(world);
+    placer.setBounds(Vec2{320, 320});
+
+    Vec2 const        size{16, 16};
+    std::vector<Vec2> placed;
+    Vec2              position;
+    while (placer.sample(randomGenerator, size, {}, position)) {
+        placed.push_back(position);
+    }
+
+    // Sampling only gives up once no cell-aligned slot is left.
+    BOOST_CHECK_GT(placed.size(), 100);
+    for (float y = 0; y + size.y() <= 320; y += 16) {
+        for (float x = 0; x + size.x() <= 320; x += 16) {
+            BOOST_CHECK(!placer.isFree({Vec2{x, y}, Vec2{x, y} + size}));
+        }
+    }
+    for (size_t i = 0; i < placed.size(); ++i) {
+        for (size_t j = i + 1; j < placed.size(); ++j) {
+            BOOST_CHECK(!overlaps(placed[i], placed[j], size));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_finds_single_free_slot) {
+    Timer          timer("Sample finds single free slot");
+    EntityManager  manager;
+    CollisionWorld world;
+    std::mt19937   randomGenerator(1);
+    SpawnPlacer    placer(world);
+
+    // Everything is blocked except a 32x32 hole at (320, 160).
+    addBox(manager, EntityTags::Wall, Vec2{0, 0}, Vec2{320, 480});
+    addBox(manager, EntityTags::Wall, Vec2{352, 0}, Vec2{288, 480});
+    addBox(manager, EntityTags::Wall, Vec2{320, 0}, Vec2{32, 160});
+    addBox(manager, EntityTags::Wall, Vec2{320, 192}, Vec2{32, 288});
+    updateWorld(world, manager, Vec2{640, 480});
+    placer.setBounds(Vec2{640, 480});
+
+    Vec2 position;
+    BOOST_REQUIRE(placer.sample(randomGenerator, Vec2{30, 30}, {}, position));
+    BOOST_CHECK_CLOSE(position.x(), 320.0f, 0.01f);
+    BOOST_CHECK_CLOSE(position.y(), 160.0f, 0.01f);
+
+    // The slot is now taken.
+    BOOST_CHECK(!placer.sample(randomGenerator, Vec2{30, 30}, {}, position));
+}
+
+BOOST_AUTO_TEST_CASE(test_anchor_scan_is_uniform_past_margin) {
+    Timer          timer("Anchor scan is uniform past margin");
+    EntityManager  manager;
+    CollisionWorld world;
+    std::mt19937   randomGenerator(3);
+    SpawnPlacer    placer(world);
+
+    // Only a strip exactly 20 high at y = 40 is free, so random tries never
+    // land and every pick comes from the anchor scan. With a margin wider
+    // than the 16 px anchor step, the anchors are x = 40, 56 and 72.
+    addBox(manager, EntityTags::Wall, Vec2{0, 0}, Vec2{39, 600});
+    addBox(manager, EntityTags::Wall, Vec2{101, 0}, Vec2{699, 600});
+    addBox(manager, EntityTags::Wall, Vec2{39, 0}, Vec2{62, 40});
+    addBox(manager, EntityTags::Wall, Vec2{39, 60}, Vec2{62, 540});
+    updateWorld(world, manager, Vec2{800, 600});
+    placer.setBounds(Vec2{800, 600});
+
+    SpawnConstraints const constraints{.margin = 40};
+    std::map<int, int>     picks;
+    for (int i = 0; i < 300; ++i) {
+        Vec2 position;
+        BOOST_REQUIRE(placer.sample(randomGenerator, Vec2{20, 20},
+                                    constraints, position));
+        BOOST_CHECK_CLOSE(position.y(), 40.0f, 0.01f);
+        picks[static_cast<int>(position.x())] += 1;
+        world.update(manager); // frees the slot again
+    }
+
+    BOOST_REQUIRE_EQUAL(picks.size(), 3);
+    for (int const x : {40, 56, 72}) {
+        BOOST_CHECK_GT(picks[x], 60);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_batch_spacing) {
+    Timer          timer("Sample batch spacing");
+    CollisionWorld world;
+    std::mt19937   randomGenerator(3);
+    SpawnPlacer    placer(world);
+    placer.setBounds(Vec2{1280, 720});
+
+    Vec2 const        size{20, 20};
+    float const       spacing = 90.0f;
+    std::vector<Vec2> positions;
+    size_t const      found =
+        placer.sampleBatch(randomGenerator, size, 40, spacing, {}, positions);
+
+    BOOST_CHECK_EQUAL(found, 40);
+    BOOST_REQUIRE_EQUAL(positions.size(), found);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        for (size_t j = i + 1; j < positions.size(); ++j) {
+            BOOST_CHECK_GE(positions[i].euclideanDistance(positions[j]),
+                           spacing);
+        }
+    }
+
+    // Batch results are occupied like single samples.
+    for (Vec2 const &placed : positions) {
+        BOOST_CHECK(!placer.isFree({placed, placed + size}));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_occupancy_follows_world_updates) {
+    Timer          timer("Occupancy follows world updates");
+    EntityManager  manager;
+    CollisionWorld world;
+    std::mt19937   randomGenerator(5);
+    SpawnPlacer    placer(world);
+    Vec2 const     bounds{640, 480};
+    Vec2 const     size{30, 30};
+    placer.setBounds(bounds);
+    updateWorld(world, manager, bounds);
+
+    // A placement holds its spot until the world has seen the entity.
+    Vec2 position;
+    BOOST_REQUIRE(placer.sample(randomGenerator, size, {}, position));
+    AABB const placed{position, position + size};
+    BOOST_CHECK(!placer.isFree(placed));
+
+    std::shared_ptr<Entity> const spawned =
+        addBox(manager, EntityTags::Wall, position, size);
+    updateWorld(world, manager, bounds);
+    BOOST_CHECK(!placer.isFree(placed));
+
+    // Bodies added or destroyed later are picked up by the next world
+    // update without touching the placer.
+    Vec2 const wallMin = position.x() < 320 ? Vec2{400, 100} : Vec2{100, 100};
+    AABB const wall{wallMin, wallMin + Vec2{100, 100}};
+    BOOST_CHECK(placer.isFree(wall));
+    addBox(manager, EntityTags::Wall, wall.min, wall.max - wall.min);
+    spawned->destroy();
+    updateWorld(world, manager, bounds);
+    BOOST_CHECK(!placer.isFree(wall));
+    BOOST_CHECK(placer.isFree(placed));
+}
+
+BOOST_AUTO_TEST_CASE(test_wave_avoids_earlier_spawns_in_round) {
+    Timer          timer("Wave avoids earlier spawns in round");
+    EntityManager  manager;
+    CollisionWorld world;
+    std::mt19937   randomGenerator(9);
+    SpawnPlacer    placer(world);
+    Vec2 const     bounds{200, 200};
+    Vec2 const     size{40, 40};
+    placer.setBounds(bounds);
+    updateWorld(world, manager, bounds);
+
+    // Two waves before the world updates: the second only sees the first
+    // through the placer, not through the world's grids.
+    std::vector<Vec2> positions;
+    placer.sampleBatch(randomGenerator, size, 4, 0.0f, {}, positions);
+    placer.sampleBatch(randomGenerator, size, 4, 0.0f, {}, positions);
+
+    BOOST_CHECK_GT(positions.size(), 4);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        for (size_t j = i + 1; j < positions.size(); ++j) {
+            BOOST_CHECK(!overlaps(positions[i], positions[j], size));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,261 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <EntityManagement/EntityManager.hpp>
+#include <GameScenes/SystemPipeline.hpp>
+#include <Threading/JobSystem.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace YerbEngine;
+
+BOOST_AUTO_TEST_SUITE(SystemPipelineTests)
+
+BOOST_AUTO_TEST_CASE(test_runs_by_phase_in_registration_order) {
+    Timer                    timer("Runs by phase in registration order");
+    SystemPipeline           pipeline;
+    std::vector<std::string> order;
+
+    pipeline.add("render", SystemPhase::Render, [&] { order.push_back("r"); })
+        .add("lifespan", SystemPhase::Post, [&] { order.push_back("l"); })
+        .add("movement", SystemPhase::Simulate, [&] { order.push_back("m"); })
+        .add("collision", SystemPhase::Simulate,
+             [&] { order.push_back("c"); });
+
+    BOOST_REQUIRE_EQUAL(pipeline.getSystems().size(), 4);
+    BOOST_CHECK_EQUAL(pipeline.getSystems()[0].name, "movement");
+    BOOST_CHECK_EQUAL(pipeline.getSystems()[1].name, "collision");
+    BOOST_CHECK_EQUAL(pipeline.getSystems()[2].name, "lifespan");
+    BOOST_CHECK_EQUAL(pipeline.getSystems()[3].name, "render");
+
+    pipeline.run(SystemPhase::Simulate);
+    pipeline.run(SystemPhase::Post);
+    pipeline.run(SystemPhase::Input); // nothing registered
+    std::vector<std::string> const expected{"m", "c", "l"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_enable_and_interval) {
+    Timer          timer("Enable and interval");
+    SystemPipeline pipeline;
+    int            everyTick  = 0;
+    int            everyThird = 0;
+
+    pipeline.add("a", SystemPhase::Simulate, [&] { everyTick++; })
+        .add("b", SystemPhase::Simulate, [&] { everyThird++; }, 3);
+
+    for (int tick = 0; tick < 9; ++tick) {
+        pipeline.run(SystemPhase::Simulate);
+    }
+    BOOST_CHECK_EQUAL(everyTick, 9);
+    BOOST_CHECK_EQUAL(everyThird, 3);
+
+    pipeline.setEnabled("a", false);
+    pipeline.setInterval("b", 1);
+    pipeline.run(SystemPhase::Simulate);
+    BOOST_CHECK(!pipeline.isEnabled("a"));
+    BOOST_CHECK_EQUAL(everyTick, 9);
+    BOOST_CHECK_EQUAL(everyThird, 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_systems_are_timed) {
+    Timer          timer("Systems are timed");
+    SystemPipeline pipeline;
+    pipeline.add("slow", SystemPhase::Render, [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+
+    pipeline.run(SystemPhase::Render);
+    pipeline.run(SystemPhase::Render);
+
+    SystemStats const &stats = pipeline.getStats("slow");
+    BOOST_CHECK_EQUAL(stats.runs, 2);
+    BOOST_CHECK_GE(stats.lastMs, 1.9);
+    BOOST_CHECK_GE(stats.maxMs, stats.lastMs);
+    BOOST_CHECK_CLOSE(stats.averageMs(), stats.totalMs / 2, 1e-6);
+
+    pipeline.resetStats();
+    BOOST_CHECK_EQUAL(pipeline.getStats("slow").runs, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_helped_jobs_are_not_billed) {
+    Timer          timer("Helped jobs are not billed");
+    JobSystem      jobs(1);
+    SystemPipeline pipeline;
+
+    // Queued outside any system, so whoever runs it is only helping out.
+    JobCounter counter;
+    jobs.submit(
+        [] {
+            std::vector<int> const scratch(64);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        },
+        counter);
+    pipeline.add("waiter", SystemPhase::Simulate,
+                 [&jobs, &counter] { jobs.wait(counter); });
+
+    pipeline.run(SystemPhase::Simulate);
+
+    SystemStats const &stats = pipeline.getStats("waiter");
+    BOOST_CHECK(counter.isDone());
+    BOOST_CHECK_LT(stats.lastMs, 10.0);
+    BOOST_CHECK_EQUAL(stats.allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_metrics_only_where_set) {
+    Timer           timer("Metrics only where set");
+    MetricsRegistry registry;
+    SystemPipeline  pipeline;
+    pipeline.add("quiet", SystemPhase::Simulate, [] {});
+    pipeline.run(SystemPhase::Simulate);
+    BOOST_CHECK(registry.findHistogram("system.quiet") == nullptr);
+
+    // Systems added before and after setMetrics() both publish.
+    pipeline.setMetrics(&registry);
+    pipeline.add("late", SystemPhase::Simulate, [] {});
+    pipeline.run(SystemPhase::Simulate);
+    BOOST_REQUIRE(registry.findHistogram("system.quiet") != nullptr);
+    BOOST_CHECK_EQUAL(registry.findHistogram("system.quiet")->getStats().count,
+                      1);
+    BOOST_CHECK_EQUAL(registry.findHistogram("system.late")->getStats().count,
+                      1);
+
+    pipeline.setMetrics(nullptr);
+    pipeline.run(SystemPhase::Simulate);
+    BOOST_CHECK_EQUAL(registry.findHistogram("system.quiet")->getStats().count,
+                      1);
+    BOOST_CHECK_EQUAL(pipeline.getStats("quiet").runs, 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_registrations_throw) {
+    Timer          timer("Invalid registrations throw");
+    SystemPipeline pipeline;
+    pipeline.add("a", SystemPhase::Input, [] {});
+
+    BOOST_CHECK_THROW(pipeline.add("a", SystemPhase::Render, [] {}),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(pipeline.add("b", SystemPhase::Render, [] {}, 0),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(pipeline.setEnabled("missing", false),
+                      std::runtime_error);
+    BOOST_CHECK(!pipeline.contains("b"));
+}
+
+namespace {
+    struct AudioQueue {}; // stand-in resource
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_schedule_waves_follow_conflicts) {
+    Timer          timer("Schedule waves follow conflicts");
+    SystemPipeline pipeline;
+    using namespace Components;
+
+    pipeline
+        .add("movement", SystemPhase::Simulate,
+             SystemAccess().reads<CInput>().writes<CTransform>(), [] {})
+        .add("lifespan", SystemPhase::Simulate,
+             SystemAccess().reads<CLifespan>().writes<CShape>(), [] {})
+        .add("effects", SystemPhase::Simulate,
+             SystemAccess().writes<CEffects>(), [] {})
+        .add("audio", SystemPhase::Simulate,
+             SystemAccess().writes<AudioQueue>(), [] {})
+        .add("render", SystemPhase::Simulate,
+             SystemAccess().reads<CTransform, CShape>(), [] {})
+        .add("undeclared", SystemPhase::Simulate, [] {})
+        .add("late", SystemPhase::Simulate, SystemAccess().reads<CInput>(),
+             [] {});
+
+    BOOST_CHECK_EQUAL(pipeline.getWave("movement"), 0);
+    BOOST_CHECK_EQUAL(pipeline.getWave("lifespan"), 0);
+    BOOST_CHECK_EQUAL(pipeline.getWave("effects"), 0);
+    BOOST_CHECK_EQUAL(pipeline.getWave("audio"), 0);
+    // Reads what movement and lifespan write.
+    BOOST_CHECK_EQUAL(pipeline.getWave("render"), 1);
+    // Undeclared systems act as barriers.
+    BOOST_CHECK_EQUAL(pipeline.getWave("undeclared"), 2);
+    BOOST_CHECK_EQUAL(pipeline.getWave("late"), 3);
+    BOOST_CHECK_EQUAL(pipeline.getWaveCount(SystemPhase::Simulate), 4);
+
+    // Adding a system invalidates the cached schedule.
+    pipeline.add("after", SystemPhase::Simulate,
+                 SystemAccess().writes<CInput>(), [] {});
+    BOOST_CHECK_EQUAL(pipeline.getWave("after"), 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_independent_systems_run_concurrently) {
+    Timer          timer("Independent systems run concurrently");
+    JobSystem      pool(4);
+    SystemPipeline pipeline;
+    pipeline.setJobSystem(&pool);
+
+    // Each system waits for the other to start, which only finishes if
+    // both run at the same time.
+    std::atomic<int> started{0};
+    bool             timedOut = false;
+    auto const       rendezvous = [&] {
+        started++;
+        auto const deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (started.load() < 2) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                timedOut = true;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+
+    std::thread::id renderThread;
+    pipeline
+        .add("audio", SystemPhase::Render, SystemAccess().writes<AudioQueue>(),
+             rendezvous)
+        .add("render", SystemPhase::Render,
+             SystemAccess().reads<Components::CShape>().onMainThread(), [&] {
+                 renderThread = std::this_thread::get_id();
+                 rendezvous();
+             });
+
+    pipeline.run(SystemPhase::Render);
+    BOOST_CHECK(!timedOut);
+    BOOST_CHECK(renderThread == std::this_thread::get_id());
+}
+
+#if YERB_CHECK_SYSTEM_ACCESS
+BOOST_AUTO_TEST_CASE(test_undeclared_access_is_detected) {
+    Timer          timer("Undeclared access is detected");
+    EntityManager  manager;
+    SystemPipeline pipeline;
+    using namespace Components;
+
+    auto entity = manager.addEntity(EntityTags::Enemy);
+    entity->setComponent(std::make_shared<CTransform>());
+    entity->setComponent(std::make_shared<CLifespan>(1000));
+    manager.update();
+
+    pipeline
+        .add("honest", SystemPhase::Post, SystemAccess().writes<CTransform>(),
+             [&] { entity->getComponent<CTransform>()->velocity = Vec2{1, 0}; })
+        .add("sneaky", SystemPhase::Post, SystemAccess().reads<CTransform>(),
+             [&] {
+                 entity->getComponent<CLifespan>();
+                 entity->setComponent(std::make_shared<CTransform>());
+             });
+
+    pipeline.run(SystemPhase::Post);
+    pipeline.run(SystemPhase::Post);
+    BOOST_CHECK_EQUAL(pipeline.getStats("honest").accessViolations, 0);
+    // A read of CLifespan and a write of CTransform, on both passes.
+    BOOST_CHECK_EQUAL(pipeline.getStats("sneaky").accessViolations, 4);
+
+    pipeline.setAccessChecks(false);
+    pipeline.resetStats();
+    pipeline.run(SystemPhase::Post);
+    BOOST_CHECK_EQUAL(pipeline.getStats("sneaky").accessViolations, 0);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
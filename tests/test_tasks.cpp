@@ -0,0 +1,157 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <Coroutines/Task.hpp>
+
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    Task tickEvery(TaskScheduler &tasks, double const interval,
+                   std::vector<double> &wakeTimes) {
+        while (true) {
+            co_await tasks.waitFor(interval);
+            wakeTimes.push_back(tasks.now());
+        }
+    }
+
+    Task countFrames(TaskScheduler &tasks, int &frames) {
+        while (true) {
+            co_await tasks.nextFrame();
+            frames++;
+        }
+    }
+
+    Task awaitEvent(TaskEvent &event, int &wakes) {
+        co_await event;
+        wakes++;
+    }
+
+    struct DestroyCounter {
+        int &destroyed;
+        ~DestroyCounter() { destroyed++; }
+    };
+
+    Task sleepForever(TaskScheduler &tasks, int &destroyed) {
+        DestroyCounter const counter{destroyed};
+        co_await tasks.waitFor(1e12);
+    }
+
+    Task sleepOnce(TaskScheduler &tasks, double const duration, int &done) {
+        co_await tasks.waitFor(duration);
+        done++;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(TaskTests)
+
+BOOST_AUTO_TEST_CASE(test_wait_for_wakes_on_due_tick_without_drift) {
+    Timer               timer("Wait for wakes on due tick");
+    TaskScheduler       tasks;
+    std::vector<double> wakeTimes;
+    tasks.spawn(tickEvery(tasks, 100, wakeTimes));
+    BOOST_CHECK_EQUAL(tasks.getSleepingCount(), 1);
+
+    // 60 Hz ticks do not divide 100 ms, yet every wake reads its exact due
+    // time, so the next wait is measured from there.
+    for (int tick = 0; tick <= 60; ++tick) {
+        tasks.update(1000.0 / 60.0);
+    }
+
+    BOOST_REQUIRE_EQUAL(wakeTimes.size(), 10);
+    for (size_t i = 0; i < wakeTimes.size(); ++i) {
+        BOOST_CHECK_CLOSE(wakeTimes[i], 100.0 * static_cast<double>(i + 1),
+                          1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_next_frame_resumes_once_per_update) {
+    Timer         timer("Next frame resumes once per update");
+    TaskScheduler tasks;
+    int           frames = 0;
+    tasks.spawn(countFrames(tasks, frames));
+    BOOST_CHECK_EQUAL(frames, 0);
+
+    for (int tick = 0; tick < 5; ++tick) {
+        tasks.update(16);
+    }
+    BOOST_CHECK_EQUAL(frames, 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_event_wakes_waiters_on_next_update) {
+    Timer         timer("Event wakes waiters on next update");
+    TaskScheduler tasks;
+    TaskEvent     event(tasks);
+    int           wakes = 0;
+
+    tasks.spawn(awaitEvent(event, wakes));
+    tasks.spawn(awaitEvent(event, wakes));
+    BOOST_CHECK_EQUAL(event.getWaiterCount(), 2);
+
+    event.signal();
+    BOOST_CHECK_EQUAL(wakes, 0); // not inside signal()
+    tasks.update(16);
+    BOOST_CHECK_EQUAL(wakes, 2);
+    BOOST_CHECK_EQUAL(tasks.getTaskCount(), 0);
+
+    // A task that starts waiting after the signal needs the next one.
+    tasks.spawn(awaitEvent(event, wakes));
+    tasks.update(16);
+    BOOST_CHECK_EQUAL(wakes, 2);
+    event.signal();
+    tasks.update(16);
+    BOOST_CHECK_EQUAL(wakes, 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_cancel_destroys_suspended_tasks) {
+    Timer         timer("Cancel destroys suspended tasks");
+    int           destroyed = 0;
+    TaskScheduler tasks;
+    TaskEvent     event(tasks);
+    int           wakes = 0;
+
+    tasks.spawn(sleepForever(tasks, destroyed));
+    tasks.spawn(sleepForever(tasks, destroyed));
+    tasks.spawn(awaitEvent(event, wakes));
+    BOOST_CHECK_EQUAL(tasks.getTaskCount(), 3);
+
+    tasks.cancelAll();
+    BOOST_CHECK_EQUAL(destroyed, 2);
+    BOOST_CHECK_EQUAL(tasks.getTaskCount(), 0);
+    BOOST_CHECK_EQUAL(tasks.getSleepingCount(), 0);
+    BOOST_CHECK_EQUAL(event.getWaiterCount(), 0);
+
+    // Unspawned tasks are destroyed with their Task object.
+    { Task const unused = sleepForever(tasks, destroyed); }
+    BOOST_CHECK_EQUAL(destroyed, 2); // never started, so no counter yet
+}
+
+BOOST_AUTO_TEST_CASE(test_frames_are_reused_from_the_pool) {
+    Timer         timer("Frames are reused from the pool");
+    TaskScheduler tasks;
+    int           done = 0;
+
+    auto const spawnWave = [&] {
+        for (int i = 0; i < 5000; ++i) {
+            tasks.spawn(sleepOnce(tasks, static_cast<double>(i % 50), done));
+        }
+        tasks.update(100);
+    };
+
+    spawnWave();
+    BOOST_CHECK_EQUAL(done, 5000);
+    BOOST_CHECK_EQUAL(tasks.getTaskCount(), 0);
+
+    FramePoolStats const warm = FramePool::instance().getStats();
+    spawnWave();
+    spawnWave();
+    FramePoolStats const after = FramePool::instance().getStats();
+
+    BOOST_CHECK_EQUAL(done, 15000);
+    BOOST_CHECK_EQUAL(after.chunks, warm.chunks);
+    BOOST_CHECK_EQUAL(after.largeFrames, warm.largeFrames);
+    BOOST_CHECK_EQUAL(after.liveFrames, warm.liveFrames);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
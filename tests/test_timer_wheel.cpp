@@ -0,0 +1,176 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Timer.hpp"
+#include <EntityManagement/EntityManager.hpp>
+#include <EntityManagement/LifespanTracker.hpp>
+#include <GameEngine/TimerWheel.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace YerbEngine;
+
+namespace {
+    std::shared_ptr<Entity> addMortal(EntityManager &manager,
+                                      Uint64 const   lifespan,
+                                      bool const     fades = true) {
+        auto entity      = manager.addEntity(EntityTags::Item);
+        auto cLifespan   = std::make_shared<Components::CLifespan>(lifespan);
+        cLifespan->fades = fades;
+        entity->setComponent(cLifespan);
+        return entity;
+    }
+
+    bool contains(EntityList const              &entities,
+                  std::shared_ptr<Entity> const &entity) {
+        return std::ranges::find(entities, entity) != entities.end();
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(TimerWheelTests)
+
+BOOST_AUTO_TEST_CASE(test_timers_fire_on_their_deadline) {
+    Timer                timer("Timers fire on their deadline");
+    TimerWheel<uint64_t> wheel;
+    std::mt19937_64      random(7);
+
+    // Deadlines spread over every level and into the overflow list.
+    std::vector<uint64_t> deadlines;
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t const bits = 4 + random() % 27;
+        deadlines.push_back(random() % (uint64_t{1} << bits));
+    }
+    for (uint64_t const deadline : deadlines) {
+        wheel.schedule(deadline, deadline);
+    }
+    BOOST_CHECK_EQUAL(wheel.size(), deadlines.size());
+
+    std::vector<std::pair<uint64_t, uint64_t>> fired; // {deadline, now}
+    uint64_t                                   now = 0;
+    while (!wheel.empty()) {
+        now += 1 + random() % 50000;
+        wheel.advance(now, [&](uint64_t const deadline) {
+            fired.emplace_back(deadline, wheel.now());
+        });
+    }
+
+    BOOST_REQUIRE_EQUAL(fired.size(), deadlines.size());
+    for (auto const &[deadline, firedAt] : fired) {
+        BOOST_CHECK_EQUAL(firedAt, deadline);
+    }
+    BOOST_CHECK(std::ranges::is_sorted(fired));
+}
+
+BOOST_AUTO_TEST_CASE(test_cancelled_timers_do_not_fire) {
+    Timer           timer("Cancelled timers do not fire");
+    TimerWheel<int> wheel;
+
+    auto const kept      = wheel.schedule(100, 1);
+    auto const cancelled = wheel.schedule(100, 2);
+    BOOST_CHECK(wheel.cancel(cancelled));
+    BOOST_CHECK(!wheel.cancel(cancelled));
+    BOOST_CHECK(!wheel.cancel(TimerWheel<int>::INVALID_TIMER));
+
+    // The node is reused, but the old id must not reach the new timer.
+    auto const reused = wheel.schedule(200, 3);
+    BOOST_CHECK(reused != cancelled);
+    BOOST_CHECK(!wheel.cancel(cancelled));
+
+    std::vector<int> fired;
+    wheel.advance(1000, [&](int const value) { fired.push_back(value); });
+    BOOST_CHECK((fired == std::vector<int>{1, 3}));
+    BOOST_CHECK(!wheel.cancel(kept));
+}
+
+BOOST_AUTO_TEST_CASE(test_callbacks_can_schedule_more_timers) {
+    Timer                 timer("Callbacks can schedule more timers");
+    TimerWheel<int>       wheel;
+    std::vector<uint64_t> fired;
+
+    wheel.schedule(10, 0);
+    wheel.advance(100, [&](int const step) {
+        fired.push_back(wheel.now());
+        if (step < 3) {
+            wheel.schedule(wheel.now() + 20, step + 1);
+        }
+        if (step == 3) {
+            wheel.schedule(wheel.now(), 4); // due now, same advance
+        }
+    });
+
+    BOOST_CHECK((fired == std::vector<uint64_t>{10, 30, 50, 70, 70}));
+    BOOST_CHECK(wheel.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_lifespans_fade_then_expire) {
+    Timer           timer("Lifespans fade then expire");
+    EntityManager   manager;
+    LifespanTracker lifespans(500);
+    EntityList      expired;
+
+    auto const shortLived = addMortal(manager, 300);
+    auto const longLived  = addMortal(manager, 60000);
+    auto const solid      = addMortal(manager, 1000, false);
+    lifespans.track(shortLived);
+    lifespans.track(longLived);
+    lifespans.track(solid);
+
+    // Lifespans shorter than the window fade from the start.
+    BOOST_CHECK(contains(lifespans.getFading(), shortLived));
+    BOOST_CHECK(!contains(lifespans.getFading(), longLived));
+
+    lifespans.advance(150, expired);
+    auto const &shortCLifespan =
+        shortLived->getComponent<Components::CLifespan>();
+    BOOST_CHECK_CLOSE(lifespans.getFadeProgress(*shortCLifespan), 0.5f, 1e-3f);
+    BOOST_CHECK(expired.empty());
+
+    lifespans.advance(300, expired);
+    BOOST_CHECK((expired == EntityList{shortLived}));
+    BOOST_CHECK(!contains(lifespans.getFading(), shortLived));
+    expired.clear();
+
+    lifespans.advance(59499, expired);
+    BOOST_CHECK(!contains(lifespans.getFading(), longLived));
+    BOOST_CHECK(!contains(lifespans.getFading(), solid)); // never fades
+    BOOST_CHECK((expired == EntityList{solid}));
+    expired.clear();
+
+    lifespans.advance(59500, expired);
+    BOOST_CHECK(contains(lifespans.getFading(), longLived));
+    BOOST_CHECK_EQUAL(lifespans.getFading().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_retime_and_destroy) {
+    Timer           timer("Retime and destroy");
+    EntityManager   manager;
+    LifespanTracker lifespans(1000);
+    EntityList      expired;
+
+    auto const shortened = addMortal(manager, 9000);
+    auto const destroyed = addMortal(manager, 9000);
+    lifespans.track(shortened);
+    lifespans.track(destroyed);
+    lifespans.advance(100, expired);
+
+    shortened->getComponent<Components::CLifespan>()->lifespan = 900;
+    lifespans.retime(shortened);
+    BOOST_CHECK(contains(lifespans.getFading(), shortened));
+    BOOST_CHECK_EQUAL(lifespans.getPendingCount(), 2);
+
+    destroyed->destroy();
+    lifespans.advance(899, expired);
+    BOOST_CHECK(expired.empty());
+    lifespans.advance(900, expired);
+    BOOST_CHECK((expired == EntityList{shortened}));
+
+    // Destroyed entities are dropped quietly when their timer comes up.
+    expired.clear();
+    lifespans.advance(20000, expired);
+    BOOST_CHECK(expired.empty());
+    BOOST_CHECK_EQUAL(lifespans.getPendingCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()